@@ -57,15 +57,20 @@
 // Use busy wait loop for timing sync, if not defined, a high-resolution timer is set up and used
 //#define SUPPORT_BUSY_WAIT_LOOP          1
 // Use a partial-busy wait loop, in this case frame sleeps for most of the time, but then runs a busy loop at the end for accuracy
+// NOTE: Busy loop length is adapted to the sleep overshoot measured on every wait
 #define SUPPORT_PARTIALBUSY_WAIT_LOOP    1
 // Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 #define SUPPORT_SCREEN_CAPTURE          1
-// Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
+// Allow screen recording (GIF, QOI frames, raw frames) with async readback and background encoding,
+// automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
 #define SUPPORT_GIF_RECORDING           1
 // Support CompressData() and DecompressData() functions
 #define SUPPORT_COMPRESSION_API         1
-// Support automatic generated events, loading and recording of those events when required
+// Support automatic generated events, loading and recording of those events when required,
+// events can be streamed to/from compact binary files (delta encoded) for long recordings
 #define SUPPORT_AUTOMATION_EVENTS       1
+// Support frame profiling: CPU zones, render statistics, GPU timing and trace export (Chrome trace-event format)
+#define SUPPORT_PROFILER                1
 // Support custom frame control, only for advanced users
 // By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timing + PollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
@@ -74,7 +79,6 @@
 
 // rcore: Configuration values
 //------------------------------------------------------------------------------------
-#define MAX_FILEPATH_CAPACITY        8192       // Maximum file paths capacity
 #define MAX_FILEPATH_LENGTH          4096       // Maximum length for filepaths (Linux PATH_MAX default value)
 
 #define MAX_KEYBOARD_KEYS             512       // Maximum number of keyboard keys supported
@@ -89,7 +93,18 @@
 
 #define MAX_DECOMPRESSION_SIZE         64       // Max size allocated for decompression in MB
 
-#define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
+#define MAX_AUTOMATION_EVENTS       16384       // Initial capacity of automation events list, grows as required while recording
+#define AUTOMATION_STREAM_BUFFER_SIZE 65536     // Automation events stream buffer size, stream files are written/read in blocks of this size
+
+#define FRAME_TIME_HISTORY_COUNT      512       // Frame times registered for frame time statistics (GetFrameTimeStats())
+
+#define GIF_RECORD_FRAMERATE           10       // GIF recording framerate, automatic recording (CTRL+F12)
+#define MAX_RECORDING_QUEUE_FRAMES      4       // Maximum number of recorded frames waiting to be encoded, frames are dropped when full
+#define RECORDING_READBACK_BUFFERS      3       // Number of pixel buffers for async screen readback
+
+#define MAX_PROFILE_ZONES             256       // Maximum number of profile zones registered per frame
+#define MAX_PROFILE_ZONE_DEPTH         32       // Maximum profile zones nesting depth
+#define MAX_PROFILE_TRACE_FRAMES      300       // Maximum number of frames recorded for profile trace export
 
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
@@ -198,6 +213,8 @@
 #define SUPPORT_FILEFORMAT_TTF          1
 #define SUPPORT_FILEFORMAT_FNT          1
 //#define SUPPORT_FILEFORMAT_BDF          1
+// raylib precompiled font format, glyphs data and atlas stored ready to use [ExportFont()]
+#define SUPPORT_FILEFORMAT_RFNT         1
 
 // Support text management functions
 // If not defined, still some functions are supported: TextLength(), TextFormat()
@@ -250,6 +267,10 @@
 //#define SUPPORT_FILEFORMAT_FLAC         1
 #define SUPPORT_FILEFORMAT_XM           1
 #define SUPPORT_FILEFORMAT_MOD          1
+// Use SIMD instructions (SSE/AVX/NEON, as enabled by compiler flags) for audio mixing
+#define SUPPORT_AUDIO_SIMD_MIXING       1
+// Decode music streams ahead of playback on a background thread, UpdateMusicStream() is not required
+#define SUPPORT_MUSIC_DECODE_THREAD     1
 
 // raudio: Configuration values
 //------------------------------------------------------------------------------------
@@ -258,12 +279,22 @@
 #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
 
 #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define MAX_AUDIO_VOICES                 128    // Maximum number of voices playing at the same time (voices pool)
+#define AUDIO_MIX_BLOCK_SIZE             512    // Mixing block size in frames, also volume/pan ramps length
+#define AUDIO_MUSIC_SUBBUFFERS             4    // Music streams sub-buffers decoded ahead of playback (2..8)
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
 //------------------------------------------------------------------------------------
 // Standard file io library (stdio.h) included
 #define SUPPORT_STANDARD_FILEIO         1
+// Memory-mapped files (read-only, zero-copy) for loaders reading large files, i.e. music streams
+#define SUPPORT_FILE_MAPPING            1
+// Mount packed file archives (.rpak), file loading functions resolve paths through mounted archives
+// NOTE: Compressed archive entries require SUPPORT_COMPRESSION_API
+#define SUPPORT_FILE_ARCHIVES           1
+// Watch files for changes on a background thread (inotify on Linux, polling otherwise), i.e. assets hot-reloading
+#define SUPPORT_FILE_WATCHER            1
 // Show TRACELOG() output messages
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
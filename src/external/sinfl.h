@@ -427,6 +427,8 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         return (int)(out-o);
       if (len > (e - s.bitptr) || !len)
         return (int)(out-o);
+      if (len > (oe - out))     // @raysan5: added
+        return (int)(out-o);
 
       memcpy(out, s.bitptr, (size_t)len);
       s.bitptr += len, out += len;
@@ -490,6 +492,9 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
           *out++ = (unsigned char)sym;
           sym = sinfl_decode(&s, s.lits, 10);
           if (sym < 256) {
+            if (sinfl_unlikely(out >= oe)) {    // @raysan5: added
+              return (int)(out-o);
+            }
             *out++ = (unsigned char)sym;
             continue;
           }
@@ -513,6 +518,9 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         if (sinfl_unlikely(offs > (int)(out-o))) {
           return (int)(out-o);
         }
+        if (sinfl_unlikely(len > (int)(oe-out))) {    // @raysan5: added
+          return (int)(out-o);
+        }
         out = out + len;
 
 #ifndef SINFL_NO_SIMD
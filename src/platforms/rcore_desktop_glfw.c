@@ -1238,6 +1238,10 @@ void PollInputEvents(void)
 
             for (int k = 0; (axes != NULL) && (k < GLFW_GAMEPAD_AXIS_LAST + 1); k++)
             {
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+                // Register axis change as automation event (no gamepad callbacks available)
+                if ((int)(axes[k]*32768.0f) != (int)(CORE.Input.Gamepad.axisState[i][k]*32768.0f)) RecordAutomationEvent(INPUT_GAMEPAD_AXIS_MOTION, i, k, (int)(axes[k]*32768.0f));
+#endif
                 CORE.Input.Gamepad.axisState[i][k] = axes[k];
             }
 
@@ -1245,6 +1249,17 @@ void PollInputEvents(void)
             CORE.Input.Gamepad.currentButtonState[i][GAMEPAD_BUTTON_LEFT_TRIGGER_2] = (char)(CORE.Input.Gamepad.axisState[i][GAMEPAD_AXIS_LEFT_TRIGGER] > 0.1f);
             CORE.Input.Gamepad.currentButtonState[i][GAMEPAD_BUTTON_RIGHT_TRIGGER_2] = (char)(CORE.Input.Gamepad.axisState[i][GAMEPAD_AXIS_RIGHT_TRIGGER] > 0.1f);
 
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+            // Register buttons changes as automation events (no gamepad callbacks available)
+            for (int k = 0; automationEventRecording && (k < MAX_GAMEPAD_BUTTONS); k++)
+            {
+                if (CORE.Input.Gamepad.currentButtonState[i][k] != CORE.Input.Gamepad.previousButtonState[i][k])
+                {
+                    RecordAutomationEvent(CORE.Input.Gamepad.currentButtonState[i][k]? INPUT_GAMEPAD_BUTTON_DOWN : INPUT_GAMEPAD_BUTTON_UP, i, k, 0);
+                }
+            }
+#endif
+
             CORE.Input.Gamepad.axisCount[i] = GLFW_GAMEPAD_AXIS_LAST + 1;
         }
     }
@@ -1798,6 +1813,12 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
     else if(action == GLFW_PRESS) CORE.Input.Keyboard.currentKeyState[key] = 1;
     else if(action == GLFW_REPEAT) CORE.Input.Keyboard.keyRepeatInFrame[key] = 1;
 
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    // Register key up/down as automation event, key repeats are not recorded
+    if (action == GLFW_RELEASE) RecordAutomationEvent(INPUT_KEY_UP, key, 0, 0);
+    else if (action == GLFW_PRESS) RecordAutomationEvent(INPUT_KEY_DOWN, key, 0, 0);
+#endif
+
     // WARNING: Check if CAPS/NUM key modifiers are enabled and force down state for those keys
     if (((key == KEY_CAPS_LOCK) && ((mods & GLFW_MOD_CAPS_LOCK) > 0)) ||
         ((key == KEY_NUM_LOCK) && ((mods & GLFW_MOD_NUM_LOCK) > 0))) CORE.Input.Keyboard.currentKeyState[key] = 1;
@@ -1841,6 +1862,10 @@ static void MouseButtonCallback(GLFWwindow *window, int button, int action, int
     CORE.Input.Mouse.currentButtonState[button] = action;
     CORE.Input.Touch.currentTouchState[button] = action;
 
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    RecordAutomationEvent((action == GLFW_PRESS)? INPUT_MOUSE_BUTTON_DOWN : INPUT_MOUSE_BUTTON_UP, button, 0, 0);
+#endif
+
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)
     // Process mouse events as touches to be able to use mouse-gestures
     GestureEvent gestureEvent = { 0 };
@@ -1876,6 +1901,10 @@ static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
     CORE.Input.Mouse.currentPosition.y = (float)y;
     CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
 
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    RecordAutomationEvent(INPUT_MOUSE_POSITION, (int)x, (int)y, 0);
+#endif
+
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)
     // Process mouse events as touches to be able to use mouse-gestures
     GestureEvent gestureEvent = { 0 };
@@ -1904,6 +1933,10 @@ static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
 static void MouseScrollCallback(GLFWwindow *window, double xoffset, double yoffset)
 {
     CORE.Input.Mouse.currentWheelMove = (Vector2){ (float)xoffset, (float)yoffset };
+
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    RecordAutomationEvent(INPUT_MOUSE_WHEEL_MOTION, (int)xoffset, (int)yoffset, 0);
+#endif
 }
 
 // GLFW3 CursorEnter Callback, when cursor enters the window
@@ -1924,6 +1957,10 @@ static void JoystickCallback(int jid, int event)
     {
         memset(CORE.Input.Gamepad.name[jid], 0, 64);
     }
+
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    if (jid < MAX_GAMEPADS) RecordAutomationEvent((event == GLFW_CONNECTED)? INPUT_GAMEPAD_CONNECT : INPUT_GAMEPAD_DISCONNECT, jid, 0, 0);
+#endif
 }
 
 #ifdef _WIN32
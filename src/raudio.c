@@ -9,6 +9,11 @@
 *       - Load and unload audio files
 *       - Format wave data (sample rate, size, channels)
 *       - Play/Stop/Pause/Resume loaded audio
+*       - Lock-free mixing: API calls are sent to the audio thread through a commands queue
+*       - Voices pool: only playing buffers are mixed, with priorities, voice stealing and virtual voices
+*       - Float mixing bus processed in blocks, SIMD mixing kernels and volume/pan ramps
+*       - Sounds storage modes: device format, original wave format or QOA compressed (decoded on mixing)
+*       - Music streams decoded ahead of playback by a background thread, N sub-buffers ring
 *
 *   CONFIGURATION:
 *       #define SUPPORT_MODULE_RAUDIO
@@ -183,6 +188,22 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
+#include <math.h>                       // Required for: sqrtf(), powf(), fabsf() [Used in UpdateAudioSpatial()]
+#include <limits.h>                     // Required for: INT_MAX [Used in LoadWave(), LoadMusicStream()]
+
+// SIMD mixing kernels, instruction set selected by compiler target flags
+#if defined(SUPPORT_AUDIO_SIMD_MIXING)
+    #if defined(__AVX__)
+        #define RAUDIO_SIMD_AVX
+        #include <immintrin.h>              // Required for: AVX intrinsics
+    #elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #define RAUDIO_SIMD_SSE
+        #include <xmmintrin.h>              // Required for: SSE intrinsics
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+        #define RAUDIO_SIMD_NEON
+        #include <arm_neon.h>               // Required for: NEON intrinsics
+    #endif
+#endif
 
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
@@ -298,6 +319,47 @@ typedef struct tagBITMAPINFOHEADER {
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
+#ifndef AUDIO_MIX_BLOCK_SIZE
+    #define AUDIO_MIX_BLOCK_SIZE             512    // Mixing block size in frames, also volume/pan ramps length
+#endif
+#ifndef MAX_AUDIO_VOICES
+    #define MAX_AUDIO_VOICES                 128    // Maximum number of voices (playing buffers) in the voices pool
+#endif
+#ifndef MAX_AUDIO_COMMANDS
+    #define MAX_AUDIO_COMMANDS               256    // Audio commands queue size, must be a power of two
+#endif
+#ifndef MAX_AUDIO_STREAM_SUBBUFFERS
+    #define MAX_AUDIO_STREAM_SUBBUFFERS        8    // Maximum number of sub-buffers per audio stream
+#endif
+#ifndef AUDIO_MUSIC_SUBBUFFERS
+    #define AUDIO_MUSIC_SUBBUFFERS             4    // Music streams sub-buffers, decoded ahead of playback by the decoding thread
+#endif
+#ifndef MAX_AUDIO_MUSIC_STREAMS
+    #define MAX_AUDIO_MUSIC_STREAMS           32    // Maximum number of music streams decoded by the decoding thread
+#endif
+#ifndef AUDIO_MUSIC_DECODE_PERIOD
+    #define AUDIO_MUSIC_DECODE_PERIOD          4    // Music decoding thread polling period in milliseconds
+#endif
+#ifndef AUDIO_SPEED_OF_SOUND
+    #define AUDIO_SPEED_OF_SOUND          343.0f    // Speed of sound for spatial audio doppler effect, in world units per second
+#endif
+
+#define AUDIO_STREAM_NO_END           0xFFFFFFFF    // Stream end marker value for streams not ending
+
+// Commands are applied by the caller thread when audio callback is not running concurrently
+// NOTE: On web without audio worklets the audio callback runs on the main thread
+#if defined(__EMSCRIPTEN__) && !defined(MA_ENABLE_AUDIO_WORKLETS)
+    #define AUDIO_COMMANDS_INLINE
+#endif
+
+// Music streams are decoded ahead of playback by a background thread, UpdateMusicStream() is optional
+// NOTE: Requires threads support, not available on web without pthreads
+#if defined(SUPPORT_MUSIC_DECODE_THREAD) && !defined(MA_NO_THREADING) && (!defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__))
+    #define AUDIO_MUSIC_DECODE_THREAD
+    #define MUSIC_STREAM_SUBBUFFERS     AUDIO_MUSIC_SUBBUFFERS
+#else
+    #define MUSIC_STREAM_SUBBUFFERS     2
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -338,6 +400,21 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+// Audio command type, commands are applied on the audio thread
+// NOTE: Buffers list and buffers playback state are only modified on the audio thread
+typedef enum {
+    AUDIO_COMMAND_PLAY = 0,         // Restart buffer playback
+    AUDIO_COMMAND_STOP,             // Stop buffer playback and reset cursor
+    AUDIO_COMMAND_SET_PITCH,        // Set buffer pitch, updates converter rate
+    AUDIO_COMMAND_SET_CALLBACK,     // Set buffer callback
+    AUDIO_COMMAND_TRACK,            // Add buffer to mixing list
+    AUDIO_COMMAND_UNTRACK,          // Remove buffer from mixing list
+    AUDIO_COMMAND_ATTACH_PROCESSOR, // Add processor to buffer (or mixed output if no buffer)
+    AUDIO_COMMAND_DETACH_PROCESSOR, // Remove processors from buffer (or mixed output if no buffer)
+    AUDIO_COMMAND_FLUSH,            // Drop stream pending sub-buffers, keeping playback state
+    AUDIO_COMMAND_QUEUE             // Set buffer to start when stream ends
+} AudioCommandType;
+
 // Audio buffer struct
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
@@ -345,21 +422,55 @@ struct rAudioBuffer {
     AudioCallback callback;         // Audio buffer callback for buffer filling on audio threads
     rAudioProcessor *processor;     // Audio processor
 
-    float volume;                   // Audio buffer volume
-    float pitch;                    // Audio buffer pitch
-    float pan;                      // Audio buffer pan (0.0f to 1.0f)
+    // NOTE: Fields accessed from both threads are read and written atomically
+    float volume;                   // Audio buffer volume (atomic)
+    float pitch;                    // Audio buffer pitch (audio thread)
+    float pan;                      // Audio buffer pan (0.0f to 1.0f) (atomic)
 
-    bool playing;                   // Audio buffer state: AUDIO_PLAYING
-    bool paused;                    // Audio buffer state: AUDIO_PAUSED
+    ma_bool32 playing;              // Audio buffer state: AUDIO_PLAYING (atomic)
+    ma_bool32 paused;               // Audio buffer state: AUDIO_PAUSED (atomic)
+    ma_bool32 starting;             // Audio buffer play requested, not applied by the audio thread yet (atomic)
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
-    bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    ma_bool32 isSubBufferProcessed[MAX_AUDIO_STREAM_SUBBUFFERS];    // Sub-buffers processed, ring of sub-buffers for streams (atomic)
+    unsigned int subBufferCount;    // Number of sub-buffers for streams (default: 2, double buffering)
     unsigned int sizeInFrames;      // Total buffer size in frames
-    unsigned int frameCursorPos;    // Frame cursor position
-    unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
+    ma_uint32 frameCursorPos;       // Frame cursor position (atomic)
+    ma_uint32 framesProcessed;      // Total frames processed in this buffer (required for play timing) (atomic)
+    ma_uint32 streamEnd;            // Stream end marker: last sub-buffer index + valid frames*MAX_AUDIO_STREAM_SUBBUFFERS (atomic)
+    rAudioBuffer *queued;           // Buffer started right after stream end, gapless (audio thread)
+
+    unsigned int musicCursorPos;    // Music decoder position in frames (music decoder lock)
+    unsigned int musicLoopStart;    // Music loop start position in frames (music decoder lock)
+    unsigned int musicLoopEnd;      // Music loop end position in frames, 0 for end of music (music decoder lock)
+    const unsigned char *fileData;  // Music file data read by decoder, NULL if decoder keeps its own copy
+    size_t fileDataSize;            // Music file data size in bytes
+    bool isFileMapped;              // Music file data is memory-mapped, loaded with LoadFileData() otherwise
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
+    void *decoder;                  // Compressed data decoder (QOA), NULL if data is PCM (audio thread)
+
+    ma_int32 priority;              // Voice priority, higher priority voices are mixed first and stolen last (atomic)
+    int voiceIndex;                 // Index in voices pool, -1 if not in pool (audio thread)
+    unsigned int voiceOrder;        // Voice start order, oldest voices are stolen first (audio thread)
+    bool isVirtual;                 // Voice is virtual: cursor advances but it is not mixed (audio thread)
+    float mixLevels[2];             // Current mixing levels (left, right), ramped to volume/pan changes (audio thread)
+    float mixLevelsStep[2];         // Mixing levels increment per frame for current block (audio thread)
+    float mixPitch;                 // Pitch applied to converter, including doppler (audio thread)
+
+    // Spatial audio, position and attenuation are set by API calls, mixing values are computed from listener
+    ma_bool32 isSpatial;            // Buffer is spatial, pan and attenuation are computed from position (atomic)
+    float position[3];              // Spatial position (atomic)
+    float velocity[3];              // Spatial velocity, used for doppler (atomic)
+    ma_int32 attenuation;           // Spatial attenuation model (AudioAttenuation) (atomic)
+    float minDistance;              // Spatial attenuation minimum distance, no attenuation under it (atomic)
+    float maxDistance;              // Spatial attenuation maximum distance, no more attenuation over it (atomic)
+    float rolloff;                  // Spatial attenuation rolloff factor (atomic)
+    float spatialGain;              // Spatial attenuation gain (audio thread)
+    float spatialPan;               // Spatial pan from listener (audio thread)
+    float doppler;                  // Doppler pitch factor (audio thread)
+    bool isResampled;               // Pitch has been changed, data always runs through converter to keep its state (audio thread)
 
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
@@ -375,13 +486,47 @@ struct rAudioProcessor {
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+#if defined(SUPPORT_FILEFORMAT_QOA)
+// Audio buffer QOA decoder, sound data is decoded one QOA frame at a time
+// NOTE: QOA frames are independent, complete frames have a fixed size, so any frame can be decoded
+typedef struct AudioBufferQOA {
+    qoa_desc desc;                  // QOA description, LMS state is updated on frame decoding
+    unsigned int dataSize;          // QOA data size in bytes
+    unsigned int frameSize;         // QOA complete frame size in bytes
+    int frameIndex;                 // Decoded frame index, -1 if no frame decoded
+    short *frame;                   // Decoded frame samples (interleaved channels)
+} AudioBufferQOA;
+#endif
+
+// Audio command, sent from API calls to the audio thread
+typedef struct AudioCommand {
+    int type;                       // Command type (AudioCommandType)
+    AudioBuffer *buffer;            // Target audio buffer
+    rAudioProcessor *processor;     // Processor to attach
+    AudioCallback callback;         // Callback to set or processor function to detach
+    AudioBuffer *queued;            // Buffer to start when target stream ends
+    float value;                    // Command value
+} AudioCommand;
+
+// Audio command overflowing commands queue, linked until audio thread applies it
+typedef struct AudioCommandNode {
+    AudioCommand command;           // Command
+    struct AudioCommandNode *next;  // Next node (previously pushed)
+} AudioCommandNode;
+
+// Sounds batch, shared by sound loading jobs
+typedef struct SoundBatch {
+    const char **fileNames;         // Sound files to load
+    Sound *sounds;                  // Loaded sounds, one per file
+} SoundBatch;
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
         bool isReady;               // Check if audio device is ready
+        bool isOffline;             // Audio mixer running without device, rendered with RenderAudioFrames()
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
     } System;
@@ -389,7 +534,54 @@ typedef struct AudioData {
         AudioBuffer *first;         // Pointer to first AudioBuffer in the list
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
+        int soundStorage;           // Default storage mode for new sounds (SoundStorage)
     } Buffer;
+    struct {
+        AudioBuffer *pool[MAX_AUDIO_VOICES];    // Voices playing, only these buffers are processed by the mixer (audio thread)
+        int count;                  // Number of voices in pool (audio thread)
+        ma_int32 maxMixed;          // Maximum number of voices mixed, rest are virtual (atomic)
+        unsigned int order;         // Voices start counter (audio thread)
+    } Voice;
+    struct {
+        float position[3];          // Listener position (atomic)
+        float forward[3];           // Listener forward direction (atomic)
+        float up[3];                // Listener up direction (atomic)
+        float velocity[3];          // Listener velocity, used for doppler (atomic)
+    } Listener;
+    struct {
+        AudioBuffer *voices[MAX_AUDIO_VOICES];  // Spatial voices processed on current callback (audio thread)
+        float x[MAX_AUDIO_VOICES + 4];          // Voices positions in listener space, padded for SIMD (audio thread)
+        float y[MAX_AUDIO_VOICES + 4];
+        float z[MAX_AUDIO_VOICES + 4];
+        float sourceSpeed[MAX_AUDIO_VOICES + 4];    // Voices velocities projected on listener direction, scaled by distance (audio thread)
+        float listenerSpeed[MAX_AUDIO_VOICES + 4];  // Listener velocity projected on voices direction, scaled by distance (audio thread)
+        float distance[MAX_AUDIO_VOICES + 4];   // Voices distances to listener (audio thread)
+        float pan[MAX_AUDIO_VOICES + 4];        // Voices pan from listener (audio thread)
+        float doppler[MAX_AUDIO_VOICES + 4];    // Voices doppler pitch factor (audio thread)
+    } Spatial;
+    struct {
+        AudioCommand queue[MAX_AUDIO_COMMANDS]; // Commands ring buffer, lock-free multiple producers, single consumer (audio thread)
+        ma_uint32 sequence[MAX_AUDIO_COMMANDS]; // Commands written marker: command index + 1 once written (atomic)
+        ma_uint32 writeIndex;       // Next command to write (atomic)
+        ma_uint32 readIndex;        // Next command to read (atomic)
+        ma_spinlock lock;           // Consumer lock, only taken to apply commands when no audio thread is running
+        AudioCommandNode *overflow; // Commands pushed while queue is full, latest first (atomic)
+        rAudioProcessor *detached;  // Processors detached on the audio thread, freed by the API caller (atomic)
+    } Command;
+    struct {
+        float bus[AUDIO_MIX_BLOCK_SIZE*AUDIO_DEVICE_CHANNELS];  // Float mixing bus, used when device format is not float (audio thread)
+        float frames[AUDIO_MIX_BLOCK_SIZE*AUDIO_DEVICE_CHANNELS];   // Converted voice frames to be mixed (audio thread)
+    } Mixer;
+#if defined(AUDIO_MUSIC_DECODE_THREAD)
+    struct {
+        ma_thread thread;           // Music decoding thread
+        ma_mutex lock;              // Music decoders lock, shared by decoding thread and API calls (never taken by the audio thread)
+        ma_bool32 running;          // Decoding thread running state (atomic)
+        Music streams[MAX_AUDIO_MUSIC_STREAMS]; // Music streams decoded by the thread, updated on API calls
+        bool queued[MAX_AUDIO_MUSIC_STREAMS];   // Music stream queued after another one, decoded ahead while stopped
+        int count;                  // Number of music streams decoded by the thread
+    } Decoder;
+#endif
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
@@ -403,6 +595,10 @@ static AudioData AUDIO = {          // Global AUDIO context
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, just increase this number
     .Buffer.defaultSize = 0,
+    .Buffer.soundStorage = SOUND_STORAGE_DEVICE,
+    .Voice.maxMixed = MAX_AUDIO_VOICES,
+    .Listener.forward = { 0.0f, 0.0f, -1.0f },
+    .Listener.up = { 0.0f, 1.0f, 0.0f },
     .mixedProcessor = NULL
 };
 
@@ -412,15 +608,55 @@ static AudioData AUDIO = {          // Global AUDIO context
 static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage);
 
 // Reads audio data from an AudioBuffer object in internal/device formats
-static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount);
+// NOTE: Internal format frames can be mixed directly into framesOut, when no conversion is required
+static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount, bool mix);
 static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);
 
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
+#if defined(SUPPORT_FILEFORMAT_QOA)
+static AudioBufferQOA *LoadAudioBufferQOA(qoa_desc desc, unsigned int dataSize);   // Load QOA decoder for audio buffer data
+static const unsigned char *DecodeAudioBufferQOA(AudioBuffer *buffer, ma_uint32 frameCursorPos, ma_uint32 *frameCount); // Decode audio buffer QOA frames at cursor
+#endif
+static void MixAudioBuffer(AudioBuffer *buffer, float *framesOut, ma_uint32 frameCount);    // Mix audio buffer block into mixing bus
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
+static bool IsAudioBufferMixedDirectly(AudioBuffer *buffer);   // Check if audio buffer data can be mixed directly, without conversion
+
+static bool WriteAudioCommand(AudioCommand command, ma_uint32 *index); // Write command to commands queue, returns false if queue is full
+static bool PushAudioCommand(AudioCommand command);         // Push command to audio thread, returns false on memory allocation failure
+static void SendAudioCommand(AudioCommand command);         // Push command and wait for it to be applied on the audio thread
+static void ApplyAudioCommands(void);                       // Apply queued commands on calling thread, no audio thread running
+static void ProcessAudioCommands(void);                     // Apply queued commands (audio thread)
+static void ExecuteAudioCommand(AudioCommand *command);     // Apply one command (audio thread)
+static bool IsAudioMixerRunning(void);                      // Check if audio thread is mixing concurrently
+static bool PlayAudioBufferInMixer(AudioBuffer *buffer);    // Start an audio buffer from the beginning, returns false if no voice available (audio thread)
+static AudioBuffer *LoadAudioBufferUntracked(ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 sizeInFrames, int usage); // Load audio buffer, not tracked by mixer yet
+static Sound LoadSoundFromWaveUntracked(Wave wave);         // Load sound from wave data, buffer not tracked by mixer yet
+static void LoadSoundJob(void *data, int index);            // Load one sound of a sounds batch (parallel job)
+static void StopAudioBufferInMixer(AudioBuffer *buffer);    // Stop an audio buffer and reset its state (audio thread)
+static void SetAudioBufferPitchInMixer(AudioBuffer *buffer, float pitch);  // Set audio buffer converter rate for pitch, including doppler (audio thread)
+static float GetAudioBufferMixVolume(const AudioBuffer *buffer);    // Get audio buffer volume including spatial attenuation
+static void UpdateAudioSpatial(void);                       // Compute spatial voices attenuation, pan and doppler from listener (audio thread)
+
+static AudioStream LoadAudioStreamBuffers(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels, unsigned int subBufferCount); // Load audio stream with a ring of sub-buffers
+static void UpdateAudioStreamFrames(AudioStream stream, const void *data, int frameCount, bool isLast); // Update audio stream sub-buffer, latest frames mark stream end
+static bool DecodeMusicStream(Music music);                 // Decode music frames into processed stream sub-buffers, returns false on stream end
+static unsigned int ReadMusicFrames(Music music, void *frames, unsigned int frameCount);    // Read music frames at decoder position, returns frames read
+static void SeekMusicDecoder(Music music, unsigned int position);  // Seek music decoder to a frame position
+static void LockMusicDecoder(void);                         // Lock music decoders, shared with the decoding thread
+static void UnlockMusicDecoder(void);                       // Unlock music decoders
+#if defined(AUDIO_MUSIC_DECODE_THREAD)
+static int GetMusicDecodeIndex(AudioBuffer *buffer);        // Get music stream index in decoding thread list, -1 if not found
+static void AddMusicDecode(Music music, bool queued);       // Add music stream to decoding thread list, or refresh it
+static void RemoveMusicDecode(int index);                   // Remove music stream from decoding thread list
+static void DecodeMusicStreams(void);                        // Decode music streams in decoding thread list, music decoder must be locked
+static ma_thread_result MA_THREADCALL MusicDecodeThread(void *data);    // Music decoding thread
+#endif
 
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
-static void StopAudioBufferInLockedState(AudioBuffer *buffer);
-static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount);
+static bool AddAudioVoice(AudioBuffer *buffer);             // Add buffer to voices pool, stealing a voice if required (audio thread)
+static void RemoveAudioVoice(AudioBuffer *buffer);          // Remove buffer from voices pool (audio thread)
+static int CompareAudioVoices(const AudioBuffer *a, const AudioBuffer *b); // Compare voices importance for mixing and stealing
+static void UpdateAudioVoices(void);                        // Select virtual voices, beyond max mixed count or inaudible (audio thread)
+static void AdvanceAudioVoice(AudioBuffer *buffer, ma_uint32 frameCount);  // Advance virtual voice cursor without mixing (audio thread)
 
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
@@ -431,6 +667,8 @@ static const char *GetFileNameWithoutExt(const char *filePath);     // Get filen
 static unsigned char *LoadFileData(const char *fileName, int *dataSize);    // Load file data as byte array (read)
 static bool SaveFileData(const char *fileName, void *data, int dataSize);   // Save data to file from byte array (write)
 static bool SaveFileText(const char *fileName, char *text);         // Save text data to file (write), string must be '\0' terminated
+static const unsigned char *MapFileData(const char *fileName, size_t *dataSize);   // Map file data read-only into memory (not available, returns NULL)
+static void UnmapFileData(const unsigned char *data, size_t dataSize);            // Unmap file data
 #endif
 
 //----------------------------------------------------------------------------------
@@ -448,6 +686,9 @@ void ResumeAudioBuffer(AudioBuffer *buffer);
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume);
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch);
 void SetAudioBufferPan(AudioBuffer *buffer, float pan);
+void SetAudioBufferPriority(AudioBuffer *buffer, int priority);
+void SetAudioBufferPosition(AudioBuffer *buffer, Vector3 position, Vector3 velocity);
+void SetAudioBufferAttenuation(AudioBuffer *buffer, int model, float minDistance, float maxDistance, float rolloff);
 void TrackAudioBuffer(AudioBuffer *buffer);
 void UntrackAudioBuffer(AudioBuffer *buffer);
 
@@ -490,15 +731,8 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Mixing happens on a separate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary
-    if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
-    {
-        TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
-        ma_device_uninit(&AUDIO.System.device);
-        ma_context_uninit(&AUDIO.System.context);
-        return;
-    }
+    // Mixing happens on a separate thread, API calls do not share any lock with it,
+    // changes are sent through a commands queue applied at the start of every audio callback
 
     // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
     // while there's at least one sound being played
@@ -519,6 +753,56 @@ void InitAudioDevice(void)
     TRACELOG(LOG_INFO, "    > Periods size:  %d", AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO.System.device.playback.internalPeriods);
 
     AUDIO.System.isReady = true;
+
+#if defined(AUDIO_MUSIC_DECODE_THREAD)
+    // Start music decoding thread, music streams are decoded ahead of playback
+    if (ma_mutex_init(&AUDIO.Decoder.lock) == MA_SUCCESS)
+    {
+        ma_atomic_store_32(&AUDIO.Decoder.running, MA_TRUE);
+
+        if (ma_thread_create(&AUDIO.Decoder.thread, ma_thread_priority_normal, 0, MusicDecodeThread, NULL, NULL) != MA_SUCCESS)
+        {
+            ma_atomic_store_32(&AUDIO.Decoder.running, MA_FALSE);
+            ma_mutex_uninit(&AUDIO.Decoder.lock);
+        }
+    }
+
+    if (!ma_atomic_load_32(&AUDIO.Decoder.running)) TRACELOG(LOG_WARNING, "AUDIO: Failed to start music decoding thread, UpdateMusicStream() required");
+#endif
+}
+
+// Initialize audio mixer without device (offline), audio is rendered on demand with RenderAudioFrames()
+// NOTE: No audio backend is required, i.e. headless testing or video export faster than real time
+void InitAudioDeviceOffline(unsigned int sampleRate)
+{
+    if (AUDIO.System.isReady)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Device already initialized");
+        return;
+    }
+
+    // Mixer output is defined by device data, no device is initialized or started,
+    // API commands are applied right away on the calling thread
+    memset(&AUDIO.System.device, 0, sizeof(ma_device));
+    AUDIO.System.device.sampleRate = (sampleRate > 0)? sampleRate : 48000;
+    AUDIO.System.device.playback.format = ma_format_f32;
+    AUDIO.System.device.playback.channels = AUDIO_DEVICE_CHANNELS;
+    AUDIO.System.device.playback.internalFormat = ma_format_f32;
+    AUDIO.System.device.playback.internalChannels = AUDIO_DEVICE_CHANNELS;
+    AUDIO.System.device.playback.internalSampleRate = AUDIO.System.device.sampleRate;
+    AUDIO.System.device.playback.internalPeriodSizeInFrames = AUDIO_MIX_BLOCK_SIZE;
+    AUDIO.System.device.playback.internalPeriods = 1;
+    ma_device_set_master_volume(&AUDIO.System.device, 1.0f);
+
+    AUDIO.System.isOffline = true;
+    AUDIO.System.isReady = true;
+
+#if defined(AUDIO_MUSIC_DECODE_THREAD)
+    // Music streams are decoded by RenderAudioFrames() before mixing, no decoding thread is started
+    if (ma_mutex_init(&AUDIO.Decoder.lock) == MA_SUCCESS) ma_atomic_store_32(&AUDIO.Decoder.running, MA_TRUE);
+#endif
+
+    TRACELOG(LOG_INFO, "AUDIO: Offline mixer initialized successfully (%i Hz, %i channels)", AUDIO.System.device.sampleRate, AUDIO_DEVICE_CHANNELS);
 }
 
 // Close the audio device for all contexts
@@ -526,11 +810,27 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
-        ma_device_uninit(&AUDIO.System.device);
-        ma_context_uninit(&AUDIO.System.context);
+#if defined(AUDIO_MUSIC_DECODE_THREAD)
+        if (ma_atomic_load_32(&AUDIO.Decoder.running))
+        {
+            ma_atomic_store_32(&AUDIO.Decoder.running, MA_FALSE);
+            if (!AUDIO.System.isOffline) ma_thread_wait(&AUDIO.Decoder.thread);
+            ma_mutex_uninit(&AUDIO.Decoder.lock);
+            AUDIO.Decoder.count = 0;
+        }
+#endif
+
+        if (!AUDIO.System.isOffline)
+        {
+            ma_device_uninit(&AUDIO.System.device);
+            ma_context_uninit(&AUDIO.System.context);
+        }
 
         AUDIO.System.isReady = false;
+        AUDIO.System.isOffline = false;
+
+        // Apply pending commands, no audio thread running anymore
+        ApplyAudioCommands();
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
         AUDIO.System.pcmBufferSize = 0;
@@ -560,12 +860,94 @@ float GetMasterVolume(void)
     return volume;
 }
 
+// Set maximum number of voices mixed at the same time
+// NOTE: Voices beyond this count (lower priority, quieter, older) are virtual:
+// they keep advancing but they are not decoded or mixed, audio streams are always mixed
+void SetAudioMaxVoices(int count)
+{
+    if (count < 0) count = 0;
+    else if (count > MAX_AUDIO_VOICES) count = MAX_AUDIO_VOICES;
+
+    ma_atomic_store_i32(&AUDIO.Voice.maxMixed, count);
+}
+
+// Set 3D audio listener, for spatial sounds and music
+// NOTE: Directions do not need to be normalized, velocity is used for doppler effect,
+// in world units per second, same as spatial sounds velocity and AUDIO_SPEED_OF_SOUND
+void SetAudioListener(Vector3 position, Vector3 forward, Vector3 up, Vector3 velocity)
+{
+    const float values[4][3] = {
+        { position.x, position.y, position.z },
+        { forward.x, forward.y, forward.z },
+        { up.x, up.y, up.z },
+        { velocity.x, velocity.y, velocity.z }
+    };
+
+    for (int i = 0; i < 3; i++)
+    {
+        ma_atomic_store_f32(&AUDIO.Listener.position[i], values[0][i]);
+        ma_atomic_store_f32(&AUDIO.Listener.forward[i], values[1][i]);
+        ma_atomic_store_f32(&AUDIO.Listener.up[i], values[2][i]);
+        ma_atomic_store_f32(&AUDIO.Listener.velocity[i], values[3][i]);
+    }
+}
+
+// Render mixed audio frames (offline mode)
+// NOTE: Frames are interleaved float samples, AUDIO_DEVICE_CHANNELS per frame, clipped to [-1..1],
+// rendering is deterministic: music streams are decoded ahead of every mixing block, as required
+// for a fixed time step capture, i.e. sampleRate/fps frames rendered on every captured video frame
+void RenderAudioFrames(float *frames, int frameCount)
+{
+    if (!AUDIO.System.isOffline)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Audio frames can only be rendered in offline mode");
+        return;
+    }
+
+    if ((frames == NULL) || (frameCount <= 0)) return;
+
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    float volume = 1.0f;
+    ma_device_get_master_volume(&AUDIO.System.device, &volume);
+
+    for (int frame = 0; frame < frameCount; frame += AUDIO_MIX_BLOCK_SIZE)
+    {
+        ma_uint32 blockFrameCount = frameCount - frame;
+        if (blockFrameCount > AUDIO_MIX_BLOCK_SIZE) blockFrameCount = AUDIO_MIX_BLOCK_SIZE;
+
+        float *blockFrames = frames + frame*channels;
+
+#if defined(AUDIO_MUSIC_DECODE_THREAD)
+        LockMusicDecoder();
+        DecodeMusicStreams();
+        UnlockMusicDecoder();
+#endif
+        OnSendAudioDataToDevice(&AUDIO.System.device, blockFrames, NULL, blockFrameCount);
+
+        // Device post-processing, usually applied by miniaudio
+        if (volume != 1.0f) ma_apply_volume_factor_f32(blockFrames, blockFrameCount*channels, volume);
+        ma_clip_samples_f32(blockFrames, blockFrames, blockFrameCount*channels);
+    }
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
 
 // Initialize a new audio buffer (filled with silence)
 AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 sizeInFrames, int usage)
+{
+    AudioBuffer *audioBuffer = LoadAudioBufferUntracked(format, channels, sampleRate, sizeInFrames, usage);
+
+    // Track audio buffer to linked list next position
+    if (audioBuffer != NULL) TrackAudioBuffer(audioBuffer);
+
+    return audioBuffer;
+}
+
+// Load audio buffer, not tracked by the mixer
+// NOTE: It does not access the mixer state, it can be called from any thread
+static AudioBuffer *LoadAudioBufferUntracked(ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 sizeInFrames, int usage)
 {
     AudioBuffer *audioBuffer = (AudioBuffer *)RL_CALLOC(1, sizeof(AudioBuffer));
 
@@ -577,8 +959,8 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 
     if (sizeInFrames > 0) audioBuffer->data = RL_CALLOC(sizeInFrames*channels*ma_get_bytes_per_sample(format), 1);
 
-    // Audio data runs through a format converter
-    ma_data_converter_config converterConfig = ma_data_converter_config_init(format, AUDIO_DEVICE_FORMAT, channels, AUDIO_DEVICE_CHANNELS, sampleRate, AUDIO.System.device.sampleRate);
+    // Audio data runs through a format converter, output is the mixing format (float-32bit)
+    ma_data_converter_config converterConfig = ma_data_converter_config_init(format, ma_format_f32, channels, AUDIO_DEVICE_CHANNELS, sampleRate, AUDIO.System.device.sampleRate);
     converterConfig.allowDynamicSampleRate = true;
 
     ma_result result = ma_data_converter_init(&converterConfig, NULL, &audioBuffer->converter);
@@ -597,6 +979,21 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 
     audioBuffer->callback = NULL;
     audioBuffer->processor = NULL;
+    audioBuffer->decoder = NULL;
+
+    audioBuffer->priority = 0;
+    audioBuffer->voiceIndex = -1;
+    audioBuffer->isResampled = false;
+    audioBuffer->mixPitch = 1.0f;
+
+    audioBuffer->isSpatial = false;
+    audioBuffer->attenuation = AUDIO_ATTENUATION_INVERSE;
+    audioBuffer->minDistance = 1.0f;
+    audioBuffer->maxDistance = 10000.0f;
+    audioBuffer->rolloff = 1.0f;
+    audioBuffer->spatialGain = 1.0f;
+    audioBuffer->spatialPan = 0.5f;
+    audioBuffer->doppler = 1.0f;
 
     audioBuffer->playing = false;
     audioBuffer->paused = false;
@@ -605,37 +1002,42 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->usage = usage;
     audioBuffer->frameCursorPos = 0;
     audioBuffer->sizeInFrames = sizeInFrames;
+    audioBuffer->streamEnd = AUDIO_STREAM_NO_END;
+    audioBuffer->queued = NULL;
+
+    audioBuffer->musicCursorPos = 0;
+    audioBuffer->musicLoopStart = 0;
+    audioBuffer->musicLoopEnd = 0;
 
     // Buffers should be marked as processed by default so that a call to
     // UpdateAudioStream() immediately after initialization works correctly
-    audioBuffer->isSubBufferProcessed[0] = true;
-    audioBuffer->isSubBufferProcessed[1] = true;
-
-    // Track audio buffer to linked list next position
-    TrackAudioBuffer(audioBuffer);
+    audioBuffer->subBufferCount = 2;
+    for (int i = 0; i < MAX_AUDIO_STREAM_SUBBUFFERS; i++) audioBuffer->isSubBufferProcessed[i] = true;
 
     return audioBuffer;
 }
 
 // Delete an audio buffer
+// NOTE: Waits for the audio thread to remove the buffer from the mixing list
 void UnloadAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
         UntrackAudioBuffer(buffer);
         ma_data_converter_uninit(&buffer->converter, NULL);
+        RL_FREE(buffer->decoder);
         RL_FREE(buffer->data);
         RL_FREE(buffer);
     }
 }
 
-// Check if an audio buffer is playing from a program state without lock
+// Check if an audio buffer is playing
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = IsAudioBufferPlayingInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+
+    if (buffer != NULL) result = (ma_atomic_load_32(&buffer->starting) || (ma_atomic_load_32(&buffer->playing) && !ma_atomic_load_32(&buffer->paused)));
+
     return result;
 }
 
@@ -646,70 +1048,57 @@ void PlayAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->playing = true;
-        buffer->paused = false;
-        buffer->frameCursorPos = 0;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        // Playing state is published by the audio thread along with the cursor reset,
+        // mixer never plays a restarted buffer from its previous cursor
+        ma_atomic_store_32(&buffer->starting, MA_TRUE);
+
+        if (!PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PLAY, .buffer = buffer })) ma_atomic_store_32(&buffer->starting, MA_FALSE);
     }
 }
 
-// Stop an audio buffer from a program state without lock
+// Stop an audio buffer
+// NOTE: Stream sub-buffers are released by the audio thread, they can be refilled once processed
 void StopAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    StopAudioBufferInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (IsAudioBufferPlaying(buffer))
+    {
+        ma_atomic_store_32(&buffer->starting, MA_FALSE);
+        ma_atomic_store_32(&buffer->playing, MA_FALSE);
+
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_STOP, .buffer = buffer });
+    }
 }
 
 // Pause an audio buffer
+// NOTE: Pausing a buffer not started yet by the audio thread is kept once started
 void PauseAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = true;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        ma_atomic_store_32(&buffer->paused, MA_TRUE);
+        ma_atomic_store_32(&buffer->starting, MA_FALSE);
     }
 }
 
 // Resume an audio buffer
 void ResumeAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = false;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) ma_atomic_store_32(&buffer->paused, MA_FALSE);
 }
 
 // Set volume for an audio buffer
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->volume = volume;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) ma_atomic_store_f32(&buffer->volume, volume);
 }
 
 // Set pitch for an audio buffer
+// NOTE: Data converter is only used by the audio thread, rate is updated there
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
     if ((buffer != NULL) && (pitch > 0.0f))
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        // Pitching is just an adjustment of the sample rate
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
-        buffer->pitch = pitch;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_SET_PITCH, .buffer = buffer, .value = pitch });
     }
 }
 
@@ -721,44 +1110,61 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
 
     if (buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->pan = pan;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        ma_atomic_store_f32(&buffer->pan, pan);
+        ma_atomic_store_32(&buffer->isSpatial, MA_FALSE);   // Explicit pan makes buffer non-spatial again
     }
 }
 
-// Track audio buffer to linked list next position
-void TrackAudioBuffer(AudioBuffer *buffer)
+// Set priority for an audio buffer, higher priority voices are mixed first and stolen last
+void SetAudioBufferPriority(AudioBuffer *buffer, int priority)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
+    if (buffer != NULL) ma_atomic_store_i32(&buffer->priority, priority);
+}
 
-        AUDIO.Buffer.last = buffer;
+// Set 3D position and velocity for an audio buffer, buffer becomes spatial
+// NOTE: Attenuation, pan and doppler are computed on the audio thread from listener
+void SetAudioBufferPosition(AudioBuffer *buffer, Vector3 position, Vector3 velocity)
+{
+    if (buffer != NULL)
+    {
+        ma_atomic_store_f32(&buffer->position[0], position.x);
+        ma_atomic_store_f32(&buffer->position[1], position.y);
+        ma_atomic_store_f32(&buffer->position[2], position.z);
+        ma_atomic_store_f32(&buffer->velocity[0], velocity.x);
+        ma_atomic_store_f32(&buffer->velocity[1], velocity.y);
+        ma_atomic_store_f32(&buffer->velocity[2], velocity.z);
+        ma_atomic_store_32(&buffer->isSpatial, MA_TRUE);
     }
-    ma_mutex_unlock(&AUDIO.System.lock);
 }
 
-// Untrack audio buffer from linked list
-void UntrackAudioBuffer(AudioBuffer *buffer)
+// Set distance attenuation for an audio buffer
+void SetAudioBufferAttenuation(AudioBuffer *buffer, int model, float minDistance, float maxDistance, float rolloff)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    if ((model < AUDIO_ATTENUATION_NONE) || (model > AUDIO_ATTENUATION_EXPONENTIAL)) model = AUDIO_ATTENUATION_INVERSE;
+    if (minDistance <= 0.0f) minDistance = 0.0001f;
+    if (maxDistance < minDistance) maxDistance = minDistance;
+    if (rolloff < 0.0f) rolloff = 0.0f;
+
+    if (buffer != NULL)
     {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
+        ma_atomic_store_i32(&buffer->attenuation, model);
+        ma_atomic_store_f32(&buffer->minDistance, minDistance);
+        ma_atomic_store_f32(&buffer->maxDistance, maxDistance);
+        ma_atomic_store_f32(&buffer->rolloff, rolloff);
+    }
+}
 
-        if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
-        else buffer->next->prev = buffer->prev;
+// Track audio buffer to linked list next position
+void TrackAudioBuffer(AudioBuffer *buffer)
+{
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_TRACK, .buffer = buffer });
+}
 
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+// Untrack audio buffer from linked list
+// NOTE: Waits for the audio thread to apply it, buffer can be freed after this call
+void UntrackAudioBuffer(AudioBuffer *buffer)
+{
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_UNTRACK, .buffer = buffer });
 }
 
 //----------------------------------------------------------------------------------
@@ -770,14 +1176,24 @@ Wave LoadWave(const char *fileName)
 {
     Wave wave = { 0 };
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // Decoding directly from memory-mapped file, if available, avoids copying file data
+    size_t mappedSize = 0;
+    const unsigned char *mappedData = MapFileData(fileName, &mappedSize);
+
+    if ((mappedData != NULL) && (mappedSize <= INT_MAX)) wave = LoadWaveFromMemory(GetFileExtension(fileName), mappedData, (int)mappedSize);
+    else
+    {
+        // Loading file to memory
+        int dataSize = 0;
+        unsigned char *fileData = LoadFileData(fileName, &dataSize);
 
-    // Loading wave from memory data
-    if (fileData != NULL) wave = LoadWaveFromMemory(GetFileExtension(fileName), fileData, dataSize);
+        // Loading wave from memory data
+        if (fileData != NULL) wave = LoadWaveFromMemory(GetFileExtension(fileName), fileData, dataSize);
+
+        UnloadFileData(fileData);
+    }
 
-    UnloadFileData(fileData);
+    UnmapFileData(mappedData, mappedSize);
 
     return wave;
 }
@@ -919,9 +1335,66 @@ Sound LoadSound(const char *fileName)
     return sound;
 }
 
+// Load sounds from files, files are decoded and converted in parallel
+// NOTE: Returned array contains count sounds, sounds failing to load are not valid,
+// sound buffers are tracked by the mixer at once when all of them are loaded
+Sound *LoadSounds(const char **fileNames, int count)
+{
+    if ((fileNames == NULL) || (count <= 0)) return NULL;
+
+    Sound *sounds = (Sound *)RL_CALLOC(count, sizeof(Sound));
+    if (sounds == NULL) return NULL;
+
+    SoundBatch batch = { fileNames, sounds };
+
+#if defined(RAUDIO_STANDALONE)
+    for (int i = 0; i < count; i++) LoadSoundJob(&batch, i);
+#else
+    RunParallelJobs(LoadSoundJob, &batch, count);
+#endif
+
+    // Link loaded buffers, the whole chain is tracked with a single command
+    AudioBuffer *first = NULL;
+    AudioBuffer *last = NULL;
+    int loadedCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        AudioBuffer *buffer = sounds[i].stream.buffer;
+        if (buffer == NULL) continue;
+
+        if (first == NULL) first = buffer;
+        else
+        {
+            last->next = buffer;
+            buffer->prev = last;
+        }
+
+        last = buffer;
+        loadedCount++;
+    }
+
+    if (first != NULL) TrackAudioBuffer(first);
+
+    TRACELOG(LOG_INFO, "SOUND: Sounds loaded successfully (%i/%i)", loadedCount, count);
+
+    return sounds;
+}
+
 // Load sound from wave data
 // NOTE: Wave data must be unallocated manually
 Sound LoadSoundFromWave(Wave wave)
+{
+    Sound sound = LoadSoundFromWaveUntracked(wave);
+
+    if (sound.stream.buffer != NULL) TrackAudioBuffer(sound.stream.buffer);
+
+    return sound;
+}
+
+// Load sound from wave data, sound buffer is not tracked by the mixer
+// NOTE: It does not access the mixer state, it can be called from any thread
+static Sound LoadSoundFromWaveUntracked(Wave wave)
 {
     Sound sound = { 0 };
 
@@ -934,34 +1407,119 @@ Sound LoadSoundFromWave(Wave wave)
         //   1) Convert the whole sound in one go at load time (here)
         //   2) Convert the audio data in chunks at mixing time
         //
-        // First option has been selected, format conversion is done on the loading stage
-        // The downside is that it uses more memory if the original sound is u8 or s16
+        // Sound storage mode selects the option: SOUND_STORAGE_DEVICE (default) converts at load time,
+        // it uses more memory if the original sound is u8 or s16, mono or lower sample rate but it is
+        // mixed directly. SOUND_STORAGE_ORIGINAL and SOUND_STORAGE_QOA convert (and decode) data
+        // per mixing block through the buffer data converter
         ma_format formatIn = ((wave.sampleSize == 8)? ma_format_u8 : ((wave.sampleSize == 16)? ma_format_s16 : ma_format_f32));
         ma_uint32 frameCountIn = wave.frameCount;
+        AudioBuffer *audioBuffer = NULL;
 
-        ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
-        if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed to get frame count for format conversion");
+        int storage = AUDIO.Buffer.soundStorage;
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        if ((storage == SOUND_STORAGE_QOA) && (wave.channels > QOA_MAX_CHANNELS)) storage = SOUND_STORAGE_ORIGINAL;
+#endif
 
-        AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, frameCount, AUDIO_BUFFER_USAGE_STATIC);
-        if (audioBuffer == NULL)
+        if (storage == SOUND_STORAGE_DEVICE)
         {
-            TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
-            return sound; // early return to avoid dereferencing the audioBuffer null pointer
+            ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+            if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed to get frame count for format conversion");
+
+            audioBuffer = LoadAudioBufferUntracked(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, frameCount, AUDIO_BUFFER_USAGE_STATIC);
+            if (audioBuffer == NULL)
+            {
+                TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+                return sound; // early return to avoid dereferencing the audioBuffer null pointer
+            }
+
+            frameCount = (ma_uint32)ma_convert_frames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+            if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed format conversion");
+
+            sound.frameCount = frameCount;
+            sound.stream.sampleRate = AUDIO.System.device.sampleRate;
+            sound.stream.sampleSize = 32;
+            sound.stream.channels = AUDIO_DEVICE_CHANNELS;
+        }
+        else if (storage == SOUND_STORAGE_ORIGINAL)
+        {
+            audioBuffer = LoadAudioBufferUntracked(formatIn, wave.channels, wave.sampleRate, frameCountIn, AUDIO_BUFFER_USAGE_STATIC);
+            if (audioBuffer == NULL)
+            {
+                TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+                return sound;
+            }
+
+            memcpy(audioBuffer->data, wave.data, frameCountIn*ma_get_bytes_per_frame(formatIn, wave.channels));
+
+            sound.frameCount = frameCountIn;
+            sound.stream.sampleRate = wave.sampleRate;
+            sound.stream.sampleSize = wave.sampleSize;
+            sound.stream.channels = wave.channels;
         }
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        else if (storage == SOUND_STORAGE_QOA)
+        {
+            // QOA encoder requires 16bit samples
+            Wave wave16 = wave;
+            if (wave.sampleSize != 16)
+            {
+                wave16 = WaveCopy(wave);
+                WaveFormat(&wave16, wave16.sampleRate, 16, wave16.channels);
+            }
+
+            qoa_desc qoa = { 0 };
+            qoa.channels = wave16.channels;
+            qoa.samplerate = wave16.sampleRate;
+            qoa.samples = wave16.frameCount;
 
-        frameCount = (ma_uint32)ma_convert_frames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
-        if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed format conversion");
+            unsigned int dataSize = 0;
+            unsigned char *data = (unsigned char *)qoa_encode((const short *)wave16.data, &qoa, &dataSize);
+
+            if (wave16.data != wave.data) UnloadWave(wave16);
+
+            if (data == NULL)
+            {
+                TRACELOG(LOG_WARNING, "SOUND: Failed to compress sound data (QOA)");
+                return sound;
+            }
+
+            audioBuffer = LoadAudioBufferUntracked(ma_format_s16, qoa.channels, qoa.samplerate, 0, AUDIO_BUFFER_USAGE_STATIC);
+            if (audioBuffer == NULL)
+            {
+                TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+                RL_FREE(data);
+                return sound;
+            }
+
+            audioBuffer->data = data;
+            audioBuffer->sizeInFrames = qoa.samples;
+            audioBuffer->decoder = LoadAudioBufferQOA(qoa, dataSize);
+
+            TRACELOG(LOG_INFO, "SOUND: Data compressed (QOA): %u bytes, %.1f%% of original data size", dataSize, 100.0f*dataSize/(frameCountIn*ma_get_bytes_per_frame(formatIn, wave.channels)));
+
+            sound.frameCount = qoa.samples;
+            sound.stream.sampleRate = qoa.samplerate;
+            sound.stream.sampleSize = 16;
+            sound.stream.channels = qoa.channels;
+        }
+#endif
 
-        sound.frameCount = frameCount;
-        sound.stream.sampleRate = AUDIO.System.device.sampleRate;
-        sound.stream.sampleSize = 32;
-        sound.stream.channels = AUDIO_DEVICE_CHANNELS;
         sound.stream.buffer = audioBuffer;
     }
 
     return sound;
 }
 
+// Load one sound of a sounds batch, called from worker threads
+static void LoadSoundJob(void *data, int index)
+{
+    SoundBatch *batch = (SoundBatch *)data;
+
+    Wave wave = LoadWave(batch->fileNames[index]);
+    batch->sounds[index] = LoadSoundFromWaveUntracked(wave);
+    UnloadWave(wave);
+}
+
 // Clone sound from existing sound data, clone does not own wave data
 // NOTE: Wave data must be unallocated manually and will be shared across all clones
 Sound LoadSoundAlias(Sound source)
@@ -970,7 +1528,8 @@ Sound LoadSoundAlias(Sound source)
 
     if (source.stream.buffer->data != NULL)
     {
-        AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+        AudioBuffer *sourceBuffer = source.stream.buffer;
+        AudioBuffer *audioBuffer = LoadAudioBuffer(sourceBuffer->converter.formatIn, sourceBuffer->converter.channelsIn, sourceBuffer->converter.sampleRateIn, 0, AUDIO_BUFFER_USAGE_STATIC);
 
         if (audioBuffer == NULL)
         {
@@ -978,20 +1537,45 @@ Sound LoadSoundAlias(Sound source)
             return sound; // Early return to avoid dereferencing the audioBuffer null pointer
         }
 
-        audioBuffer->sizeInFrames = source.stream.buffer->sizeInFrames;
-        audioBuffer->volume = source.stream.buffer->volume;
-        audioBuffer->data = source.stream.buffer->data;
+        audioBuffer->sizeInFrames = sourceBuffer->sizeInFrames;
+        audioBuffer->volume = sourceBuffer->volume;
+        audioBuffer->data = sourceBuffer->data;
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        // Compressed data is shared, decoder state is not
+        if (sourceBuffer->decoder != NULL)
+        {
+            // NOTE: Source LMS state can be in use by the audio thread, only format is copied
+            AudioBufferQOA *decoder = (AudioBufferQOA *)sourceBuffer->decoder;
+            qoa_desc qoa = { .channels = decoder->desc.channels, .samplerate = decoder->desc.samplerate, .samples = decoder->desc.samples };
+            audioBuffer->decoder = LoadAudioBufferQOA(qoa, decoder->dataSize);
+        }
+#endif
 
         sound.frameCount = source.frameCount;
-        sound.stream.sampleRate = AUDIO.System.device.sampleRate;
-        sound.stream.sampleSize = 32;
-        sound.stream.channels = AUDIO_DEVICE_CHANNELS;
+        sound.stream.sampleRate = source.stream.sampleRate;
+        sound.stream.sampleSize = source.stream.sampleSize;
+        sound.stream.channels = source.stream.channels;
         sound.stream.buffer = audioBuffer;
     }
 
     return sound;
 }
 
+// Set default storage mode for new sounds (SoundStorage)
+// NOTE: Only affects sounds loaded afterwards
+void SetSoundStorageDefault(int storage)
+{
+#if !defined(SUPPORT_FILEFORMAT_QOA)
+    if (storage == SOUND_STORAGE_QOA)
+    {
+        TRACELOG(LOG_WARNING, "SOUND: QOA storage not supported, using original format storage");
+        storage = SOUND_STORAGE_ORIGINAL;
+    }
+#endif
+
+    AUDIO.Buffer.soundStorage = storage;
+}
 
 // Checks if a sound is valid (data loaded and buffers initialized)
 bool IsSoundValid(Sound sound)
@@ -1021,13 +1605,24 @@ void UnloadSound(Sound sound)
     //TRACELOG(LOG_INFO, "SOUND: Unloaded sound data from RAM");
 }
 
+// Unload sounds loaded with LoadSounds()
+void UnloadSounds(Sound *sounds, int count)
+{
+    if (sounds == NULL) return;
+
+    for (int i = 0; i < count; i++) UnloadSound(sounds[i]);
+
+    RL_FREE(sounds);
+}
+
 void UnloadSoundAlias(Sound alias)
 {
     // Untrack and unload just the sound buffer, not the sample data, it is shared with the source for the alias
     if (alias.stream.buffer != NULL)
     {
-        UntrackAudioBuffer(alias.stream.buffer);
+        UntrackAudioBuffer(alias.stream.buffer);     // Waits for the audio thread to release the buffer
         ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
+        RL_FREE(alias.stream.buffer->decoder);
         RL_FREE(alias.stream.buffer);
     }
 }
@@ -1037,7 +1632,16 @@ void UpdateSound(Sound sound, const void *data, int frameCount)
 {
     if (sound.stream.buffer != NULL)
     {
-        StopAudioBuffer(sound.stream.buffer);
+        if (sound.stream.buffer->decoder != NULL)
+        {
+            TRACELOG(LOG_WARNING, "SOUND: Compressed sound data can not be updated");
+            return;
+        }
+
+        // Make sure audio thread is not reading buffer data anymore
+        ma_atomic_store_32(&sound.stream.buffer->starting, MA_FALSE);
+        ma_atomic_store_32(&sound.stream.buffer->playing, MA_FALSE);
+        SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_STOP, .buffer = sound.stream.buffer });
 
         memcpy(sound.stream.buffer->data, data, frameCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn));
     }
@@ -1220,6 +1824,27 @@ void SetSoundPan(Sound sound, float pan)
     SetAudioBufferPan(sound.stream.buffer, pan);
 }
 
+// Set priority for a sound (default: 0)
+// NOTE: When voices pool is full, a new sound steals the least important voice with equal or lower priority
+void SetSoundPriority(Sound sound, int priority)
+{
+    SetAudioBufferPriority(sound.stream.buffer, priority);
+}
+
+// Set 3D position and velocity for a sound, sound becomes spatial
+// NOTE: Use SetSoundPan() to make sound non-spatial again
+void SetSoundPosition(Sound sound, Vector3 position, Vector3 velocity)
+{
+    SetAudioBufferPosition(sound.stream.buffer, position, velocity);
+}
+
+// Set distance attenuation for a spatial sound (default: AUDIO_ATTENUATION_INVERSE, 1.0f, 10000.0f, 1.0f)
+// NOTE: Sound is not attenuated under minDistance and it is not attenuated further over maxDistance
+void SetSoundAttenuation(Sound sound, int model, float minDistance, float maxDistance, float rolloff)
+{
+    SetAudioBufferAttenuation(sound.stream.buffer, model, minDistance, maxDistance, rolloff);
+}
+
 // Convert wave data to desired format
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
 {
@@ -1328,12 +1953,29 @@ Music LoadMusicStream(const char *fileName)
     Music music = { 0 };
     bool musicLoaded = false;
 
+    // Streaming decoders read directly from memory-mapped file if available: no file data copy,
+    // pages are loaded on access and evicted by the OS when required, modules are fully loaded anyway
+    // NOTE: File data is loaded if it can not be mapped (i.e. compressed archive entry, custom file loader)
+    size_t fileDataSize = 0;
+    const unsigned char *fileData = MapFileData(fileName, &fileDataSize);
+    bool isFileMapped = (fileData != NULL);
+    bool isFileDataUsed = false;    // File data is read by music decoder, released on music unloading
+
+    if (!isFileMapped)
+    {
+        int dataSize = 0;
+        fileData = LoadFileData(fileName, &dataSize);
+        fileDataSize = (size_t)dataSize;
+    }
+
     if (false) { }
 #if defined(SUPPORT_FILEFORMAT_WAV)
     else if (IsFileExtension(fileName, ".wav"))
     {
         drwav *ctxWav = RL_CALLOC(1, sizeof(drwav));
-        bool success = drwav_init_file(ctxWav, fileName, NULL);
+        bool success = false;
+
+        if (fileData != NULL) success = isFileDataUsed = drwav_init_memory(ctxWav, fileData, fileDataSize, NULL);
 
         if (success)
         {
@@ -1342,7 +1984,7 @@ Music LoadMusicStream(const char *fileName)
             int sampleSize = ctxWav->bitsPerSample;
             if (ctxWav->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on UpdateMusicStream()
 
-            music.stream = LoadAudioStream(ctxWav->sampleRate, sampleSize, ctxWav->channels);
+            music.stream = LoadAudioStreamBuffers(ctxWav->sampleRate, sampleSize, ctxWav->channels, MUSIC_STREAM_SUBBUFFERS);
             music.frameCount = (unsigned int)ctxWav->totalPCMFrameCount;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1357,7 +1999,9 @@ Music LoadMusicStream(const char *fileName)
     else if (IsFileExtension(fileName, ".ogg"))
     {
         // Open ogg audio stream
-        stb_vorbis *ctxOgg = stb_vorbis_open_filename(fileName, NULL, NULL);
+        stb_vorbis *ctxOgg = NULL;
+
+        if ((fileData != NULL) && (fileDataSize <= INT_MAX)) isFileDataUsed = ((ctxOgg = stb_vorbis_open_memory(fileData, (int)fileDataSize, NULL, NULL)) != NULL);
 
         if (ctxOgg != NULL)
         {
@@ -1366,7 +2010,7 @@ Music LoadMusicStream(const char *fileName)
             stb_vorbis_info info = stb_vorbis_get_info((stb_vorbis *)music.ctxData);  // Get Ogg file info
 
             // OGG bit rate defaults to 16 bit, it's enough for compressed format
-            music.stream = LoadAudioStream(info.sample_rate, 16, info.channels);
+            music.stream = LoadAudioStreamBuffers(info.sample_rate, 16, info.channels, MUSIC_STREAM_SUBBUFFERS);
 
             // WARNING: It seems this function returns length in frames, not samples, so we multiply by channels
             music.frameCount = (unsigned int)stb_vorbis_stream_length_in_samples((stb_vorbis *)music.ctxData);
@@ -1383,13 +2027,15 @@ Music LoadMusicStream(const char *fileName)
     else if (IsFileExtension(fileName, ".mp3"))
     {
         drmp3 *ctxMp3 = RL_CALLOC(1, sizeof(drmp3));
-        int result = drmp3_init_file(ctxMp3, fileName, NULL);
+        int result = 0;
+
+        if (fileData != NULL) result = isFileDataUsed = drmp3_init_memory(ctxMp3, fileData, fileDataSize, NULL);
 
         if (result > 0)
         {
             music.ctxType = MUSIC_AUDIO_MP3;
             music.ctxData = ctxMp3;
-            music.stream = LoadAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
+            music.stream = LoadAudioStreamBuffers(ctxMp3->sampleRate, 32, ctxMp3->channels, MUSIC_STREAM_SUBBUFFERS);
             music.frameCount = (unsigned int)drmp3_get_pcm_frame_count(ctxMp3);
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1403,7 +2049,10 @@ Music LoadMusicStream(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_QOA)
     else if (IsFileExtension(fileName, ".qoa"))
     {
-        qoaplay_desc *ctxQoa = qoaplay_open(fileName);
+        qoaplay_desc *ctxQoa = NULL;
+
+        // NOTE: File data is copied into context, file data is not required after loading
+        if ((fileData != NULL) && (fileDataSize > 0) && (fileDataSize <= INT_MAX)) ctxQoa = qoaplay_open_memory(fileData, (int)fileDataSize);
 
         if (ctxQoa != NULL)
         {
@@ -1411,7 +2060,7 @@ Music LoadMusicStream(const char *fileName)
             music.ctxData = ctxQoa;
             // NOTE: We are loading samples are 32bit float normalized data, so,
             // we configure the output audio stream to also use float 32bit
-            music.stream = LoadAudioStream(ctxQoa->info.samplerate, 32, ctxQoa->info.channels);
+            music.stream = LoadAudioStreamBuffers(ctxQoa->info.samplerate, 32, ctxQoa->info.channels, MUSIC_STREAM_SUBBUFFERS);
             music.frameCount = ctxQoa->info.samples;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1422,7 +2071,9 @@ Music LoadMusicStream(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_FLAC)
     else if (IsFileExtension(fileName, ".flac"))
     {
-        drflac *ctxFlac = drflac_open_file(fileName, NULL);
+        drflac *ctxFlac = NULL;
+
+        if (fileData != NULL) isFileDataUsed = ((ctxFlac = drflac_open_memory(fileData, fileDataSize, NULL)) != NULL);
 
         if (ctxFlac != NULL)
         {
@@ -1430,7 +2081,7 @@ Music LoadMusicStream(const char *fileName)
             music.ctxData = ctxFlac;
             int sampleSize = ctxFlac->bitsPerSample;
             if (ctxFlac->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on UpdateMusicStream()
-            music.stream = LoadAudioStream(ctxFlac->sampleRate, sampleSize, ctxFlac->channels);
+            music.stream = LoadAudioStreamBuffers(ctxFlac->sampleRate, sampleSize, ctxFlac->channels, MUSIC_STREAM_SUBBUFFERS);
             music.frameCount = (unsigned int)ctxFlac->totalPCMFrameCount;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1445,7 +2096,10 @@ Music LoadMusicStream(const char *fileName)
     else if (IsFileExtension(fileName, ".xm"))
     {
         jar_xm_context_t *ctxXm = NULL;
-        int result = jar_xm_create_context_from_file(&ctxXm, AUDIO.System.device.sampleRate, fileName);
+        int result = -1;
+
+        // NOTE: Module data is copied into context, file data is not required after loading
+        if (fileData != NULL) result = jar_xm_create_context_safe(&ctxXm, (const char *)fileData, fileDataSize, AUDIO.System.device.sampleRate);
 
         if (result == 0)    // XM AUDIO.System.context created successfully
         {
@@ -1458,7 +2112,7 @@ Music LoadMusicStream(const char *fileName)
             else if (AUDIO_DEVICE_FORMAT == ma_format_u8) bits = 8;
 
             // NOTE: Only stereo is supported for XM
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, bits, AUDIO_DEVICE_CHANNELS);
+            music.stream = LoadAudioStreamBuffers(AUDIO.System.device.sampleRate, bits, AUDIO_DEVICE_CHANNELS, MUSIC_STREAM_SUBBUFFERS);
             music.frameCount = (unsigned int)jar_xm_get_remaining_samples(ctxXm);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             jar_xm_reset(ctxXm);    // Make sure we start at the beginning of the song
@@ -1474,15 +2128,25 @@ Music LoadMusicStream(const char *fileName)
     else if (IsFileExtension(fileName, ".mod"))
     {
         jar_mod_context_t *ctxMod = RL_CALLOC(1, sizeof(jar_mod_context_t));
+        int result = 0;
+
         jar_mod_init(ctxMod);
-        int result = jar_mod_load_file(ctxMod, fileName);
+
+        // NOTE: Module data is copied into context (released on jar_mod_unload()), file data is not required after loading
+        if ((fileData != NULL) && (fileDataSize > 0) && (fileDataSize < 32*1024*1024))
+        {
+            ctxMod->modfile = (muchar *)RL_MALLOC(fileDataSize);
+            memcpy(ctxMod->modfile, fileData, fileDataSize);
+            ctxMod->modfilesize = (mulong)fileDataSize;
+            if (jar_mod_load(ctxMod, (void *)ctxMod->modfile, (int)fileDataSize)) result = (int)fileDataSize;
+        }
 
         if (result > 0)
         {
             music.ctxType = MUSIC_MODULE_MOD;
             music.ctxData = ctxMod;
             // NOTE: Only stereo is supported for MOD
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, 16, AUDIO_DEVICE_CHANNELS);
+            music.stream = LoadAudioStreamBuffers(AUDIO.System.device.sampleRate, 16, AUDIO_DEVICE_CHANNELS, MUSIC_STREAM_SUBBUFFERS);
             music.frameCount = (unsigned int)jar_mod_max_samples(ctxMod);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1496,6 +2160,15 @@ Music LoadMusicStream(const char *fileName)
 #endif
     else TRACELOG(LOG_WARNING, "STREAM: [%s] File format not supported", fileName);
 
+    if (musicLoaded && isFileDataUsed && (music.stream.buffer != NULL))
+    {
+        music.stream.buffer->fileData = fileData;
+        music.stream.buffer->fileDataSize = fileDataSize;
+        music.stream.buffer->isFileMapped = isFileMapped;
+    }
+    else if (isFileMapped) UnmapFileData(fileData, fileDataSize);
+    else UnloadFileData((unsigned char *)fileData);
+
     if (!musicLoaded)
     {
         TRACELOG(LOG_WARNING, "FILEIO: [%s] Music file could not be opened", fileName);
@@ -1535,7 +2208,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             int sampleSize = ctxWav->bitsPerSample;
             if (ctxWav->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on UpdateMusicStream()
 
-            music.stream = LoadAudioStream(ctxWav->sampleRate, sampleSize, ctxWav->channels);
+            music.stream = LoadAudioStreamBuffers(ctxWav->sampleRate, sampleSize, ctxWav->channels, MUSIC_STREAM_SUBBUFFERS);
             music.frameCount = (unsigned int)ctxWav->totalPCMFrameCount;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1559,7 +2232,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             stb_vorbis_info info = stb_vorbis_get_info((stb_vorbis *)music.ctxData);  // Get Ogg file info
 
             // OGG bit rate defaults to 16 bit, it's enough for compressed format
-            music.stream = LoadAudioStream(info.sample_rate, 16, info.channels);
+            music.stream = LoadAudioStreamBuffers(info.sample_rate, 16, info.channels, MUSIC_STREAM_SUBBUFFERS);
 
             // WARNING: It seems this function returns length in frames, not samples, so we multiply by channels
             music.frameCount = (unsigned int)stb_vorbis_stream_length_in_samples((stb_vorbis *)music.ctxData);
@@ -1582,7 +2255,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
         {
             music.ctxType = MUSIC_AUDIO_MP3;
             music.ctxData = ctxMp3;
-            music.stream = LoadAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
+            music.stream = LoadAudioStreamBuffers(ctxMp3->sampleRate, 32, ctxMp3->channels, MUSIC_STREAM_SUBBUFFERS);
             music.frameCount = (unsigned int)drmp3_get_pcm_frame_count(ctxMp3);
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1609,7 +2282,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             music.ctxData = ctxQoa;
             // NOTE: We are loading samples are 32bit float normalized data, so,
             // we configure the output audio stream to also use float 32bit
-            music.stream = LoadAudioStream(ctxQoa->info.samplerate, 32, ctxQoa->info.channels);
+            music.stream = LoadAudioStreamBuffers(ctxQoa->info.samplerate, 32, ctxQoa->info.channels, MUSIC_STREAM_SUBBUFFERS);
             music.frameCount = ctxQoa->info.samples;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1628,7 +2301,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             music.ctxData = ctxFlac;
             int sampleSize = ctxFlac->bitsPerSample;
             if (ctxFlac->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on UpdateMusicStream()
-            music.stream = LoadAudioStream(ctxFlac->sampleRate, sampleSize, ctxFlac->channels);
+            music.stream = LoadAudioStreamBuffers(ctxFlac->sampleRate, sampleSize, ctxFlac->channels, MUSIC_STREAM_SUBBUFFERS);
             music.frameCount = (unsigned int)ctxFlac->totalPCMFrameCount;
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1655,7 +2328,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             else if (AUDIO_DEVICE_FORMAT == ma_format_u8) bits = 8;
 
             // NOTE: Only stereo is supported for XM
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, bits, 2);
+            music.stream = LoadAudioStreamBuffers(AUDIO.System.device.sampleRate, bits, 2, MUSIC_STREAM_SUBBUFFERS);
             music.frameCount = (unsigned int)jar_xm_get_remaining_samples(ctxXm);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             jar_xm_reset(ctxXm);    // Make sure we start at the beginning of the song
@@ -1695,7 +2368,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             music.ctxData = ctxMod;
 
             // NOTE: Only stereo is supported for MOD
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, 16, 2);
+            music.stream = LoadAudioStreamBuffers(AUDIO.System.device.sampleRate, 16, 2, MUSIC_STREAM_SUBBUFFERS);
             music.frameCount = (unsigned int)jar_mod_max_samples(ctxMod);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1739,6 +2412,17 @@ bool IsMusicValid(Music music)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+#if defined(AUDIO_MUSIC_DECODE_THREAD)
+    LockMusicDecoder();
+    if (ma_atomic_load_32(&AUDIO.Decoder.running)) RemoveMusicDecode(GetMusicDecodeIndex(music.stream.buffer));
+    UnlockMusicDecoder();
+#endif
+
+    // File data is read by music decoder, released after decoder is closed
+    const unsigned char *fileData = (music.stream.buffer != NULL)? music.stream.buffer->fileData : NULL;
+    size_t fileDataSize = (music.stream.buffer != NULL)? music.stream.buffer->fileDataSize : 0;
+    bool isFileMapped = (music.stream.buffer != NULL)? music.stream.buffer->isFileMapped : false;
+
     UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
@@ -1766,11 +2450,25 @@ void UnloadMusicStream(Music music)
         else if (music.ctxType == MUSIC_MODULE_MOD) { jar_mod_unload((jar_mod_context_t *)music.ctxData); RL_FREE(music.ctxData); }
 #endif
     }
+
+    if (isFileMapped) UnmapFileData(fileData, fileDataSize);
+    else UnloadFileData((unsigned char *)fileData);
 }
 
 // Start music playing (open stream) from beginning
+// NOTE: Music stream is decoded ahead of playback by the decoding thread if available
 void PlayMusicStream(Music music)
 {
+    if (music.stream.buffer == NULL) return;
+
+    LockMusicDecoder();
+    // Ending music keeps playing, decoder has been rewound after its latest frames
+    ma_atomic_store_32(&music.stream.buffer->streamEnd, AUDIO_STREAM_NO_END);
+#if defined(AUDIO_MUSIC_DECODE_THREAD)
+    if (ma_atomic_load_32(&AUDIO.Decoder.running)) AddMusicDecode(music, false);
+#endif
+    UnlockMusicDecoder();
+
     PlayAudioStream(music.stream);
 }
 
@@ -1789,234 +2487,87 @@ void ResumeMusicStream(Music music)
 // Stop music playing (close stream)
 void StopMusicStream(Music music)
 {
+    LockMusicDecoder();
+#if defined(AUDIO_MUSIC_DECODE_THREAD)
+    if (ma_atomic_load_32(&AUDIO.Decoder.running)) RemoveMusicDecode(GetMusicDecodeIndex(music.stream.buffer));
+#endif
     StopAudioStream(music.stream);
 
-    switch (music.ctxType)
+    if (music.stream.buffer != NULL)
     {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
+        // Data decoded ahead while stopped (i.e. queued music) is dropped, sub-buffers are refilled once released
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_FLUSH, .buffer = music.stream.buffer });
+        SeekMusicDecoder(music, 0);
     }
+    UnlockMusicDecoder();
 }
 
 // Seek music to a certain position (in seconds)
+// NOTE: Seeking is sample-accurate, stream pending data is dropped and refilled from the new position
 void SeekMusicStream(Music music, float position)
 {
-    // Seeking is not supported in module formats
-    if ((music.ctxType == MUSIC_MODULE_XM) || (music.ctxType == MUSIC_MODULE_MOD)) return;
+    if (music.stream.buffer == NULL) return;
 
-    unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
+    unsigned int positionInFrames = (position > 0.0f)? (unsigned int)(position*music.stream.sampleRate + 0.5f) : 0;
 
-    switch (music.ctxType)
-    {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_frame((stb_vorbis *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA:
-        {
-            int qoaFrame = positionInFrames/QOA_FRAME_LEN;
-            qoaplay_seek_frame((qoaplay_desc *)music.ctxData, qoaFrame); // Seeks to QOA frame, not PCM frame
+    LockMusicDecoder();
+    SeekMusicDecoder(music, positionInFrames);
 
-            // We need to compute QOA frame number and update positionInFrames
-            positionInFrames = ((qoaplay_desc *)music.ctxData)->sample_position;
-        } break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, positionInFrames); break;
-#endif
-        default: break;
-    }
+    // Audio thread releases all sub-buffers, playback continues with the new data
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_FLUSH, .buffer = music.stream.buffer });
+    DecodeMusicStream(music);
 
-    ma_mutex_lock(&AUDIO.System.lock);
-    music.stream.buffer->framesProcessed = positionInFrames;
-    ma_mutex_unlock(&AUDIO.System.lock);
+#if defined(AUDIO_MUSIC_DECODE_THREAD)
+    // Stream could have been removed from decoding thread list when decoded until the end
+    if (ma_atomic_load_32(&AUDIO.Decoder.running) && (ma_atomic_load_32(&music.stream.buffer->playing) || ma_atomic_load_32(&music.stream.buffer->starting))) AddMusicDecode(music, false);
+#endif
+    UnlockMusicDecoder();
 }
 
-// Update (re-fill) music buffers if data already processed
-void UpdateMusicStream(Music music)
+// Set music loop points (in seconds), loop end 0.0f for end of music
+// NOTE: Looping music jumps from loop end to loop start, applied to frames decoded after the call
+void SetMusicLoopPoints(Music music, float loopStart, float loopEnd)
 {
     if (music.stream.buffer == NULL) return;
 
-    ma_mutex_lock(&AUDIO.System.lock);
-
-    unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
-
-    // On first call of this function we lazily pre-allocated a temp buffer to read audio files/memory data in
-    int frameSize = music.stream.channels*music.stream.sampleSize/8;
-    unsigned int pcmSize = subBufferSizeInFrames*frameSize;
-
-    if (AUDIO.System.pcmBufferSize < pcmSize)
-    {
-        RL_FREE(AUDIO.System.pcmBuffer);
-        AUDIO.System.pcmBuffer = RL_CALLOC(1, pcmSize);
-        AUDIO.System.pcmBufferSize = pcmSize;
-    }
-
-    // Check both sub-buffers to check if they require refilling
-    for (int i = 0; i < 2; i++)
-    {
-        if (!music.stream.buffer->isSubBufferProcessed[i]) continue; // No refilling required, move to next sub-buffer
-
-        unsigned int framesLeft = music.frameCount - music.stream.buffer->framesProcessed;  // Frames left to be processed
-        unsigned int framesToStream = 0;                 // Total frames to be streamed
-
-        if ((framesLeft >= subBufferSizeInFrames) || music.looping) framesToStream = subBufferSizeInFrames;
-        else framesToStream = framesLeft;
-
-        int frameCountStillNeeded = framesToStream;
-        int frameCountReadTotal = 0;
-
-        switch (music.ctxType)
-        {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                if (music.stream.sampleSize == 16)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-                else if (music.stream.sampleSize == 32)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                while (true)
-                {
-                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_QOA)
-            case MUSIC_AUDIO_QOA:
-            {
-                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                frameCountReadTotal += frameCountRead;
-                /*
-                while (true)
-                {
-                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
-                }
-                */
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
-                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
-                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+    LockMusicDecoder();
+    music.stream.buffer->musicLoopStart = (loopStart > 0.0f)? (unsigned int)(loopStart*music.stream.sampleRate + 0.5f) : 0;
+    music.stream.buffer->musicLoopEnd = (loopEnd > 0.0f)? (unsigned int)(loopEnd*music.stream.sampleRate + 0.5f) : 0;
+    UnlockMusicDecoder();
+}
 
-            } break;
-        #endif
-            default: break;
-        }
+// Queue music to start right after current music ends (gapless)
+// NOTE: Next music is decoded ahead and started by the audio thread right after the latest frame of current music,
+// current music must not be looping to end, stopping current music drops the queued one
+void QueueMusicStream(Music music, Music next)
+{
+    if ((music.stream.buffer == NULL) || (next.stream.buffer == NULL) || (music.stream.buffer == next.stream.buffer)) return;
 
-        UpdateAudioStreamInLockedState(music.stream, AUDIO.System.pcmBuffer, framesToStream);
+    LockMusicDecoder();
+#if defined(AUDIO_MUSIC_DECODE_THREAD)
+    if (ma_atomic_load_32(&AUDIO.Decoder.running)) AddMusicDecode(next, true);
+#endif
+    DecodeMusicStream(next);
+    UnlockMusicDecoder();
 
-        music.stream.buffer->framesProcessed = music.stream.buffer->framesProcessed%music.frameCount;
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_QUEUE, .buffer = music.stream.buffer, .queued = next.stream.buffer });
+}
 
-        if (framesLeft <= subBufferSizeInFrames)
-        {
-            if (!music.looping)
-            {
-                ma_mutex_unlock(&AUDIO.System.lock);
-                // Streaming is ending, we filled latest frames from input
-                StopMusicStream(music);
-                return;
-            }
-        }
-    }
+// Update (re-fill) music buffers if data already processed
+// NOTE: Not required if music stream is decoded by the decoding thread, user changes (i.e. looping) are updated,
+// music stream is stopped by the audio thread right after its latest frame
+void UpdateMusicStream(Music music)
+{
+    if (music.stream.buffer == NULL) return;
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    LockMusicDecoder();     // Decoders and pcmBuffer are shared with the decoding thread
+#if defined(AUDIO_MUSIC_DECODE_THREAD)
+    int index = GetMusicDecodeIndex(music.stream.buffer);
+    if (index >= 0) AUDIO.Decoder.streams[index] = music;
+    else
+#endif
+    DecodeMusicStream(music);
+    UnlockMusicDecoder();
 }
 
 // Check if any music is playing
@@ -2043,6 +2594,12 @@ void SetMusicPan(Music music, float pan)
     SetAudioBufferPan(music.stream.buffer, pan);
 }
 
+// Set 3D position and velocity for a music, music becomes spatial
+void SetMusicPosition(Music music, Vector3 position, Vector3 velocity)
+{
+    SetAudioBufferPosition(music.stream.buffer, position, velocity);
+}
+
 // Get music time length (in seconds)
 float GetMusicTimeLength(Music music)
 {
@@ -2064,23 +2621,23 @@ float GetMusicTimePlayed(Music music)
         {
             uint64_t framesPlayed = 0;
 
+            LockMusicDecoder();
             jar_xm_get_position(music.ctxData, NULL, NULL, NULL, &framesPlayed);
+            UnlockMusicDecoder();
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
         }
         else
 #endif
         {
-            ma_mutex_lock(&AUDIO.System.lock);
             //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
-            int framesProcessed = (int)music.stream.buffer->framesProcessed;
-            int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
-            int framesInFirstBuffer = music.stream.buffer->isSubBufferProcessed[0]? 0 : subBufferSize;
-            int framesInSecondBuffer = music.stream.buffer->isSubBufferProcessed[1]? 0 : subBufferSize;
-            int framesSentToMix = music.stream.buffer->frameCursorPos%subBufferSize;
-            int framesPlayed = (framesProcessed - framesInFirstBuffer - framesInSecondBuffer + framesSentToMix)%(int)music.frameCount;
+            int framesProcessed = (int)ma_atomic_load_32(&music.stream.buffer->framesProcessed);
+            int subBufferSize = (int)(music.stream.buffer->sizeInFrames/music.stream.buffer->subBufferCount);
+            int framesInBuffers = 0;
+            for (unsigned int i = 0; i < music.stream.buffer->subBufferCount; i++) framesInBuffers += ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[i])? 0 : subBufferSize;
+            int framesSentToMix = ma_atomic_load_32(&music.stream.buffer->frameCursorPos)%subBufferSize;
+            int framesPlayed = (framesProcessed - framesInBuffers + framesSentToMix)%(int)music.frameCount;
             if (framesPlayed < 0) framesPlayed += music.frameCount;
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
-            ma_mutex_unlock(&AUDIO.System.lock);
         }
     }
 
@@ -2089,9 +2646,18 @@ float GetMusicTimePlayed(Music music)
 
 // Load audio stream (to stream audio pcm data)
 AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels)
+{
+    return LoadAudioStreamBuffers(sampleRate, sampleSize, channels, 2);
+}
+
+// Load audio stream with a ring of sub-buffers, filled ahead of playback
+static AudioStream LoadAudioStreamBuffers(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels, unsigned int subBufferCount)
 {
     AudioStream stream = { 0 };
 
+    if (subBufferCount < 2) subBufferCount = 2;
+    else if (subBufferCount > MAX_AUDIO_STREAM_SUBBUFFERS) subBufferCount = MAX_AUDIO_STREAM_SUBBUFFERS;
+
     stream.sampleRate = sampleRate;
     stream.sampleSize = sampleSize;
     stream.channels = channels;
@@ -2106,11 +2672,12 @@ AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, un
 
     if (subBufferSize < periodSize) subBufferSize = periodSize;
 
-    // Create a double audio buffer of defined size
-    stream.buffer = LoadAudioBuffer(formatIn, stream.channels, stream.sampleRate, subBufferSize*2, AUDIO_BUFFER_USAGE_STREAM);
+    // Create a ring of audio sub-buffers of defined size (default: double buffer)
+    stream.buffer = LoadAudioBuffer(formatIn, stream.channels, stream.sampleRate, subBufferSize*subBufferCount, AUDIO_BUFFER_USAGE_STREAM);
 
     if (stream.buffer != NULL)
     {
+        stream.buffer->subBufferCount = subBufferCount;
         stream.buffer->looping = true;    // Always loop for streaming buffers
         TRACELOG(LOG_INFO, "STREAM: Initialized successfully (%i Hz, %i bit, %s)", stream.sampleRate, stream.sampleSize, (stream.channels == 1)? "Mono" : "Stereo");
     }
@@ -2139,11 +2706,72 @@ void UnloadAudioStream(AudioStream stream)
 // Update audio stream buffers with data
 // NOTE 1: Only updates one buffer of the stream source: dequeue -> update -> queue
 // NOTE 2: To dequeue a buffer it needs to be processed: IsAudioStreamProcessed()
+// NOTE 3: Sub-buffers are handed over to the audio thread with atomic flags, no lock required
 void UpdateAudioStream(AudioStream stream, const void *data, int frameCount)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    UpdateAudioStreamInLockedState(stream, data, frameCount);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    UpdateAudioStreamFrames(stream, data, frameCount, false);
+}
+
+// Update audio stream sub-buffer with data
+// NOTE: Latest frames of a stream mark its end, audio thread stops the stream right after them
+static void UpdateAudioStreamFrames(AudioStream stream, const void *data, int frameCount, bool isLast)
+{
+    if (stream.buffer != NULL)
+    {
+        ma_uint32 subBufferCount = stream.buffer->subBufferCount;
+        ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/subBufferCount;
+
+        // NOTE: Flags are loaded before cursor, audio thread moves the cursor before releasing a sub-buffer
+        bool isSubBufferProcessed[MAX_AUDIO_STREAM_SUBBUFFERS] = { 0 };
+        bool isAnySubBufferProcessed = false;
+        for (ma_uint32 i = 0; i < subBufferCount; i++)
+        {
+            isSubBufferProcessed[i] = ma_atomic_load_explicit_32(&stream.buffer->isSubBufferProcessed[i], ma_atomic_memory_order_acquire);
+            if (isSubBufferProcessed[i]) isAnySubBufferProcessed = true;
+        }
+
+        if (isAnySubBufferProcessed)
+        {
+            // Sub-buffers are consumed in order, pending sub-buffers are the ones following the cursor,
+            // the next one to update is the first processed sub-buffer starting from the cursor
+            // NOTE: If all of them are processed, audio thread is waiting at the start of the cursor sub-buffer
+            ma_uint32 cursorSubBuffer = (ma_atomic_load_32(&stream.buffer->frameCursorPos)/subBufferSizeInFrames)%subBufferCount;
+            ma_uint32 subBufferToUpdate = cursorSubBuffer;
+
+            for (ma_uint32 i = 0; i < subBufferCount; i++)
+            {
+                subBufferToUpdate = (cursorSubBuffer + i)%subBufferCount;
+                if (isSubBufferProcessed[subBufferToUpdate]) break;
+            }
+
+            unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
+
+            // Does this API expect a whole buffer to be updated in one go?
+            // Assuming so, but if not will need to change this logic
+            if (subBufferSizeInFrames >= (ma_uint32)frameCount)
+            {
+                // Total frames processed in buffer is always the complete size, filled with 0 if required
+                ma_atomic_fetch_add_32(&stream.buffer->framesProcessed, subBufferSizeInFrames);
+
+                ma_uint32 framesToWrite = (ma_uint32)frameCount;
+
+                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
+                memcpy(subBuffer, data, bytesToWrite);
+
+                // Any leftover frames should be filled with zeros
+                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+
+                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+
+                if (isLast) ma_atomic_store_32(&stream.buffer->streamEnd, subBufferToUpdate + framesToWrite*MAX_AUDIO_STREAM_SUBBUFFERS);
+
+                // Publish sub-buffer data to the audio thread
+                ma_atomic_store_explicit_32(&stream.buffer->isSubBufferProcessed[subBufferToUpdate], MA_FALSE, ma_atomic_memory_order_release);
+            }
+            else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
+        }
+        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+    }
 }
 
 // Check if any audio stream buffers requires refill
@@ -2152,9 +2780,9 @@ bool IsAudioStreamProcessed(AudioStream stream)
     if (stream.buffer == NULL) return false;
 
     bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1];
-    ma_mutex_unlock(&AUDIO.System.lock);
+
+    for (unsigned int i = 0; (i < stream.buffer->subBufferCount) && !result; i++) result = ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[i]);
+
     return result;
 }
 
@@ -2217,63 +2845,40 @@ void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 {
     if (stream.buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        stream.buffer->callback = callback;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_SET_CALLBACK, .buffer = stream.buffer, .callback = callback });
     }
 }
 
 // Add processor to audio stream. Contrary to buffers, the order of processors is important
 // The new processor must be added at the end. As there aren't supposed to be a lot of processors attached to
 // a given stream, we iterate through the list to find the end. That way we don't need a pointer to the last element
+// NOTE: Processor is linked on the audio thread
 void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    if (stream.buffer == NULL) return;
 
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = stream.buffer->processor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else stream.buffer->processor = processor;
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (!PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = stream.buffer, .processor = processor })) RL_FREE(processor);
 }
 
 // Remove processor from audio stream
+// NOTE: Waits for the audio thread to unlink the processor before freeing it
 void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    if (stream.buffer == NULL) return;
 
-    rAudioProcessor *processor = stream.buffer->processor;
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = stream.buffer, .callback = process });
+
+    rAudioProcessor *processor = (rAudioProcessor *)ma_atomic_exchange_ptr(&AUDIO.Command.detached, NULL);
 
     while (processor)
     {
         rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (stream.buffer->processor == processor) stream.buffer->processor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
+        RL_FREE(processor);
         processor = next;
     }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 // Add processor to audio pipeline. Order of processors is important
@@ -2281,52 +2886,25 @@ void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 // these two work on the already mixed output just before sending it to the sound hardware
 void AttachAudioMixedProcessor(AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = AUDIO.mixedProcessor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else AUDIO.mixedProcessor = processor;
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (!PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = NULL, .processor = processor })) RL_FREE(processor);
 }
 
 // Remove processor from audio pipeline
 void DetachAudioMixedProcessor(AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = NULL, .callback = process });
 
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
+    rAudioProcessor *processor = (rAudioProcessor *)ma_atomic_exchange_ptr(&AUDIO.Command.detached, NULL);
 
     while (processor)
     {
         rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (AUDIO.mixedProcessor == processor) AUDIO.mixedProcessor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
+        RL_FREE(processor);
         processor = next;
     }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 
@@ -2341,45 +2919,50 @@ static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage)
 }
 
 // Reads audio data from an AudioBuffer object in internal format
-static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
+// NOTE: If mix is requested, internal format must be the mixing format, frames are accumulated
+// into framesOut with buffer mixing levels and no excess zero-fill is required
+static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount, bool mix)
 {
     // Using audio buffer callback
     if (audioBuffer->callback)
     {
         audioBuffer->callback(framesOut, frameCount);
-        audioBuffer->framesProcessed += frameCount;
+        ma_atomic_fetch_add_32(&audioBuffer->framesProcessed, frameCount);
 
         return frameCount;
     }
 
-    ma_uint32 subBufferSizeInFrames = (audioBuffer->sizeInFrames > 1)? audioBuffer->sizeInFrames/2 : audioBuffer->sizeInFrames;
-    ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
+    // Streams data is a ring of sub-buffers, filled by UpdateAudioStream() and consumed in order
+    ma_uint32 subBufferSizeInFrames = audioBuffer->sizeInFrames;
+    ma_uint32 currentSubBufferIndex = 0;
 
-    if (currentSubBufferIndex > 1) return 0;
+    if (audioBuffer->usage == AUDIO_BUFFER_USAGE_STREAM)
+    {
+        subBufferSizeInFrames = audioBuffer->sizeInFrames/audioBuffer->subBufferCount;
+        currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
 
-    // Another thread can update the processed state of buffers, so
-    // we just take a copy here to try and avoid potential synchronization problems
-    bool isSubBufferProcessed[2] = { 0 };
-    isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
-    isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
+        if (currentSubBufferIndex >= audioBuffer->subBufferCount) return 0;
+    }
 
     ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
     // Fill out every frame until we find a buffer that's marked as processed. Then fill the remainder with 0
     ma_uint32 framesRead = 0;
+    bool isStreamEnded = false;
     while (1)
     {
         // We break from this loop differently depending on the buffer's usage
         //  - For static buffers, we simply fill as much data as we can
-        //  - For streaming buffers we only fill half of the buffer that are processed
-        //    Unprocessed halves must keep their audio data in-tact
+        //  - For streaming buffers we only fill from sub-buffers that are not processed
+        //    Processed sub-buffers can be refilled by another thread at any moment
         if (audioBuffer->usage == AUDIO_BUFFER_USAGE_STATIC)
         {
             if (framesRead >= frameCount) break;
         }
         else
         {
-            if (isSubBufferProcessed[currentSubBufferIndex]) break;
+            // NOTE: Acquire ordering, sub-buffer data is published by UpdateAudioStream() before the flag
+            if (ma_atomic_load_explicit_32(&audioBuffer->isSubBufferProcessed[currentSubBufferIndex], ma_atomic_memory_order_acquire)) break;
         }
 
         ma_uint32 totalFramesRemaining = (frameCount - framesRead);
@@ -2399,22 +2982,58 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         ma_uint32 framesToRead = totalFramesRemaining;
         if (framesToRead > framesRemainingInOutputBuffer) framesToRead = framesRemainingInOutputBuffer;
 
-        memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
-        audioBuffer->frameCursorPos = (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
+        // Stream ends on this sub-buffer, frames after the latest valid frame are not read
+        // NOTE: End marker is published before the sub-buffer flag, loaded after it
+        bool isStreamEndReached = false;
+        if (audioBuffer->usage == AUDIO_BUFFER_USAGE_STREAM)
+        {
+            ma_uint32 streamEnd = ma_atomic_load_32(&audioBuffer->streamEnd);
+
+            if ((streamEnd != AUDIO_STREAM_NO_END) && ((streamEnd%MAX_AUDIO_STREAM_SUBBUFFERS) == currentSubBufferIndex))
+            {
+                ma_uint32 framesReadInSubBuffer = subBufferSizeInFrames - framesRemainingInOutputBuffer;
+                ma_uint32 framesValid = streamEnd/MAX_AUDIO_STREAM_SUBBUFFERS;
+                ma_uint32 framesToEnd = (framesValid > framesReadInSubBuffer)? (framesValid - framesReadInSubBuffer) : 0;
+
+                if (framesToRead >= framesToEnd)
+                {
+                    framesToRead = framesToEnd;
+                    isStreamEndReached = true;
+                }
+            }
+        }
+
+        const unsigned char *framesIn = audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes);
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        // Compressed data is decoded one QOA frame at a time, frames to read are limited to the decoded frame
+        if (audioBuffer->decoder != NULL) framesIn = DecodeAudioBufferQOA(audioBuffer, audioBuffer->frameCursorPos, &framesToRead);
+#endif
+
+        if (mix) MixAudioFrames((float *)((unsigned char *)framesOut + (framesRead*frameSizeInBytes)), (const float *)framesIn, framesToRead, audioBuffer);
+        else memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), framesIn, framesToRead*frameSizeInBytes);
+        ma_atomic_store_32(&audioBuffer->frameCursorPos, (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames);
         framesRead += framesToRead;
 
+        // Latest stream frame has been read, stream is stopped and its sub-buffers released
+        if (isStreamEndReached)
+        {
+            StopAudioBufferInMixer(audioBuffer);
+            isStreamEnded = true;
+            break;
+        }
+
         // If we've read to the end of the buffer, mark it as processed
         if (framesToRead == framesRemainingInOutputBuffer)
         {
-            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
-            isSubBufferProcessed[currentSubBufferIndex] = true;
+            // Release sub-buffer to be refilled by UpdateAudioStream()
+            ma_atomic_store_explicit_32(&audioBuffer->isSubBufferProcessed[currentSubBufferIndex], MA_TRUE, ma_atomic_memory_order_release);
 
-            currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
+            currentSubBufferIndex = (currentSubBufferIndex + 1)%audioBuffer->subBufferCount;
 
             // We need to break from this loop if we're not looping
             if (!audioBuffer->looping)
             {
-                StopAudioBufferInLockedState(audioBuffer);
+                StopAudioBufferInMixer(audioBuffer);
                 break;
             }
         }
@@ -2424,12 +3043,12 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     ma_uint32 totalFramesRemaining = (frameCount - framesRead);
     if (totalFramesRemaining > 0)
     {
-        memset((unsigned char *)framesOut + (framesRead*frameSizeInBytes), 0, totalFramesRemaining*frameSizeInBytes);
+        if (!mix) memset((unsigned char *)framesOut + (framesRead*frameSizeInBytes), 0, totalFramesRemaining*frameSizeInBytes);
 
         // For static buffers we can fill the remaining frames with silence for safety, but we don't want
         // to report those frames as "read". The reason for this is that the caller uses the return value
-        // to know whether a non-looping sound has finished playback
-        if (audioBuffer->usage != AUDIO_BUFFER_USAGE_STATIC) framesRead += totalFramesRemaining;
+        // to know whether a non-looping sound has finished playback, same for streams reaching their end
+        if ((audioBuffer->usage != AUDIO_BUFFER_USAGE_STATIC) && !isStreamEnded) framesRead += totalFramesRemaining;
     }
 
     return framesRead;
@@ -2442,7 +3061,7 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
     // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
     // frames. This can be achieved with ma_data_converter_get_required_input_frame_count()
-    ma_uint8 inputBuffer[4096] = { 0 };
+    ma_uint8 inputBuffer[4096];       // NOTE: Filled by ReadAudioBufferFramesInInternalFormat(), including zero-fill
     ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
     ma_uint32 totalOutputFramesProcessed = 0;
@@ -2460,7 +3079,7 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
         float *runningFramesOut = framesOut + (totalOutputFramesProcessed*audioBuffer->converter.channelsOut);
 
         /* At this point we can convert the data to our mixing format. */
-        ma_uint64 inputFramesProcessedThisIteration = ReadAudioBufferFramesInInternalFormat(audioBuffer, inputBuffer, (ma_uint32)inputFramesToProcessThisIteration);    /* Safe cast. */
+        ma_uint64 inputFramesProcessedThisIteration = ReadAudioBufferFramesInInternalFormat(audioBuffer, inputBuffer, (ma_uint32)inputFramesToProcessThisIteration, false);    /* Safe cast. */
         ma_uint64 outputFramesProcessedThisIteration = outputFramesToProcessThisIteration;
         ma_data_converter_process_pcm_frames(&audioBuffer->converter, inputBuffer, &inputFramesProcessedThisIteration, runningFramesOut, &outputFramesProcessedThisIteration);
 
@@ -2468,6 +3087,18 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
 
         if (inputFramesProcessedThisIteration < inputFramesToProcessThisIteration)
         {
+            // Buffer has ended, resampler keeps the latest frame as history: it is drained with a silent frame
+            if (!ma_atomic_load_32(&audioBuffer->playing) && (totalOutputFramesProcessed < frameCount))
+            {
+                memset(inputBuffer, 0, ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn));
+
+                inputFramesProcessedThisIteration = 1;
+                outputFramesProcessedThisIteration = frameCount - totalOutputFramesProcessed;
+                ma_data_converter_process_pcm_frames(&audioBuffer->converter, inputBuffer, &inputFramesProcessedThisIteration, framesOut + (totalOutputFramesProcessed*audioBuffer->converter.channelsOut), &outputFramesProcessedThisIteration);
+
+                totalOutputFramesProcessed += (ma_uint32)outputFramesProcessedThisIteration;
+            }
+
             break;  /* Ran out of input data. */
         }
 
@@ -2483,220 +3114,1220 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
 
 // Sending audio data to device callback function
 // This function will be called when miniaudio needs more data
-// NOTE: All the mixing takes place here
+// NOTE: All the mixing takes place here, in blocks of AUDIO_MIX_BLOCK_SIZE frames on a float bus
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount)
 {
     (void)pDevice;
 
-    // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
-    memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
+    const ma_uint32 channels = pDevice->playback.channels;
+    const ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(pDevice->playback.format, channels);
+
+    // Apply API changes queued since last callback, no lock is shared with the API caller threads
+    ProcessAudioCommands();
+    UpdateAudioSpatial();
+    UpdateAudioVoices();
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
+    for (ma_uint32 blockFrame = 0; blockFrame < frameCount; blockFrame += AUDIO_MIX_BLOCK_SIZE)
     {
-        for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
-        {
-            // Ignore stopped or paused sounds
-            if (!audioBuffer->playing || audioBuffer->paused) continue;
+        ma_uint32 blockFrameCount = frameCount - blockFrame;
+        if (blockFrameCount > AUDIO_MIX_BLOCK_SIZE) blockFrameCount = AUDIO_MIX_BLOCK_SIZE;
 
-            ma_uint32 framesRead = 0;
+        // Float output is used directly as mixing bus, other formats are converted after mixing
+        float *bus = (pDevice->playback.format == ma_format_f32)? (float *)pFramesOut + blockFrame*channels : AUDIO.Mixer.bus;
 
-            while (1)
-            {
-                if (framesRead >= frameCount) break;
+        // Mixing is basically just an accumulation, we need to initialize the bus to 0
+        memset(bus, 0, blockFrameCount*channels*sizeof(float));
 
-                // Just read as much data as we can from the stream
-                ma_uint32 framesToRead = (frameCount - framesRead);
+        // NOTE: Voices are processed from last to first, stopped voices are removed swapping the last one
+        for (int v = AUDIO.Voice.count - 1; v >= 0; v--)
+        {
+            AudioBuffer *audioBuffer = AUDIO.Voice.pool[v];
 
-                while (framesToRead > 0)
-                {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
-
-                    ma_uint32 framesToReadRightNow = framesToRead;
-                    if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
-                    {
-                        framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
-                    }
-
-                    ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
-                    if (framesJustRead > 0)
-                    {
-                        float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
-                        float *framesIn = tempBuffer;
-
-                        // Apply processors chain if defined
-                        rAudioProcessor *processor = audioBuffer->processor;
-                        while (processor)
-                        {
-                            processor->process(framesIn, framesJustRead);
-                            processor = processor->next;
-                        }
-
-                        MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
-
-                        framesToRead -= framesJustRead;
-                        framesRead += framesJustRead;
-                    }
-
-                    if (!audioBuffer->playing)
-                    {
-                        framesRead = frameCount;
-                        break;
-                    }
-
-                    // If we weren't able to read all the frames we requested, break
-                    if (framesJustRead < framesToReadRightNow)
-                    {
-                        if (!audioBuffer->looping)
-                        {
-                            StopAudioBufferInLockedState(audioBuffer);
-                            break;
-                        }
-                        else
-                        {
-                            // Should never get here, but just for safety,
-                            // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
-                            continue;
-                        }
-                    }
-                }
+            // Ignore stopped or paused sounds
+            if (!ma_atomic_load_32(&audioBuffer->playing) || ma_atomic_load_32(&audioBuffer->paused)) continue;
 
-                // If for some reason we weren't able to read every frame we'll need to break from the loop
-                // Not doing this could theoretically put us into an infinite loop
-                if (framesToRead > 0) break;
-            }
+            // Virtual voices just advance their cursor
+            if (audioBuffer->isVirtual) AdvanceAudioVoice(audioBuffer, blockFrameCount);
+            else MixAudioBuffer(audioBuffer, bus, blockFrameCount);
         }
-    }
 
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
-    while (processor)
-    {
-        processor->process(pFramesOut, frameCount);
-        processor = processor->next;
-    }
+        rAudioProcessor *processor = AUDIO.mixedProcessor;
+        while (processor)
+        {
+            processor->process(bus, blockFrameCount);
+            processor = processor->next;
+        }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+        if (pDevice->playback.format != ma_format_f32)
+        {
+            ma_pcm_convert((unsigned char *)pFramesOut + blockFrame*frameSizeInBytes, pDevice->playback.format, bus, ma_format_f32, blockFrameCount*channels, ma_dither_mode_none);
+        }
+    }
 }
 
-// Main mixing function, pretty simple in this project, just an accumulation
-// NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
-static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
+// Mix audio buffer block into mixing bus
+// NOTE: Float device format buffers (i.e. Sound) never pitched, without callback or processors, are mixed directly from
+// buffer data, other buffers are converted to mixing format first, frameCount must be <= AUDIO_MIX_BLOCK_SIZE
+static void MixAudioBuffer(AudioBuffer *buffer, float *framesOut, ma_uint32 frameCount)
 {
-    const float localVolume = buffer->volume;
     const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    const bool isSpatial = ma_atomic_load_32(&buffer->isSpatial);
+    const float volume = GetAudioBufferMixVolume(buffer);
+    float levels[2] = { volume, volume };
 
     if (channels == 2)  // We consider panning
     {
-        const float left = buffer->pan;
+        const float left = isSpatial? buffer->spatialPan : ma_atomic_load_f32(&buffer->pan);
         const float right = 1.0f - left;
 
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
-        const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
+        levels[0] = volume*0.5f*left*(3.0f - left*left);
+        levels[1] = volume*0.5f*right*(3.0f - right*right);
+    }
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+    // Volume and pan changes are ramped along the block to avoid zipper noise,
+    // new voices start directly at the required levels
+    if (buffer->mixLevels[0] < 0.0f)
+    {
+        buffer->mixLevels[0] = levels[0];
+        buffer->mixLevels[1] = levels[1];
+    }
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+    buffer->mixLevelsStep[0] = (levels[0] - buffer->mixLevels[0])/(float)frameCount;
+    buffer->mixLevelsStep[1] = (levels[1] - buffer->mixLevels[1])/(float)frameCount;
 
-            frameOut += 2;
-            frameIn += 2;
-        }
-    }
-    else  // We do not consider panning
+    ma_uint32 framesRead = 0;
+
+    if (IsAudioBufferMixedDirectly(buffer)) framesRead = ReadAudioBufferFramesInInternalFormat(buffer, framesOut, frameCount, true);
+    else
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
+        float *framesIn = AUDIO.Mixer.frames;
+
+        framesRead = ReadAudioBufferFramesInMixingFormat(buffer, framesIn, frameCount);
+
+        if (framesRead > 0)
         {
-            for (ma_uint32 c = 0; c < channels; c++)
+            // Apply processors chain if defined
+            rAudioProcessor *processor = buffer->processor;
+            while (processor)
             {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
-
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
+                processor->process(framesIn, framesRead);
+                processor = processor->next;
             }
+
+            MixAudioFrames(framesOut, framesIn, framesRead, buffer);
         }
     }
-}
 
-// Check if an audio buffer is playing, assuming the audio system mutex has been locked
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
-{
-    bool result = false;
+    buffer->mixLevels[0] = levels[0];
+    buffer->mixLevels[1] = levels[1];
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
-
-    return result;
-}
+    // If we weren't able to read all the frames we requested, sound has finished
+    if ((framesRead < frameCount) && ma_atomic_load_32(&buffer->playing))
+    {
+        if (!buffer->looping) StopAudioBufferInMixer(buffer);
+        else ma_atomic_store_32(&buffer->frameCursorPos, 0);    // Should never get here, but just for safety
+    }
 
-// Stop an audio buffer, assuming the audio system mutex has been locked
-static void StopAudioBufferInLockedState(AudioBuffer *buffer)
-{
-    if (buffer != NULL)
+    // Stream has ended, queued buffer starts right after its latest frame, on the same block
+    // NOTE: Ended stream voice has been released, queued buffer never steals a voice
+    if ((framesRead < frameCount) && (buffer->queued != NULL) && !ma_atomic_load_32(&buffer->playing))
     {
-        if (IsAudioBufferPlayingInLockedState(buffer))
+        AudioBuffer *queued = buffer->queued;
+        buffer->queued = NULL;
+
+        if (PlayAudioBufferInMixer(queued) && !ma_atomic_load_32(&queued->paused))
         {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
+            MixAudioBuffer(queued, framesOut + framesRead*AUDIO.System.device.playback.channels, frameCount - framesRead);
         }
     }
 }
 
-// Update audio stream, assuming the audio system mutex has been locked
-static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount)
+#if defined(SUPPORT_FILEFORMAT_QOA)
+// Load QOA decoder for audio buffer data, including decoded frame samples
+static AudioBufferQOA *LoadAudioBufferQOA(qoa_desc desc, unsigned int dataSize)
 {
-    if (stream.buffer != NULL)
+    unsigned int frameLength = (desc.samples < QOA_FRAME_LEN)? desc.samples : QOA_FRAME_LEN;
+    AudioBufferQOA *decoder = (AudioBufferQOA *)RL_CALLOC(1, sizeof(AudioBufferQOA) + frameLength*desc.channels*sizeof(short));
+
+    if (decoder != NULL)
     {
-        if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
-        {
-            ma_uint32 subBufferToUpdate = 0;
+        decoder->desc = desc;
+        decoder->dataSize = dataSize;
+        decoder->frameSize = qoa_max_frame_size(&desc);
+        decoder->frameIndex = -1;
+        decoder->frame = (short *)(decoder + 1);
+    }
 
-            if (stream.buffer->isSubBufferProcessed[0] && stream.buffer->isSubBufferProcessed[1])
-            {
-                // Both buffers are available for updating
-                // Update the first one and make sure the cursor is moved back to the front
-                subBufferToUpdate = 0;
-                stream.buffer->frameCursorPos = 0;
+    return decoder;
+}
+
+// Decode audio buffer QOA frame at cursor position, returns decoded frames at cursor
+// NOTE: Requested frameCount is limited to the frames available in the decoded frame
+static const unsigned char *DecodeAudioBufferQOA(AudioBuffer *buffer, ma_uint32 frameCursorPos, ma_uint32 *frameCount)
+{
+    AudioBufferQOA *decoder = (AudioBufferQOA *)buffer->decoder;
+    int frameIndex = frameCursorPos/QOA_FRAME_LEN;
+    unsigned int frameStart = frameIndex*QOA_FRAME_LEN;
+    unsigned int frameLength = buffer->sizeInFrames - frameStart;
+    if (frameLength > QOA_FRAME_LEN) frameLength = QOA_FRAME_LEN;
+
+    if (frameIndex != decoder->frameIndex)
+    {
+        unsigned int offset = 8 + frameIndex*decoder->frameSize;    // File header + complete frames
+        unsigned int decodedLength = 0;
+
+        if (offset < decoder->dataSize) qoa_decode_frame(buffer->data + offset, decoder->dataSize - offset, &decoder->desc, decoder->frame, &decodedLength);
+
+        // Corrupted frames are played as silence
+        if (decodedLength < frameLength) memset(decoder->frame + decodedLength*decoder->desc.channels, 0, (frameLength - decodedLength)*decoder->desc.channels*sizeof(short));
+
+        decoder->frameIndex = frameIndex;
+    }
+
+    unsigned int framesAvailable = frameLength - (frameCursorPos - frameStart);
+    if (*frameCount > framesAvailable) *frameCount = framesAvailable;
+
+    return (const unsigned char *)(decoder->frame + (frameCursorPos - frameStart)*decoder->desc.channels);
+}
+#endif
+
+// Check if audio buffer data can be mixed directly, without conversion
+// NOTE: Once pitched, buffer keeps running through converter to keep its resampling state
+static bool IsAudioBufferMixedDirectly(AudioBuffer *buffer)
+{
+    return ((buffer->callback == NULL) && (buffer->processor == NULL) && (buffer->decoder == NULL) && !buffer->isResampled &&
+            (buffer->converter.formatIn == ma_format_f32) && (buffer->converter.channelsIn == AUDIO.System.device.playback.channels) &&
+            (buffer->converter.sampleRateIn == buffer->converter.sampleRateOut));
+}
+
+// Main mixing function, pretty simple in this project, just an accumulation
+// NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
+// Levels are interleaved per channel: on stereo output left/right levels apply to even/odd samples,
+// otherwise both levels are the buffer volume, levels ramp is advanced by the mixed frames
+static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
+{
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    const ma_uint32 sampleCount = frameCount*channels;
+    float *levels = buffer->mixLevels;
+    const float *steps = buffer->mixLevelsStep;
+
+    if ((steps[0] != 0.0f) || (steps[1] != 0.0f))
+    {
+        // Ramp levels, only required on the block following a volume or pan change
+        if (channels == 2)
+        {
+            for (ma_uint32 i = 0; i < sampleCount; i += 2)
+            {
+                framesOut[i] += framesIn[i]*levels[0];
+                framesOut[i + 1] += framesIn[i + 1]*levels[1];
+
+                levels[0] += steps[0];
+                levels[1] += steps[1];
             }
-            else
+        }
+        else
+        {
+            for (ma_uint32 i = 0; i < sampleCount; i += channels)
             {
-                // Just update whichever sub-buffer is processed
-                subBufferToUpdate = (stream.buffer->isSubBufferProcessed[0])? 0 : 1;
+                for (ma_uint32 c = 0; c < channels; c++) framesOut[i + c] += framesIn[i + c]*levels[0];
+
+                levels[0] += steps[0];
             }
+        }
 
-            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
-            unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
+        return;
+    }
 
-            // Total frames processed in buffer is always the complete size, filled with 0 if required
-            stream.buffer->framesProcessed += subBufferSizeInFrames;
+    // Constant levels: samples are processed as a flat array, levels pattern repeats every 2 samples
+    // NOTE: Unaligned loads/stores, mixing bus and buffer data alignment is not guaranteed
+    const float left = levels[0];
+    const float right = (channels == 2)? levels[1] : levels[0];
+    ma_uint32 i = 0;
 
-            // Does this API expect a whole buffer to be updated in one go?
-            // Assuming so, but if not will need to change this logic
-            if (subBufferSizeInFrames >= (ma_uint32)frameCount)
+#if defined(RAUDIO_SIMD_AVX)
+    const __m256 levels8 = _mm256_setr_ps(left, right, left, right, left, right, left, right);
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        _mm256_storeu_ps(framesOut + i, _mm256_add_ps(_mm256_loadu_ps(framesOut + i), _mm256_mul_ps(_mm256_loadu_ps(framesIn + i), levels8)));
+    }
+#elif defined(RAUDIO_SIMD_SSE)
+    const __m128 levels4 = _mm_setr_ps(left, right, left, right);
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        _mm_storeu_ps(framesOut + i, _mm_add_ps(_mm_loadu_ps(framesOut + i), _mm_mul_ps(_mm_loadu_ps(framesIn + i), levels4)));
+        _mm_storeu_ps(framesOut + i + 4, _mm_add_ps(_mm_loadu_ps(framesOut + i + 4), _mm_mul_ps(_mm_loadu_ps(framesIn + i + 4), levels4)));
+    }
+#elif defined(RAUDIO_SIMD_NEON)
+    const float levelsPattern[4] = { left, right, left, right };
+    const float32x4_t levels4 = vld1q_f32(levelsPattern);
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        vst1q_f32(framesOut + i, vmlaq_f32(vld1q_f32(framesOut + i), vld1q_f32(framesIn + i), levels4));
+        vst1q_f32(framesOut + i + 4, vmlaq_f32(vld1q_f32(framesOut + i + 4), vld1q_f32(framesIn + i + 4), levels4));
+    }
+#endif
+
+    // Scalar fallback and remaining samples, i is always even at this point
+    for (; (i + 2) <= sampleCount; i += 2)
+    {
+        framesOut[i] += framesIn[i]*left;
+        framesOut[i + 1] += framesIn[i + 1]*right;
+    }
+    if (i < sampleCount) framesOut[i] += framesIn[i]*left;
+}
+
+// Start an audio buffer from the beginning
+// NOTE: Paused state is set by the caller, a following pause must be kept
+static bool PlayAudioBufferInMixer(AudioBuffer *buffer)
+{
+    if ((buffer->voiceIndex >= 0) || AddAudioVoice(buffer))
+    {
+        ma_atomic_store_32(&buffer->playing, MA_TRUE);
+        ma_atomic_store_32(&buffer->frameCursorPos, 0);
+        buffer->voiceOrder = AUDIO.Voice.order++;
+        buffer->mixLevels[0] = -1.0f;   // Start at required levels, no ramp
+
+        // Resampler keeps one frame as history, it is primed with the first frame to start without latency
+        if (!IsAudioBufferMixedDirectly(buffer) && (buffer->callback == NULL))
+        {
+            ma_uint8 frameIn[MA_MAX_CHANNELS*sizeof(float)] = { 0 };
+            ma_uint64 frameCountIn = ReadAudioBufferFramesInInternalFormat(buffer, frameIn, 1, false);
+            ma_uint64 frameCountOut = AUDIO_MIX_BLOCK_SIZE;
+
+            ma_data_converter_process_pcm_frames(&buffer->converter, frameIn, &frameCountIn, AUDIO.Mixer.frames, &frameCountOut);
+        }
+
+        return true;
+    }
+
+    ma_atomic_store_32(&buffer->playing, MA_FALSE);   // No voice available
+
+    return false;
+}
+
+// Stop an audio buffer and reset its state
+// NOTE: Only called on the audio thread (or when no audio thread is running)
+static void StopAudioBufferInMixer(AudioBuffer *buffer)
+{
+    if (buffer != NULL)
+    {
+        ma_atomic_store_32(&buffer->playing, MA_FALSE);
+        ma_atomic_store_32(&buffer->paused, MA_FALSE);
+        ma_atomic_store_32(&buffer->frameCursorPos, 0);
+        ma_atomic_store_32(&buffer->framesProcessed, 0);
+        ma_atomic_store_32(&buffer->streamEnd, AUDIO_STREAM_NO_END);
+        for (unsigned int i = 0; i < buffer->subBufferCount; i++) ma_atomic_store_explicit_32(&buffer->isSubBufferProcessed[i], MA_TRUE, ma_atomic_memory_order_release);
+
+        RemoveAudioVoice(buffer);
+    }
+}
+
+// Set audio buffer converter rate for pitch
+// NOTE: Only called on the audio thread, pitch includes doppler factor for spatial buffers
+static void SetAudioBufferPitchInMixer(AudioBuffer *buffer, float pitch)
+{
+    // Pitching is just an adjustment of the sample rate
+    // Note that this changes the duration of the sound:
+    //  - higher pitches will make the sound faster
+    //  - lower pitches make it slower
+    ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
+    ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+
+    // Switching from direct mixing, converter has no history: prime it with the frames preceding cursor
+    if (IsAudioBufferMixedDirectly(buffer) && (pitch != 1.0f))
+    {
+        if ((buffer->voiceIndex >= 0) && (buffer->usage == AUDIO_BUFFER_USAGE_STATIC))
+        {
+            ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(buffer->converter.formatIn, buffer->converter.channelsIn);
+            ma_uint32 frameCursorPos = buffer->frameCursorPos;
+            ma_uint64 frameCountIn = (frameCursorPos < 32)? frameCursorPos : 32;
+            ma_uint64 frameCountOut = AUDIO_MIX_BLOCK_SIZE;
+
+            ma_data_converter_process_pcm_frames(&buffer->converter, buffer->data + (frameCursorPos - frameCountIn)*frameSizeInBytes, &frameCountIn, AUDIO.Mixer.frames, &frameCountOut);
+        }
+
+        buffer->isResampled = true;
+    }
+
+    buffer->mixPitch = pitch;
+}
+
+// Add buffer to voices pool
+// NOTE: If pool is full, least important voice is stolen if its priority is not higher than buffer priority,
+// returns false if no voice is available
+static bool AddAudioVoice(AudioBuffer *buffer)
+{
+    buffer->voiceOrder = AUDIO.Voice.order++;
+
+    if (AUDIO.Voice.count >= MAX_AUDIO_VOICES)
+    {
+        int candidate = 0;
+
+        for (int i = 1; i < AUDIO.Voice.count; i++)
+        {
+            if (CompareAudioVoices(AUDIO.Voice.pool[i], AUDIO.Voice.pool[candidate]) < 0) candidate = i;
+        }
+
+        AudioBuffer *stolen = AUDIO.Voice.pool[candidate];
+
+        // Audio streams are never stolen
+        if ((stolen->usage == AUDIO_BUFFER_USAGE_STREAM) ||
+            (ma_atomic_load_i32(&stolen->priority) > ma_atomic_load_i32(&buffer->priority))) return false;
+
+        StopAudioBufferInMixer(stolen);
+    }
+
+    buffer->voiceIndex = AUDIO.Voice.count;
+    buffer->isVirtual = false;
+    AUDIO.Voice.pool[AUDIO.Voice.count] = buffer;
+    AUDIO.Voice.count++;
+
+    return true;
+}
+
+// Remove buffer from voices pool
+static void RemoveAudioVoice(AudioBuffer *buffer)
+{
+    int index = buffer->voiceIndex;
+
+    if (index >= 0)
+    {
+        // Move last voice to the removed position
+        AUDIO.Voice.count--;
+        AUDIO.Voice.pool[index] = AUDIO.Voice.pool[AUDIO.Voice.count];
+        AUDIO.Voice.pool[index]->voiceIndex = index;
+        AUDIO.Voice.pool[AUDIO.Voice.count] = NULL;
+
+        buffer->voiceIndex = -1;
+        buffer->isVirtual = false;
+    }
+}
+
+// Get audio buffer volume including spatial attenuation
+// NOTE: Spatial attenuation is only updated on the audio thread
+static float GetAudioBufferMixVolume(const AudioBuffer *buffer)
+{
+    float volume = ma_atomic_load_f32((float *)&buffer->volume);
+
+    if (ma_atomic_load_32((ma_bool32 *)&buffer->isSpatial)) volume *= buffer->spatialGain;
+
+    return volume;
+}
+
+// Compare voices importance, returns positive if voice a is more important than voice b
+// NOTE: Order: audio streams, higher priority, louder, newer
+static int CompareAudioVoices(const AudioBuffer *a, const AudioBuffer *b)
+{
+    if (a->usage != b->usage) return (a->usage == AUDIO_BUFFER_USAGE_STREAM)? 1 : -1;
+
+    int priorityA = ma_atomic_load_i32((ma_int32 *)&a->priority);
+    int priorityB = ma_atomic_load_i32((ma_int32 *)&b->priority);
+    if (priorityA != priorityB) return (priorityA > priorityB)? 1 : -1;
+
+    float volumeA = ma_atomic_load_32((ma_bool32 *)&a->paused)? -1.0f : GetAudioBufferMixVolume(a);
+    float volumeB = ma_atomic_load_32((ma_bool32 *)&b->paused)? -1.0f : GetAudioBufferMixVolume(b);
+    if (volumeA != volumeB) return (volumeA > volumeB)? 1 : -1;
+
+    if (a->voiceOrder != b->voiceOrder) return ((int)(a->voiceOrder - b->voiceOrder) > 0)? 1 : -1;
+
+    return 0;
+}
+
+// Compute spatial voices attenuation, pan and doppler from listener
+// NOTE: Called once per device callback, voices are gathered in listener space into padded arrays, distances,
+// pan and doppler factors are computed for 4 voices at a time, attenuation models are applied per voice
+static void UpdateAudioSpatial(void)
+{
+    if (AUDIO.Voice.count == 0) return;
+
+    float position[3] = { 0 };
+    float forward[3] = { 0 };
+    float up[3] = { 0 };
+    float velocity[3] = { 0 };
+
+    for (int i = 0; i < 3; i++)
+    {
+        position[i] = ma_atomic_load_f32(&AUDIO.Listener.position[i]);
+        forward[i] = ma_atomic_load_f32(&AUDIO.Listener.forward[i]);
+        up[i] = ma_atomic_load_f32(&AUDIO.Listener.up[i]);
+        velocity[i] = ma_atomic_load_f32(&AUDIO.Listener.velocity[i]);
+    }
+
+    // Listener basis: right = forward x up, up = right x forward
+    float length = sqrtf(forward[0]*forward[0] + forward[1]*forward[1] + forward[2]*forward[2]);
+    if (length > 0.0f) { forward[0] /= length; forward[1] /= length; forward[2] /= length; }
+    else { forward[0] = 0.0f; forward[1] = 0.0f; forward[2] = -1.0f; }
+
+    float right[3] = {
+        forward[1]*up[2] - forward[2]*up[1],
+        forward[2]*up[0] - forward[0]*up[2],
+        forward[0]*up[1] - forward[1]*up[0]
+    };
+
+    length = sqrtf(right[0]*right[0] + right[1]*right[1] + right[2]*right[2]);
+    if (length > 0.0f) { right[0] /= length; right[1] /= length; right[2] /= length; }
+    else { right[0] = -forward[2]; right[1] = 0.0f; right[2] = forward[0]; }  // Up parallel to forward, use horizontal right
+
+    up[0] = right[1]*forward[2] - right[2]*forward[1];
+    up[1] = right[2]*forward[0] - right[0]*forward[2];
+    up[2] = right[0]*forward[1] - right[1]*forward[0];
+
+    // Gather spatial voices, non-spatial voices get back their pitch without doppler
+    int count = 0;
+
+    for (int i = 0; i < AUDIO.Voice.count; i++)
+    {
+        AudioBuffer *buffer = AUDIO.Voice.pool[i];
+
+        if (!ma_atomic_load_32(&buffer->isSpatial))
+        {
+            if (buffer->doppler != 1.0f)
             {
-                ma_uint32 framesToWrite = (ma_uint32)frameCount;
+                buffer->doppler = 1.0f;
+                SetAudioBufferPitchInMixer(buffer, buffer->pitch);
+            }
 
-                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
-                memcpy(subBuffer, data, bytesToWrite);
+            continue;
+        }
 
-                // Any leftover frames should be filled with zeros
-                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+        float delta[3] = { 0 };
+        float speed[3] = { 0 };
 
-                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+        for (int k = 0; k < 3; k++)
+        {
+            delta[k] = ma_atomic_load_f32(&buffer->position[k]) - position[k];
+            speed[k] = ma_atomic_load_f32(&buffer->velocity[k]);
+        }
+
+        AUDIO.Spatial.voices[count] = buffer;
+        AUDIO.Spatial.x[count] = delta[0]*right[0] + delta[1]*right[1] + delta[2]*right[2];
+        AUDIO.Spatial.y[count] = delta[0]*up[0] + delta[1]*up[1] + delta[2]*up[2];
+        AUDIO.Spatial.z[count] = delta[0]*forward[0] + delta[1]*forward[1] + delta[2]*forward[2];
+        AUDIO.Spatial.sourceSpeed[count] = delta[0]*speed[0] + delta[1]*speed[1] + delta[2]*speed[2];
+        AUDIO.Spatial.listenerSpeed[count] = delta[0]*velocity[0] + delta[1]*velocity[1] + delta[2]*velocity[2];
+        count++;
+    }
 
-                stream.buffer->isSubBufferProcessed[subBufferToUpdate] = false;
+    if (count == 0) return;
+
+    // Pad arrays to a multiple of 4 voices
+    for (int i = count; i < ((count + 3) & ~3); i++)
+    {
+        AUDIO.Spatial.x[i] = 0.0f;
+        AUDIO.Spatial.y[i] = 0.0f;
+        AUDIO.Spatial.z[i] = 0.0f;
+        AUDIO.Spatial.sourceSpeed[i] = 0.0f;
+        AUDIO.Spatial.listenerSpeed[i] = 0.0f;
+    }
+
+    // Distance, pan and doppler: distance = |d|, pan = 0.5 - 0.5*x/|d|,
+    // doppler = (c + vl.d/|d|)/(c + vs.d/|d|), with source velocity vs and listener velocity vl
+    const float c = AUDIO_SPEED_OF_SOUND;
+    int i = 0;
+
+#if defined(RAUDIO_SIMD_AVX) || defined(RAUDIO_SIMD_SSE)
+    const __m128 minDistance4 = _mm_set1_ps(0.0001f);
+    const __m128 minSpeed4 = _mm_set1_ps(0.001f*c);
+    const __m128 c4 = _mm_set1_ps(c);
+    const __m128 half4 = _mm_set1_ps(0.5f);
+    const __m128 minDoppler4 = _mm_set1_ps(0.5f);
+    const __m128 maxDoppler4 = _mm_set1_ps(2.0f);
+    for (; i < count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(AUDIO.Spatial.x + i);
+        __m128 y = _mm_loadu_ps(AUDIO.Spatial.y + i);
+        __m128 z = _mm_loadu_ps(AUDIO.Spatial.z + i);
+        __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+        __m128 invDistance = _mm_div_ps(_mm_set1_ps(1.0f), _mm_max_ps(distance, minDistance4));
+        __m128 num = _mm_max_ps(_mm_add_ps(c4, _mm_mul_ps(_mm_loadu_ps(AUDIO.Spatial.listenerSpeed + i), invDistance)), minSpeed4);
+        __m128 den = _mm_max_ps(_mm_add_ps(c4, _mm_mul_ps(_mm_loadu_ps(AUDIO.Spatial.sourceSpeed + i), invDistance)), minSpeed4);
+
+        _mm_storeu_ps(AUDIO.Spatial.distance + i, distance);
+        _mm_storeu_ps(AUDIO.Spatial.pan + i, _mm_sub_ps(half4, _mm_mul_ps(half4, _mm_mul_ps(x, invDistance))));
+        _mm_storeu_ps(AUDIO.Spatial.doppler + i, _mm_min_ps(_mm_max_ps(_mm_div_ps(num, den), minDoppler4), maxDoppler4));
+    }
+#elif defined(RAUDIO_SIMD_NEON)
+    const float32x4_t minSquared4 = vdupq_n_f32(0.0001f*0.0001f);
+    const float32x4_t minSpeed4 = vdupq_n_f32(0.001f*c);
+    const float32x4_t c4 = vdupq_n_f32(c);
+    const float32x4_t half4 = vdupq_n_f32(0.5f);
+    const float32x4_t minDoppler4 = vdupq_n_f32(0.5f);
+    const float32x4_t maxDoppler4 = vdupq_n_f32(2.0f);
+    for (; i < count; i += 4)
+    {
+        float32x4_t x = vld1q_f32(AUDIO.Spatial.x + i);
+        float32x4_t y = vld1q_f32(AUDIO.Spatial.y + i);
+        float32x4_t z = vld1q_f32(AUDIO.Spatial.z + i);
+        float32x4_t squared = vmaxq_f32(vmlaq_f32(vmlaq_f32(vmulq_f32(x, x), y, y), z, z), minSquared4);
+
+        // Reciprocal square root and reciprocal estimates, refined with two Newton-Raphson steps
+        float32x4_t invDistance = vrsqrteq_f32(squared);
+        invDistance = vmulq_f32(invDistance, vrsqrtsq_f32(vmulq_f32(squared, invDistance), invDistance));
+        invDistance = vmulq_f32(invDistance, vrsqrtsq_f32(vmulq_f32(squared, invDistance), invDistance));
+
+        float32x4_t num = vmaxq_f32(vmlaq_f32(c4, vld1q_f32(AUDIO.Spatial.listenerSpeed + i), invDistance), minSpeed4);
+        float32x4_t den = vmaxq_f32(vmlaq_f32(c4, vld1q_f32(AUDIO.Spatial.sourceSpeed + i), invDistance), minSpeed4);
+        float32x4_t invDen = vrecpeq_f32(den);
+        invDen = vmulq_f32(invDen, vrecpsq_f32(den, invDen));
+        invDen = vmulq_f32(invDen, vrecpsq_f32(den, invDen));
+
+        vst1q_f32(AUDIO.Spatial.distance + i, vmulq_f32(squared, invDistance));
+        vst1q_f32(AUDIO.Spatial.pan + i, vmlsq_f32(half4, half4, vmulq_f32(x, invDistance)));
+        vst1q_f32(AUDIO.Spatial.doppler + i, vminq_f32(vmaxq_f32(vmulq_f32(num, invDen), minDoppler4), maxDoppler4));
+    }
+#endif
+
+    // Scalar fallback
+    for (; i < count; i++)
+    {
+        float x = AUDIO.Spatial.x[i];
+        float y = AUDIO.Spatial.y[i];
+        float z = AUDIO.Spatial.z[i];
+        float distance = sqrtf(x*x + y*y + z*z);
+        float invDistance = 1.0f/((distance > 0.0001f)? distance : 0.0001f);
+        float num = c + AUDIO.Spatial.listenerSpeed[i]*invDistance;
+        float den = c + AUDIO.Spatial.sourceSpeed[i]*invDistance;
+        float doppler = ((num > 0.001f*c)? num : 0.001f*c)/((den > 0.001f*c)? den : 0.001f*c);
+
+        AUDIO.Spatial.distance[i] = distance;
+        AUDIO.Spatial.pan[i] = 0.5f - 0.5f*x*invDistance;
+        AUDIO.Spatial.doppler[i] = (doppler < 0.5f)? 0.5f : ((doppler > 2.0f)? 2.0f : doppler);
+    }
+
+    // Attenuation models and doppler pitch, converter rate is only updated on noticeable changes
+    for (i = 0; i < count; i++)
+    {
+        AudioBuffer *buffer = AUDIO.Spatial.voices[i];
+        float minDistance = ma_atomic_load_f32(&buffer->minDistance);
+        float maxDistance = ma_atomic_load_f32(&buffer->maxDistance);
+        float rolloff = ma_atomic_load_f32(&buffer->rolloff);
+        float distance = AUDIO.Spatial.distance[i];
+        float gain = 1.0f;
+
+        if (distance < minDistance) distance = minDistance;
+        else if (distance > maxDistance) distance = maxDistance;
+
+        switch (ma_atomic_load_i32(&buffer->attenuation))
+        {
+            case AUDIO_ATTENUATION_INVERSE: gain = minDistance/(minDistance + rolloff*(distance - minDistance)); break;
+            case AUDIO_ATTENUATION_LINEAR:
+            {
+                gain = (maxDistance > minDistance)? 1.0f - rolloff*(distance - minDistance)/(maxDistance - minDistance) : 1.0f;
+                if (gain < 0.0f) gain = 0.0f;
+            } break;
+            case AUDIO_ATTENUATION_EXPONENTIAL: gain = powf(distance/minDistance, -rolloff); break;
+            default: break;
+        }
+
+        buffer->spatialGain = gain;
+        buffer->spatialPan = AUDIO.Spatial.pan[i];
+        buffer->doppler = AUDIO.Spatial.doppler[i];
+
+        float pitch = buffer->pitch*buffer->doppler;
+        if (fabsf(pitch - buffer->mixPitch) > 0.0005f*buffer->mixPitch) SetAudioBufferPitchInMixer(buffer, pitch);
+    }
+}
+
+// Select virtual voices: voices beyond max mixed count or inaudible
+// NOTE: Pool is sorted by importance, it is small and mostly sorted from previous call
+static void UpdateAudioVoices(void)
+{
+    for (int i = 1; i < AUDIO.Voice.count; i++)
+    {
+        AudioBuffer *voice = AUDIO.Voice.pool[i];
+        int j = i - 1;
+
+        for (; (j >= 0) && (CompareAudioVoices(voice, AUDIO.Voice.pool[j]) > 0); j--)
+        {
+            AUDIO.Voice.pool[j + 1] = AUDIO.Voice.pool[j];
+            AUDIO.Voice.pool[j + 1]->voiceIndex = j + 1;
+        }
+
+        AUDIO.Voice.pool[j + 1] = voice;
+        voice->voiceIndex = j + 1;
+    }
+
+    int maxMixed = ma_atomic_load_i32(&AUDIO.Voice.maxMixed);
+    int mixedCount = 0;
+
+    for (int i = 0; i < AUDIO.Voice.count; i++)
+    {
+        AudioBuffer *voice = AUDIO.Voice.pool[i];
+        bool wasVirtual = voice->isVirtual;
+
+        // Audio streams and callback buffers must be processed to keep consuming data
+        if ((voice->usage == AUDIO_BUFFER_USAGE_STREAM) || (voice->callback != NULL)) voice->isVirtual = false;
+        else voice->isVirtual = ((GetAudioBufferMixVolume(voice) <= 0.0f) || (mixedCount >= maxMixed));
+
+        if (!voice->isVirtual && !ma_atomic_load_32(&voice->paused)) mixedCount++;
+
+        // Converter keeps resampling history, clear it when voice gets real again
+        if (wasVirtual && !voice->isVirtual) ma_data_converter_reset(&voice->converter);
+    }
+}
+
+// Advance virtual voice cursor without reading or mixing data
+static void AdvanceAudioVoice(AudioBuffer *buffer, ma_uint32 frameCount)
+{
+    ma_uint64 inputFrameCount = 0;
+    ma_data_converter_get_required_input_frame_count(&buffer->converter, frameCount, &inputFrameCount);
+
+    ma_uint64 frameCursorPos = buffer->frameCursorPos + inputFrameCount;
+
+    if (frameCursorPos >= buffer->sizeInFrames)
+    {
+        if (!buffer->looping)
+        {
+            StopAudioBufferInMixer(buffer);
+            return;
+        }
+
+        frameCursorPos %= buffer->sizeInFrames;
+    }
+
+    ma_atomic_store_32(&buffer->frameCursorPos, (ma_uint32)frameCursorPos);
+}
+
+// Decode music frames into processed stream sub-buffers
+// NOTE: Returns false when the latest frames have been decoded (not looping), looping music jumps from loop end
+// to loop start, decoders and pcmBuffer are shared with the decoding thread, music decoder must be locked
+static bool DecodeMusicStream(Music music)
+{
+    AudioBuffer *buffer = music.stream.buffer;
+
+    // Latest frames already queued, audio thread stops the stream after playing them
+    if (ma_atomic_load_32(&buffer->streamEnd) != AUDIO_STREAM_NO_END) return false;
+
+    unsigned int subBufferSizeInFrames = buffer->sizeInFrames/buffer->subBufferCount;
+
+    // On first call of this function we lazily pre-allocated a temp buffer to read audio files/memory data in
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+    unsigned int pcmSize = subBufferSizeInFrames*frameSize;
+
+    if (AUDIO.System.pcmBufferSize < pcmSize)
+    {
+        RL_FREE(AUDIO.System.pcmBuffer);
+        AUDIO.System.pcmBuffer = RL_CALLOC(1, pcmSize);
+        AUDIO.System.pcmBufferSize = pcmSize;
+    }
+
+    // Loop points are only valid inside the music, loop end 0 is end of music
+    unsigned int loopEnd = ((buffer->musicLoopEnd > 0) && (buffer->musicLoopEnd < music.frameCount))? buffer->musicLoopEnd : music.frameCount;
+    unsigned int loopStart = (buffer->musicLoopStart < loopEnd)? buffer->musicLoopStart : 0;
+
+    // Check all sub-buffers to check if they require refilling
+    for (unsigned int i = 0; i < buffer->subBufferCount; i++)
+    {
+        if (!IsAudioStreamProcessed(music.stream)) break; // No refilling required
+
+        unsigned int framesToStream = 0;    // Total frames to be streamed
+        unsigned int emptyReads = 0;        // Consecutive reads without data, decoder can not provide more frames
+        bool isEnded = false;
+
+        while ((framesToStream < subBufferSizeInFrames) && (emptyReads < 2))
+        {
+            // Music played after loop end (i.e. seeking) continues up to the end of music
+            unsigned int endPos = (music.looping && (buffer->musicCursorPos < loopEnd))? loopEnd : music.frameCount;
+            unsigned int framesToRead = subBufferSizeInFrames - framesToStream;
+            if (framesToRead > (endPos - buffer->musicCursorPos)) framesToRead = endPos - buffer->musicCursorPos;
+
+            unsigned int framesRead = (framesToRead > 0)? ReadMusicFrames(music, (unsigned char *)AUDIO.System.pcmBuffer + framesToStream*frameSize, framesToRead) : 0;
+            framesToStream += framesRead;
+            emptyReads = (framesRead > 0)? 0 : emptyReads + 1;
+
+            if ((framesRead < framesToRead) || (buffer->musicCursorPos >= endPos))
+            {
+                if (!music.looping)
+                {
+                    isEnded = true;
+                    break;
+                }
+
+                SeekMusicDecoder(music, loopStart);
             }
-            else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
         }
-        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+
+        UpdateAudioStreamFrames(music.stream, AUDIO.System.pcmBuffer, framesToStream, isEnded);
+
+        ma_atomic_store_32(&buffer->framesProcessed, buffer->musicCursorPos);
+
+        // Streaming is ending, we filled latest frames from input, decoder is ready to play again
+        if (isEnded)
+        {
+            SeekMusicDecoder(music, 0);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Read music frames at decoder position
+// NOTE: Returns frames read, less than requested at the end of the data, module formats are always generated
+static unsigned int ReadMusicFrames(Music music, void *frames, unsigned int frameCount)
+{
+    unsigned int framesRead = 0;
+
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV:
+        {
+            if (music.stream.sampleSize == 16) framesRead = (unsigned int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCount, (short *)frames);
+            else if (music.stream.sampleSize == 32) framesRead = (unsigned int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCount, (float *)frames);
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: framesRead = (unsigned int)stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)frames, frameCount*music.stream.channels); break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: framesRead = (unsigned int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCount, (float *)frames); break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA: framesRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)frames, frameCount); break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: framesRead = (unsigned int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCount, (short *)frames); break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally we consider 2 channels generation, so sampleCount/2
+            if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)frames, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)frames, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)frames, frameCount);
+            framesRead = frameCount;
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+            jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)frames, frameCount, 0);
+            framesRead = frameCount;
+        } break;
+    #endif
+        default: break;
+    }
+
+    music.stream.buffer->musicCursorPos += framesRead;
+
+    return framesRead;
+}
+
+// Seek music decoder to a frame position
+// NOTE: Seeking is sample-accurate, QOA samples before position are skipped on the decoded QOA frame,
+// module formats have no random access, they are generated from the start up to the position
+static void SeekMusicDecoder(Music music, unsigned int position)
+{
+    if (position > music.frameCount) position = music.frameCount;
+
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, position); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            if (position == 0) stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+            else stb_vorbis_seek((stb_vorbis *)music.ctxData, position);
+        } break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, position); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA:
+        {
+            qoaplay_desc *qoa = (qoaplay_desc *)music.ctxData;
+            qoaplay_seek_frame(qoa, position/QOA_FRAME_LEN);
+
+            unsigned int framesToSkip = position - qoa->sample_position;
+
+            if (framesToSkip > 0)
+            {
+                unsigned int qoaFrameLength = qoaplay_decode_frame(qoa);
+                if (framesToSkip > qoaFrameLength) framesToSkip = qoaFrameLength;
+
+                qoa->sample_data_pos = framesToSkip;
+                qoa->sample_position += framesToSkip;
+            }
+        } break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, position); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            jar_xm_reset((jar_xm_context_t *)music.ctxData);
+
+            float frames[AUDIO_MIX_BLOCK_SIZE*2];   // Discarded frames, modules are generated as stereo
+
+            for (unsigned int i = 0; i < position; i += AUDIO_MIX_BLOCK_SIZE)
+            {
+                unsigned int frameCount = ((position - i) < AUDIO_MIX_BLOCK_SIZE)? (position - i) : AUDIO_MIX_BLOCK_SIZE;
+
+                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, frames, frameCount);
+                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)frames, frameCount);
+                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)frames, frameCount);
+            }
+        } break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+
+            short frames[AUDIO_MIX_BLOCK_SIZE*2];   // Discarded frames, modules are generated as stereo
+
+            for (unsigned int i = 0; i < position; i += AUDIO_MIX_BLOCK_SIZE)
+            {
+                unsigned int frameCount = ((position - i) < AUDIO_MIX_BLOCK_SIZE)? (position - i) : AUDIO_MIX_BLOCK_SIZE;
+                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, frames, frameCount, 0);
+            }
+        } break;
+#endif
+        default: break;
+    }
+
+    music.stream.buffer->musicCursorPos = position;
+}
+
+// Lock music decoders, shared with the decoding thread
+// NOTE: Never taken by the audio thread
+static void LockMusicDecoder(void)
+{
+#if defined(AUDIO_MUSIC_DECODE_THREAD)
+    if (ma_atomic_load_32(&AUDIO.Decoder.running)) ma_mutex_lock(&AUDIO.Decoder.lock);
+#endif
+}
+
+// Unlock music decoders
+static void UnlockMusicDecoder(void)
+{
+#if defined(AUDIO_MUSIC_DECODE_THREAD)
+    if (ma_atomic_load_32(&AUDIO.Decoder.running)) ma_mutex_unlock(&AUDIO.Decoder.lock);
+#endif
+}
+
+#if defined(AUDIO_MUSIC_DECODE_THREAD)
+// Get music stream index in decoding thread list, -1 if not found
+static int GetMusicDecodeIndex(AudioBuffer *buffer)
+{
+    for (int i = 0; i < AUDIO.Decoder.count; i++)
+    {
+        if (AUDIO.Decoder.streams[i].stream.buffer == buffer) return i;
+    }
+
+    return -1;
+}
+
+// Remove music stream from decoding thread list
+static void RemoveMusicDecode(int index)
+{
+    if (index >= 0)
+    {
+        AUDIO.Decoder.count--;
+        AUDIO.Decoder.streams[index] = AUDIO.Decoder.streams[AUDIO.Decoder.count];
+        AUDIO.Decoder.queued[index] = AUDIO.Decoder.queued[AUDIO.Decoder.count];
+    }
+}
+
+// Add music stream to decoding thread list, or refresh it
+static void AddMusicDecode(Music music, bool queued)
+{
+    int index = GetMusicDecodeIndex(music.stream.buffer);
+    if ((index < 0) && (AUDIO.Decoder.count < MAX_AUDIO_MUSIC_STREAMS)) index = AUDIO.Decoder.count++;
+
+    if (index >= 0)
+    {
+        AUDIO.Decoder.streams[index] = music;
+        AUDIO.Decoder.queued[index] = queued;
+    }
+    else TRACELOG(LOG_WARNING, "STREAM: Music decoding thread list is full, UpdateMusicStream() required");
+}
+
+// Decode music streams in decoding thread list
+// NOTE: Called by the decoding thread or by RenderAudioFrames() in offline mode
+static void DecodeMusicStreams(void)
+{
+    for (int i = AUDIO.Decoder.count - 1; i >= 0; i--)
+    {
+        Music music = AUDIO.Decoder.streams[i];
+
+        // Stopped streams are not consumed, decoding waits for PlayMusicStream(),
+        // queued streams are decoded ahead to be started by the audio thread
+        if (!ma_atomic_load_32(&music.stream.buffer->playing) && !AUDIO.Decoder.queued[i]) continue;
+
+        // Latest frames decoded, audio thread stops the stream after playing them
+        if (!DecodeMusicStream(music)) RemoveMusicDecode(i);
+    }
+}
+
+// Music decoding thread, keeps music streams sub-buffers filled ahead of playback
+static ma_thread_result MA_THREADCALL MusicDecodeThread(void *data)
+{
+    (void)data;
+
+    while (ma_atomic_load_32(&AUDIO.Decoder.running))
+    {
+        ma_mutex_lock(&AUDIO.Decoder.lock);
+        DecodeMusicStreams();
+        ma_mutex_unlock(&AUDIO.Decoder.lock);
+
+        ma_sleep(AUDIO_MUSIC_DECODE_PERIOD);
+    }
+
+    return (ma_thread_result)0;
+}
+#endif
+
+// Check if audio thread is mixing concurrently with API calls
+static bool IsAudioMixerRunning(void)
+{
+#if defined(AUDIO_COMMANDS_INLINE)
+    return false;
+#else
+    return (AUDIO.System.isReady && ma_device_is_started(&AUDIO.System.device));
+#endif
+}
+
+// Write command to commands queue, returns false if queue is full
+// NOTE: Lock-free, slot is reserved moving write index and marked as written once filled,
+// audio thread only applies commands up to the first slot not written yet
+static bool WriteAudioCommand(AudioCommand command, ma_uint32 *index)
+{
+    ma_uint32 writeIndex = ma_atomic_load_explicit_32(&AUDIO.Command.writeIndex, ma_atomic_memory_order_relaxed);
+
+    do
+    {
+        if ((writeIndex - ma_atomic_load_explicit_32(&AUDIO.Command.readIndex, ma_atomic_memory_order_acquire)) >= MAX_AUDIO_COMMANDS) return false;
+    } while (!ma_atomic_compare_exchange_weak_explicit_32(&AUDIO.Command.writeIndex, &writeIndex, writeIndex + 1, ma_atomic_memory_order_acq_rel, ma_atomic_memory_order_relaxed));
+
+    AUDIO.Command.queue[writeIndex & (MAX_AUDIO_COMMANDS - 1)] = command;
+    ma_atomic_store_explicit_32(&AUDIO.Command.sequence[writeIndex & (MAX_AUDIO_COMMANDS - 1)], writeIndex + 1, ma_atomic_memory_order_release);
+
+    if (index != NULL) *index = writeIndex;
+
+    return true;
+}
+
+// Push command to the audio thread, returns false on memory allocation failure
+// NOTE: Never blocks, it can be called from audio callbacks, commands are not lost if the queue is full:
+// they are linked to overflow list (and following ones, keeping order) until the audio thread applies them,
+// if no audio thread is running, command is applied right away on the calling thread
+static bool PushAudioCommand(AudioCommand command)
+{
+    bool result = false;
+
+    if (ma_atomic_load_ptr(&AUDIO.Command.overflow) == NULL) result = WriteAudioCommand(command, NULL);
+
+    if (!result)
+    {
+        AudioCommandNode *node = (AudioCommandNode *)RL_MALLOC(sizeof(AudioCommandNode));
+
+        if (node != NULL)
+        {
+            node->command = command;
+            node->next = (AudioCommandNode *)ma_atomic_load_ptr(&AUDIO.Command.overflow);
+            while (!ma_atomic_compare_exchange_strong_ptr(&AUDIO.Command.overflow, &node->next, node)) { }
+            result = true;
+        }
+        else TRACELOG(LOG_WARNING, "AUDIO: Failed to allocate audio command");
+    }
+
+    if (!IsAudioMixerRunning()) ApplyAudioCommands();
+
+    return result;
+}
+
+// Push command and wait for it to be applied on the audio thread
+// NOTE: Only required before releasing or overwriting memory shared with the audio thread,
+// it must not be called from audio callbacks
+static void SendAudioCommand(AudioCommand command)
+{
+    ma_uint32 index = 0;
+
+    // Overflowing commands are applied first, keeping order
+    while ((ma_atomic_load_ptr(&AUDIO.Command.overflow) != NULL) || !WriteAudioCommand(command, &index))
+    {
+        if (!IsAudioMixerRunning()) ApplyAudioCommands();
+        else ma_yield();
+    }
+
+    while ((ma_int32)(ma_atomic_load_explicit_32(&AUDIO.Command.readIndex, ma_atomic_memory_order_acquire) - index) <= 0)
+    {
+        if (!IsAudioMixerRunning()) ApplyAudioCommands();
+#if defined(MA_EMSCRIPTEN)
+        else ma_yield();
+#else
+        else ma_sleep(1);
+#endif
+    }
+}
+
+// Apply queued commands on the calling thread, no audio thread running
+// NOTE: Multiple API threads could apply commands, lock keeps a single consumer
+static void ApplyAudioCommands(void)
+{
+    ma_spinlock_lock(&AUDIO.Command.lock);
+    ProcessAudioCommands();
+    ma_spinlock_unlock(&AUDIO.Command.lock);
+}
+
+// Apply queued commands
+// NOTE: Called at the start of every audio callback, commands are applied in order
+static void ProcessAudioCommands(void)
+{
+    ma_uint32 readIndex = ma_atomic_load_explicit_32(&AUDIO.Command.readIndex, ma_atomic_memory_order_relaxed);
+
+    // Commands are applied up to the first slot reserved by a producer but not written yet
+    for (; ma_atomic_load_explicit_32(&AUDIO.Command.sequence[readIndex & (MAX_AUDIO_COMMANDS - 1)], ma_atomic_memory_order_acquire) == (readIndex + 1); readIndex++)
+    {
+        ExecuteAudioCommand(&AUDIO.Command.queue[readIndex & (MAX_AUDIO_COMMANDS - 1)]);
+
+        ma_atomic_store_explicit_32(&AUDIO.Command.readIndex, readIndex + 1, ma_atomic_memory_order_release);
+    }
+
+    // Overflowing commands are applied once queue is empty, they were pushed after queued ones
+    if ((readIndex == ma_atomic_load_explicit_32(&AUDIO.Command.writeIndex, ma_atomic_memory_order_acquire)) &&
+        (ma_atomic_load_ptr(&AUDIO.Command.overflow) != NULL))
+    {
+        AudioCommandNode *node = (AudioCommandNode *)ma_atomic_exchange_ptr(&AUDIO.Command.overflow, NULL);
+        AudioCommandNode *first = NULL;
+
+        // List is linked latest first, reversed to apply commands in push order
+        while (node != NULL)
+        {
+            AudioCommandNode *next = node->next;
+            node->next = first;
+            first = node;
+            node = next;
+        }
+
+        while (first != NULL)
+        {
+            AudioCommandNode *next = first->next;
+            ExecuteAudioCommand(&first->command);
+            RL_FREE(first);
+            first = next;
+        }
+    }
+}
+
+// Apply one command
+// NOTE: Called by ProcessAudioCommands(), on the audio thread (or when no audio thread is running)
+static void ExecuteAudioCommand(AudioCommand *command)
+{
+    AudioBuffer *buffer = command->buffer;
+
+    switch (command->type)
+    {
+        case AUDIO_COMMAND_PLAY:
+        {
+            // Buffer paused after play request keeps paused
+            if (ma_atomic_exchange_32(&buffer->starting, MA_FALSE)) ma_atomic_store_32(&buffer->paused, MA_FALSE);
+            PlayAudioBufferInMixer(buffer);
+        } break;
+        case AUDIO_COMMAND_STOP:
+        {
+            StopAudioBufferInMixer(buffer);
+            buffer->queued = NULL;      // Stopped stream never ends, queued buffer is dropped
+        } break;
+        case AUDIO_COMMAND_SET_PITCH:
+        {
+            buffer->pitch = command->value;
+            SetAudioBufferPitchInMixer(buffer, buffer->pitch*buffer->doppler);
+        } break;
+        case AUDIO_COMMAND_SET_CALLBACK: buffer->callback = command->callback; break;
+        case AUDIO_COMMAND_TRACK:
+        {
+            // NOTE: Buffer can be the first one of a chain of buffers, linked before tracking (batch loading)
+            AudioBuffer *last = buffer;
+            while (last->next != NULL) last = last->next;
+
+            if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
+            else
+            {
+                AUDIO.Buffer.last->next = buffer;
+                buffer->prev = AUDIO.Buffer.last;
+            }
+
+            AUDIO.Buffer.last = last;
+        } break;
+        case AUDIO_COMMAND_UNTRACK:
+        {
+            RemoveAudioVoice(buffer);
+
+            // Buffer could be not tracked if its track command was dropped
+            if ((buffer->prev == NULL) && (AUDIO.Buffer.first != buffer)) break;
+
+            if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
+            else buffer->prev->next = buffer->next;
+
+            if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
+            else buffer->next->prev = buffer->prev;
+
+            buffer->prev = NULL;
+            buffer->next = NULL;
+
+            // Unloaded buffer can not be started after any stream
+            for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+            {
+                if (audioBuffer->queued == buffer) audioBuffer->queued = NULL;
+            }
+        } break;
+        case AUDIO_COMMAND_ATTACH_PROCESSOR:
+        {
+            rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+            rAudioProcessor *last = *first;
+
+            while (last && last->next) last = last->next;
+
+            if (last)
+            {
+                command->processor->prev = last;
+                last->next = command->processor;
+            }
+            else *first = command->processor;
+        } break;
+        case AUDIO_COMMAND_DETACH_PROCESSOR:
+        {
+            rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+            rAudioProcessor *processor = *first;
+
+            while (processor)
+            {
+                rAudioProcessor *next = processor->next;
+                rAudioProcessor *prev = processor->prev;
+
+                if (processor->process == command->callback)
+                {
+                    if (*first == processor) *first = next;
+                    if (prev) prev->next = next;
+                    if (next) next->prev = prev;
+
+                    // Move processor to detached list, memory is freed by the caller thread
+                    processor->prev = NULL;
+                    processor->next = (rAudioProcessor *)ma_atomic_load_ptr(&AUDIO.Command.detached);
+                    while (!ma_atomic_compare_exchange_strong_ptr(&AUDIO.Command.detached, &processor->next, processor)) { }
+                }
+
+                processor = next;
+            }
+        } break;
+        case AUDIO_COMMAND_FLUSH:
+        {
+            // Sub-buffers are released from the start, stream waits for new data at the cursor
+            ma_atomic_store_32(&buffer->frameCursorPos, 0);
+            ma_atomic_store_32(&buffer->streamEnd, AUDIO_STREAM_NO_END);
+            for (unsigned int i = 0; i < buffer->subBufferCount; i++) ma_atomic_store_explicit_32(&buffer->isSubBufferProcessed[i], MA_TRUE, ma_atomic_memory_order_release);
+        } break;
+        case AUDIO_COMMAND_QUEUE: buffer->queued = command->queued; break;
+        default: break;
     }
 }
 
@@ -2872,6 +4503,21 @@ static bool SaveFileText(const char *fileName, char *text)
 
     return true;
 }
+
+// Map file data read-only into memory
+// NOTE: File mapping is not available in standalone mode, file data is loaded with LoadFileData()
+static const unsigned char *MapFileData(const char *fileName, size_t *dataSize)
+{
+    *dataSize = 0;
+
+    return NULL;
+}
+
+// Unmap file data
+static void UnmapFileData(const unsigned char *data, size_t dataSize)
+{
+    // Nothing to unmap
+}
 #endif
 
 #undef AudioBuffer
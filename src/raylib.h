@@ -312,6 +312,13 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// GlyphKerning, advance adjustment between a pair of characters
+typedef struct GlyphKerning {
+    int first;              // First character value (Unicode)
+    int second;             // Second character value (Unicode)
+    float advanceX;         // Advance X adjustment (pixels at font base size)
+} GlyphKerning;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -320,8 +327,54 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    int kerningCount;       // Number of kerning pairs
+    GlyphKerning *kernings; // Kerning pairs data (sorted by first, second)
+    int type;               // Font type (FontType), SDF and MSDF fonts are drawn with built-in shader
 } Font;
 
+// TextGlyph, glyph positioned by text layout
+typedef struct TextGlyph {
+    int value;              // Character value (Unicode)
+    int index;              // Glyph index in font
+    Vector2 position;       // Glyph position relative to layout origin
+} TextGlyph;
+
+// TextRun, glyphs sequence with same direction, in visual order
+typedef struct TextRun {
+    int glyphStart;         // First glyph of the run
+    int glyphCount;         // Number of glyphs in the run
+    int level;              // Bidi embedding level (odd: right-to-left)
+} TextRun;
+
+// TextLine, glyphs and runs of one layout line
+typedef struct TextLine {
+    int glyphStart;         // First glyph of the line
+    int glyphCount;         // Number of glyphs in the line
+    int runStart;           // First run of the line
+    int runCount;           // Number of runs in the line
+    Rectangle bounds;       // Line bounds relative to layout origin
+} TextLine;
+
+// TextLayout, text glyphs positioned with kerning, line wrapping and bidi runs
+typedef struct TextLayout {
+    float fontSize;         // Font size used for layout
+    float spacing;          // Glyphs spacing used for layout
+    int glyphCount;         // Number of glyphs
+    TextGlyph *glyphs;      // Glyphs data, lines consecutive, glyphs in visual order
+    int runCount;           // Number of runs
+    TextRun *runs;          // Runs data
+    int lineCount;          // Number of lines
+    TextLine *lines;        // Lines data
+    Vector2 size;           // Layout size
+} TextLayout;
+
+// TextLineOffsets, text lines start offsets, used to draw only visible lines of long texts
+typedef struct TextLineOffsets {
+    int size;               // Text size in bytes
+    int count;              // Number of lines
+    int *offsets;           // Lines start offsets in bytes
+} TextLineOffsets;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -518,6 +571,64 @@ typedef struct FilePathList {
     char **paths;                   // Filepaths entries
 } FilePathList;
 
+// File view, read-only file data
+typedef struct FileView {
+    const unsigned char *data;      // File data (read-only)
+    unsigned long long size;        // File data size in bytes
+    bool mapped;                    // File data is memory-mapped, not loaded into memory
+} FileView;
+
+// Compressor, reusable compression state
+typedef struct Compressor {
+    void *state;                    // Compressor internal state (DEFLATE)
+    int level;                      // Compression level [0..8]
+} Compressor;
+
+// Hash state, incremental hash computation
+typedef struct HashState {
+    int type;                       // Hash type (HashType)
+    unsigned long long length;      // Hashed data length in bytes
+    unsigned long long state[5];    // Hash internal state
+    unsigned char buffer[64];       // Hash pending data, waiting for a full block
+} HashState;
+
+// Frame time statistics, times in seconds
+typedef struct FrameTimeStats {
+    int frameCount;                 // Frames measured (last frames registered)
+    int missedCount;                // Frames that missed its deadline (target FPS)
+    float average;                  // Average frame time
+    float median;                   // Median frame time (50th percentile)
+    float p95;                      // 95th percentile frame time
+    float p99;                      // 99th percentile frame time
+    float max;                      // Maximum frame time
+    float spinMargin;               // Busy wait time at the end of waits, adapted to measured sleep overshoot
+} FrameTimeStats;
+
+// Profile zone, CPU time measured between BeginProfileZone() and EndProfileZone()
+typedef struct ProfileZone {
+    const char *name;               // Zone name (pointer must remain valid, i.e. string literal)
+    double start;                   // Zone start time (seconds since InitWindow())
+    float duration;                 // Zone duration in seconds
+    int depth;                      // Zone nesting depth
+} ProfileZone;
+
+// Frame profile, CPU/GPU times in seconds and render statistics of last frame
+typedef struct FrameProfile {
+    float updateTime;               // Time for frame update (previous EndDrawing() to BeginDrawing())
+    float drawTime;                 // Time for frame draw (BeginDrawing() to buffers swap)
+    float gpuTime;                  // GPU time for batch and mesh draws of latest frame with results available (a few frames delayed), -1 if not available
+    int gpuTimerCount;              // Number of GPU timer scopes measured in gpuTime frame
+    int gpuTimerSkipped;            // Number of GPU timer scopes not measured in gpuTime frame (too many timer queries in flight)
+    int drawCalls;                  // Number of draw calls
+    int vertexCount;                // Number of vertex drawn
+    int batchFlushes;               // Number of render batch draws
+    int batchOverflows;             // Number of render batch draws forced by batch buffer limits
+    int textureBinds;               // Number of texture binds
+    int shaderChanges;              // Number of shader changes
+    int stateChanges;               // Number of render state changes (blending, depth, culling, scissor, framebuffer)
+    unsigned int uploadedBytes;     // Number of bytes uploaded to GPU
+} FrameProfile;
+
 // Automation event
 typedef struct AutomationEvent {
     unsigned int frame;             // Event frame
@@ -527,11 +638,23 @@ typedef struct AutomationEvent {
 
 // Automation event list
 typedef struct AutomationEventList {
-    unsigned int capacity;          // Events max entries (MAX_AUTOMATION_EVENTS)
+    unsigned int capacity;          // Events max entries (grows as required while recording)
     unsigned int count;             // Events entries count
     AutomationEvent *events;        // Events entries
 } AutomationEventList;
 
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rcore module
+typedef struct rAutomationStream rAutomationStream;
+
+// Automation event stream, events read on demand from binary file
+typedef struct AutomationEventStream {
+    unsigned int count;             // Events played from stream
+    bool finished;                  // Stream end reached, no more events available
+    AutomationEvent next;           // Next event to play (if not finished)
+    rAutomationStream *stream;      // Pointer to internal stream reader data
+} AutomationEventStream;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -890,7 +1013,8 @@ typedef enum {
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
     FONT_BITMAP,                    // Bitmap font generation, no anti-aliasing
-    FONT_SDF                        // SDF font generation, requires external shader
+    FONT_SDF,                       // SDF font generation, requires external shader (built-in shader if loaded with LoadFontSDF())
+    FONT_MSDF                       // Multi-channel SDF font generation, requires external shader (built-in shader if loaded with LoadFontSDF())
 } FontType;
 
 // Color blending modes (pre-defined)
@@ -943,6 +1067,29 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Sound storage mode, selected on sound loading
+typedef enum {
+    SOUND_STORAGE_DEVICE = 0,       // Sound data converted to device format on loading (default)
+    SOUND_STORAGE_ORIGINAL,         // Sound data kept in wave format, converted on mixing
+    SOUND_STORAGE_QOA               // Sound data compressed with QOA, decoded on mixing
+} SoundStorage;
+
+// Spatial audio distance attenuation models
+typedef enum {
+    AUDIO_ATTENUATION_NONE = 0,     // No distance attenuation
+    AUDIO_ATTENUATION_INVERSE,      // Inverse distance: minDistance/(minDistance + rolloff*(distance - minDistance)) (default)
+    AUDIO_ATTENUATION_LINEAR,       // Linear distance: 1 - rolloff*(distance - minDistance)/(maxDistance - minDistance)
+    AUDIO_ATTENUATION_EXPONENTIAL   // Exponential distance: (distance/minDistance)^-rolloff
+} AudioAttenuation;
+
+// Hash algorithms, for incremental hash computation
+typedef enum {
+    HASH_CRC32 = 0,                 // CRC32 (4 bytes)
+    HASH_MD5,                       // MD5 (16 bytes)
+    HASH_SHA1,                      // SHA-1 (20 bytes)
+    HASH_XXH64                      // XXH64 (8 bytes), fast non-cryptographic hash
+} HashType;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advanced users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
@@ -950,6 +1097,7 @@ typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, int *dataSi
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, int dataSize);   // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text); // FileIO: Save text data
+typedef bool (*ScanDirectoryCallback)(const char *path, bool isDirectory, void *userData); // FileIO: Directory scan path, return false to stop scanning
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -1058,6 +1206,7 @@ RLAPI void SetShaderValueV(Shader shader, int locIndex, const void *value, int u
 RLAPI void SetShaderValueMatrix(Shader shader, int locIndex, Matrix mat);         // Set shader uniform value (matrix 4x4)
 RLAPI void SetShaderValueTexture(Shader shader, int locIndex, Texture2D texture); // Set shader uniform value for texture (sampler2d)
 RLAPI void UnloadShader(Shader shader);                                    // Unload shader from GPU memory (VRAM)
+RLAPI bool ReloadShader(Shader *shader, const char *vsFileName, const char *fsFileName); // Reload shader from files in place, previous shader kept on failure
 
 // Screen-space-related functions
 #define GetMouseRay GetScreenToWorldRay     // Compatibility hack for previous raylib versions
@@ -1075,6 +1224,17 @@ RLAPI void SetTargetFPS(int fps);                                 // Set target
 RLAPI float GetFrameTime(void);                                   // Get time in seconds for last frame drawn (delta time)
 RLAPI double GetTime(void);                                       // Get elapsed time in seconds since InitWindow()
 RLAPI int GetFPS(void);                                           // Get current FPS
+RLAPI FrameTimeStats GetFrameTimeStats(void);                     // Get frame time statistics over last frames (percentiles, missed deadlines)
+
+// Profiling functions
+RLAPI void BeginProfileZone(const char *name);                    // Begin CPU profile zone (nestable, name must remain valid)
+RLAPI void EndProfileZone(void);                                  // End current CPU profile zone
+RLAPI FrameProfile GetFrameProfile(void);                         // Get last frame profile (times and render statistics)
+RLAPI const ProfileZone *GetFrameProfileZones(int *count);        // Get last frame profile zones (in begin order)
+RLAPI bool EnableGpuProfiling(void);                              // Enable GPU time measure with timer queries (returns false if not supported)
+RLAPI void DisableGpuProfiling(void);                             // Disable GPU time measure
+RLAPI void StartProfileTrace(void);                               // Start recording frames profile for trace export (last MAX_PROFILE_TRACE_FRAMES)
+RLAPI bool ExportProfileTrace(const char *fileName);              // Export recorded frames profile as trace-event JSON (chrome://tracing, Perfetto) and stop recording
 
 // Custom frame control functions
 // NOTE: Those functions are intended for advanced users that want full control over the frame processing
@@ -1092,6 +1252,9 @@ RLAPI void UnloadRandomSequence(int *sequence);                   // Unload rand
 
 // Misc. functions
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
+RLAPI bool StartScreenRecording(const char *fileName, int fps);   // Start screen recording (.gif, .qoi frames sequence, .raw RGBA frames), frames encoded on background thread
+RLAPI void StopScreenRecording(void);                             // Stop screen recording, waits for pending frames to be encoded
+RLAPI bool IsScreenRecording(void);                               // Check if screen is being recorded
 RLAPI void SetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 RLAPI void OpenURL(const char *url);                              // Open URL with default system browser (if available)
 
@@ -1114,6 +1277,11 @@ RLAPI void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom
 // Files management functions
 RLAPI unsigned char *LoadFileData(const char *fileName, int *dataSize); // Load file data as byte array (read)
 RLAPI void UnloadFileData(unsigned char *data);                   // Unload file data allocated by LoadFileData()
+RLAPI FileView LoadFileView(const char *fileName);                 // Load file data view (read-only), memory-mapped if available, loaded otherwise
+RLAPI void UnloadFileView(FileView view);                         // Unload file data view loaded with LoadFileView()
+RLAPI bool MountArchive(const char *fileName, const char *mountPath); // Mount packed file archive (.rpak), archived files are loaded from mountPath
+RLAPI void UnmountArchive(const char *fileName);                  // Unmount packed file archive
+RLAPI bool ExportArchive(const char *fileName, FilePathList files, const char *basePath); // Export files into packed file archive (.rpak), entries named relative to basePath
 RLAPI bool SaveFileData(const char *fileName, void *data, int dataSize); // Save data to file from byte array (write), returns true on success
 RLAPI bool ExportDataAsCode(const unsigned char *data, int dataSize, const char *fileName); // Export data to code (.h), returns true on success
 RLAPI char *LoadFileText(const char *fileName);                   // Load text data from file (read), returns a '\0' terminated string
@@ -1140,26 +1308,48 @@ RLAPI bool IsFileNameValid(const char *fileName);                 // Check if fi
 RLAPI FilePathList LoadDirectoryFiles(const char *dirPath);       // Load directory filepaths
 RLAPI FilePathList LoadDirectoryFilesEx(const char *basePath, const char *filter, bool scanSubdirs); // Load directory filepaths with extension filtering and recursive directory scan. Use 'DIR' in the filter string to include directories in the result
 RLAPI void UnloadDirectoryFiles(FilePathList files);              // Unload filepaths
+RLAPI unsigned int ScanDirectoryFiles(const char *basePath, const char *filter, bool scanSubdirs, ScanDirectoryCallback callback, void *userData); // Scan directory filepaths calling callback per path (no paths stored), same filtering as LoadDirectoryFilesEx(), returns paths count
 RLAPI bool IsFileDropped(void);                                   // Check if a file has been dropped into window
 RLAPI FilePathList LoadDroppedFiles(void);                        // Load dropped filepaths
 RLAPI void UnloadDroppedFiles(FilePathList files);                // Unload dropped filepaths
 RLAPI long GetFileModTime(const char *fileName);                  // Get file modification time (last write time)
+RLAPI bool WatchFile(const char *fileName);                       // Start watching file for changes (background thread), reported by LoadChangedFiles()
+RLAPI void UnwatchFile(const char *fileName);                     // Stop watching file for changes
+RLAPI FilePathList LoadChangedFiles(void);                        // Load changed watched filepaths since previous call
+RLAPI void UnloadChangedFiles(FilePathList files);                // Unload changed filepaths
 
 // Compression/Encoding functionality
 RLAPI unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize);        // Compress data (DEFLATE algorithm), memory must be MemFree()
 RLAPI unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize);  // Decompress data (DEFLATE algorithm), memory must be MemFree()
+RLAPI Compressor LoadCompressor(int level);                                                             // Load compressor (DEFLATE algorithm) with reusable state, level [0..8]
+RLAPI void UnloadCompressor(Compressor compressor);                                                    // Unload compressor
+RLAPI int GetCompressDataBound(int dataSize);                                                          // Get maximum compressed data size for provided data size
+RLAPI int CompressDataTo(Compressor compressor, const unsigned char *data, int dataSize, unsigned char *compData, int compDataCapacity); // Compress data into provided buffer (capacity >= GetCompressDataBound()), returns compressed size
+RLAPI int DecompressDataTo(const unsigned char *compData, int compDataSize, unsigned char *data, int dataCapacity);   // Decompress data into provided buffer (exact size if known), returns decompressed size
+RLAPI unsigned char *CompressDataParallel(const unsigned char *data, int dataSize, int *compDataSize);     // Compress data in independent blocks using worker threads, memory must be MemFree()
+RLAPI unsigned char *DecompressDataParallel(const unsigned char *compData, int compDataSize, int *dataSize); // Decompress data compressed with CompressDataParallel(), memory must be MemFree()
 RLAPI char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize);               // Encode data to Base64 string, memory must be MemFree()
 RLAPI unsigned char *DecodeDataBase64(const unsigned char *data, int *outputSize);                    // Decode Base64 string data, memory must be MemFree()
 RLAPI unsigned int ComputeCRC32(unsigned char *data, int dataSize);     // Compute CRC32 hash code
 RLAPI unsigned int *ComputeMD5(unsigned char *data, int dataSize);      // Compute MD5 hash code, returns static int[4] (16 bytes)
 RLAPI unsigned int *ComputeSHA1(unsigned char *data, int dataSize);      // Compute SHA1 hash code, returns static int[5] (20 bytes)
+RLAPI void ComputeMD5To(const unsigned char *data, int dataSize, unsigned int *hash);   // Compute MD5 hash code into provided int[4] array (thread-safe)
+RLAPI void ComputeSHA1To(const unsigned char *data, int dataSize, unsigned int *hash);  // Compute SHA1 hash code into provided int[5] array (thread-safe)
+RLAPI unsigned long long ComputeXXH64(const unsigned char *data, int dataSize);          // Compute XXH64 hash code (fast, non-cryptographic), i.e. for cache keys
+RLAPI HashState InitHash(int type);                                                     // Init hash state for incremental hash computation (HashType)
+RLAPI void UpdateHash(HashState *state, const unsigned char *data, int dataSize);       // Update hash state with data chunk
+RLAPI void FinishHash(HashState *state, unsigned int *hash);                            // Finish hash computation, hash size: CRC32 int[1], MD5 int[4], SHA1 int[5], XXH64 int[2]
 
 
 // Automation events functionality
-RLAPI AutomationEventList LoadAutomationEventList(const char *fileName);                // Load automation events list from file, NULL for empty list, capacity = MAX_AUTOMATION_EVENTS
+RLAPI AutomationEventList LoadAutomationEventList(const char *fileName);                // Load automation events list from file (binary or text), NULL for empty list, capacity = MAX_AUTOMATION_EVENTS
 RLAPI void UnloadAutomationEventList(AutomationEventList list);                         // Unload automation events list from file
-RLAPI bool ExportAutomationEventList(AutomationEventList list, const char *fileName);   // Export automation events list as text file
+RLAPI bool ExportAutomationEventList(AutomationEventList list, const char *fileName);   // Export automation events list as binary file (.rae) or text file (any other extension)
 RLAPI void SetAutomationEventList(AutomationEventList *list);                           // Set automation event list to record to
+RLAPI bool SetAutomationEventStream(const char *fileName);                              // Set automation events binary file to stream recorded events to (no events limit), NULL to close
+RLAPI AutomationEventStream LoadAutomationEventStream(const char *fileName);            // Load automation events stream from binary file, events are read on demand
+RLAPI void UnloadAutomationEventStream(AutomationEventStream stream);                    // Unload automation events stream
+RLAPI int PlayAutomationEventStream(AutomationEventStream *stream, unsigned int frame);  // Play automation events from stream up to provided frame, returns number of events played
 RLAPI void SetAutomationEventBaseFrame(int frame);                                      // Set automation event internal base frame to start recording
 RLAPI void StartAutomationEventRecording(void);                                         // Start recording automation events (AutomationEventList must be set)
 RLAPI void StopAutomationEventRecording(void);                                          // Stop recording automation events
@@ -1415,6 +1605,7 @@ RLAPI TextureCubemap LoadTextureCubemap(Image image, int layout);
 RLAPI RenderTexture2D LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
 RLAPI bool IsTextureValid(Texture2D texture);                                                            // Check if a texture is valid (loaded in GPU)
 RLAPI void UnloadTexture(Texture2D texture);                                                             // Unload texture from GPU memory (VRAM)
+RLAPI bool ReloadTexture(Texture2D *texture, const char *fileName);                                      // Reload texture from file in place, previous texture kept on failure
 RLAPI bool IsRenderTextureValid(RenderTexture2D target);                                                 // Check if a render texture is valid (loaded in GPU)
 RLAPI void UnloadRenderTexture(RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
@@ -1461,18 +1652,22 @@ RLAPI Font GetFontDefault(void);
 RLAPI Font LoadFont(const char *fileName);                                                  // Load font from file into GPU memory (VRAM)
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set, font size is provided in pixels height
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
+RLAPI Font LoadFontSDF(const char *fileName, int fontSize, int *codepoints, int codepointCount, int type); // Load TTF font as signed distance field (FONT_SDF or FONT_MSDF), drawn with built-in shader
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
 RLAPI bool IsFontValid(Font font);                                                          // Check if a font is valid (font data loaded, WARNING: GPU texture not checked)
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
 RLAPI void UnloadFontData(GlyphInfo *glyphs, int glyphCount);                               // Unload font chars info data (RAM)
 RLAPI void UnloadFont(Font font);                                                           // Unload font from GPU memory (VRAM)
+RLAPI bool ReloadFont(Font *font, const char *fileName);                                    // Reload font from file in place (same size and codepoints), previous font kept on failure
+RLAPI bool ExportFont(Font font, const char *fileName);                                     // Export font as raylib precompiled font file (.rfnt), returns true on success
 RLAPI bool ExportFontAsCode(Font font, const char *fileName);                               // Export font as code file, returns true on success
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Draw current FPS
 RLAPI void DrawText(const char *text, int posX, int posY, int fontSize, Color color);       // Draw text (using default font)
 RLAPI void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text using font and additional parameters
+RLAPI void DrawTextClipped(Font font, const char *text, TextLineOffsets lines, Vector2 position, Rectangle clip, float fontSize, float spacing, Color tint); // Draw text using font and text lines offsets, only glyphs overlapping clip rectangle
 RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint); // Draw text using Font and pro parameters (rotation)
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
@@ -1484,6 +1679,15 @@ RLAPI Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float s
 RLAPI int GetGlyphIndex(Font font, int codepoint);                                          // Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found
 RLAPI GlyphInfo GetGlyphInfo(Font font, int codepoint);                                     // Get glyph font info data for a codepoint (unicode character), fallback to '?' if not found
 RLAPI Rectangle GetGlyphAtlasRec(Font font, int codepoint);                                 // Get glyph rectangle in font atlas for a codepoint (unicode character), fallback to '?' if not found
+RLAPI float GetGlyphKerning(Font font, int codepoint1, int codepoint2);                      // Get kerning advance adjustment between two codepoints (pixels at font base size), 0 if not defined
+
+// Text layout functions (kerning, line wrapping and bidi runs)
+RLAPI TextLineOffsets LoadTextLineOffsets(const char *text);                                 // Load text lines start offsets, required by DrawTextClipped()
+RLAPI void UnloadTextLineOffsets(TextLineOffsets lines);                                     // Unload text lines start offsets
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing, float wrapWidth); // Load text layout, use 0 wrapWidth to only break lines on '\n'
+RLAPI void UnloadTextLayout(TextLayout layout);                                              // Unload text layout data
+RLAPI void DrawTextLayout(Font font, TextLayout layout, Vector2 position, Color tint);       // Draw text layout, using the same font it was loaded with
+RLAPI void DrawTextLayoutClipped(Font font, TextLayout layout, Vector2 position, Rectangle clip, Color tint); // Draw text layout, only lines and glyphs overlapping clip rectangle
 
 // Text codepoints management functions (unicode characters)
 RLAPI char *LoadUTF8(const int *codepoints, int length);                // Load UTF-8 text encoded from codepoints array
@@ -1554,6 +1758,7 @@ RLAPI Model LoadModel(const char *fileName);
 RLAPI Model LoadModelFromMesh(Mesh mesh);                                                   // Load model from generated mesh (default material)
 RLAPI bool IsModelValid(Model model);                                                       // Check if a model is valid (loaded in GPU, VAO/VBOs)
 RLAPI void UnloadModel(Model model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
+RLAPI bool ReloadModel(Model *model, const char *fileName);                                 // Reload model from file in place (transform kept), previous model kept on failure
 RLAPI BoundingBox GetModelBoundingBox(Model model);                                         // Compute model bounding box limits (considers all meshes)
 
 // Model drawing functions
@@ -1625,10 +1830,14 @@ typedef void (*AudioCallback)(void *bufferData, unsigned int frames);
 
 // Audio device management functions
 RLAPI void InitAudioDevice(void);                                     // Initialize audio device and context
+RLAPI void InitAudioDeviceOffline(unsigned int sampleRate);           // Initialize audio mixer without device, audio rendered on demand (offline)
 RLAPI void CloseAudioDevice(void);                                    // Close the audio device and context
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
 RLAPI float GetMasterVolume(void);                                    // Get master volume (listener)
+RLAPI void SetAudioMaxVoices(int count);                              // Set maximum number of voices mixed at the same time, rest are virtual
+RLAPI void SetAudioListener(Vector3 position, Vector3 forward, Vector3 up, Vector3 velocity); // Set 3D audio listener, for spatial sounds and music
+RLAPI void RenderAudioFrames(float *frames, int frameCount);         // Render mixed audio frames, interleaved float samples (offline mode)
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
@@ -1636,11 +1845,14 @@ RLAPI Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileDat
 RLAPI bool IsWaveValid(Wave wave);                                    // Checks if wave data is valid (data loaded and parameters)
 RLAPI Sound LoadSound(const char *fileName);                          // Load sound from file
 RLAPI Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
+RLAPI Sound *LoadSounds(const char **fileNames, int count);           // Load sounds from files, decoded in parallel (array of count sounds)
 RLAPI Sound LoadSoundAlias(Sound source);                             // Create a new sound that shares the same sample data as the source sound, does not own the sound data
+RLAPI void SetSoundStorageDefault(int storage);                       // Set storage mode for new sounds (SoundStorage), original format and QOA save memory
 RLAPI bool IsSoundValid(Sound sound);                                 // Checks if a sound is valid (data loaded and buffers initialized)
 RLAPI void UpdateSound(Sound sound, const void *data, int sampleCount); // Update sound buffer with new data
 RLAPI void UnloadWave(Wave wave);                                     // Unload wave data
 RLAPI void UnloadSound(Sound sound);                                  // Unload sound
+RLAPI void UnloadSounds(Sound *sounds, int count);                    // Unload sounds loaded with LoadSounds()
 RLAPI void UnloadSoundAlias(Sound alias);                             // Unload a sound alias (does not deallocate sample data)
 RLAPI bool ExportWave(Wave wave, const char *fileName);               // Export wave data to file, returns true on success
 RLAPI bool ExportWaveAsCode(Wave wave, const char *fileName);         // Export wave sample data to code (.h), returns true on success
@@ -1654,6 +1866,9 @@ RLAPI bool IsSoundPlaying(Sound sound);                               // Check i
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 RLAPI void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (0.5 is center)
+RLAPI void SetSoundPosition(Sound sound, Vector3 position, Vector3 velocity); // Set 3D position and velocity for a sound, sound becomes spatial
+RLAPI void SetSoundAttenuation(Sound sound, int model, float minDistance, float maxDistance, float rolloff); // Set distance attenuation for a spatial sound (AudioAttenuation)
+RLAPI void SetSoundPriority(Sound sound, int priority);               // Set priority for a sound (default: 0), higher priority voices are mixed first and stolen last
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 RLAPI void WaveCrop(Wave *wave, int initFrame, int finalFrame);       // Crop a wave to defined frames range
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
@@ -1672,9 +1887,12 @@ RLAPI void StopMusicStream(Music music);                              // Stop mu
 RLAPI void PauseMusicStream(Music music);                             // Pause music playing
 RLAPI void ResumeMusicStream(Music music);                            // Resume playing paused music
 RLAPI void SeekMusicStream(Music music, float position);              // Seek music to a position (in seconds)
+RLAPI void SetMusicLoopPoints(Music music, float loopStart, float loopEnd); // Set music loop points (in seconds), loop end 0.0f for end of music
+RLAPI void QueueMusicStream(Music music, Music next);                 // Queue music to start right after current music ends (gapless)
 RLAPI void SetMusicVolume(Music music, float volume);                 // Set volume for music (1.0 is max level)
 RLAPI void SetMusicPitch(Music music, float pitch);                   // Set pitch for a music (1.0 is base level)
 RLAPI void SetMusicPan(Music music, float pan);                       // Set pan for a music (0.5 is center)
+RLAPI void SetMusicPosition(Music music, Vector3 position, Vector3 velocity); // Set 3D position and velocity for a music, music becomes spatial
 RLAPI float GetMusicTimeLength(Music music);                          // Get music time length (in seconds)
 RLAPI float GetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
 
@@ -39,13 +39,15 @@
 *           Use busy wait loop for timing sync, if not defined, a high-resolution timer is setup and used
 *
 *       #define SUPPORT_PARTIALBUSY_WAIT_LOOP
-*           Use a partial-busy wait loop, in this case frame sleeps for most of the time and runs a busy-wait-loop at the end
+*           Use a partial-busy wait loop, in this case frame sleeps for most of the time and runs a busy-wait-loop at the end,
+*           busy-wait-loop length is adapted to the sleep overshoot measured on every wait
 *
 *       #define SUPPORT_SCREEN_CAPTURE
 *           Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 *
 *       #define SUPPORT_GIF_RECORDING
-*           Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
+*           Allow screen recording (GIF, QOI frames sequence, raw RGBA frames stream) with async screen readback
+*           and frames encoding on a background thread, automatic gif recording pressing CTRL+F12
 *
 *       #define SUPPORT_COMPRESSION_API
 *           Support CompressData() and DecompressData() functions, those functions use zlib implementation
@@ -53,7 +55,8 @@
 *           for linkage
 *
 *       #define SUPPORT_AUTOMATION_EVENTS
-*           Support automatic events recording and playing, useful for automated testing systems or AI based game playing
+*           Support automatic events recording and playing, useful for automated testing systems or AI based game playing,
+*           events can be streamed to/from compact binary files (delta encoded) with no events limit
 *
 *   DEPENDENCIES:
 *       raymath  - 3D math functionality (Vector2, Vector3, Matrix, Quaternion)
@@ -90,9 +93,9 @@
     #define _XOPEN_SOURCE 500 // Required for: readlink if compiled with c99 without gnu ext.
 #endif
 
-#if (defined(__linux__) || defined(PLATFORM_WEB)) && (_POSIX_C_SOURCE < 199309L)
+#if (defined(__linux__) || defined(PLATFORM_WEB)) && (_POSIX_C_SOURCE < 200112L)
     #undef _POSIX_C_SOURCE
-    #define _POSIX_C_SOURCE 199309L // Required for: CLOCK_MONOTONIC if compiled with c99 without gnu ext.
+    #define _POSIX_C_SOURCE 200112L // Required for: CLOCK_MONOTONIC, clock_nanosleep() if compiled with c99 without gnu ext.
 #endif
 
 #include "raylib.h"                 // Declares module functions
@@ -107,7 +110,8 @@
 #include <stdlib.h>                 // Required for: srand(), rand(), atexit()
 #include <stdio.h>                  // Required for: sprintf() [Used in OpenURL()]
 #include <string.h>                 // Required for: strrchr(), strcmp(), strlen(), memset()
-#include <time.h>                   // Required for: time() [Used in InitTimer()]
+#include <time.h>                   // Required for: time() [Used in InitTimer()], clock_nanosleep() [Used in SleepUntilTime()]
+#include <errno.h>                  // Required for: EINTR [Used in SleepUntilTime()]
 #include <math.h>                   // Required for: tan() [Used in BeginMode3D()], atan2f() [Used in LoadVrStereoConfig()]
 
 #define RLGL_IMPLEMENTATION
@@ -133,6 +137,10 @@
 
     #define MSF_GIF_IMPL
     #include "external/msf_gif.h"   // GIF recording functionality
+
+    #if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_FILEFORMAT_QOI)
+        #include "external/qoi.h"   // QOI frames recording [Implementation in rtextures.c]
+    #endif
 #endif
 
 #if defined(SUPPORT_COMPRESSION_API)
@@ -149,6 +157,15 @@
     #include "external/rprand.h"
 #endif
 
+// CRC32 hardware acceleration, enabled if instructions are available on compilation (i.e. -mpclmul, -march=armv8-a+crc)
+#if (defined(__PCLMUL__) || (defined(_MSC_VER) && defined(__AVX2__))) && (defined(__x86_64__) || defined(_M_X64))
+    #include <wmmintrin.h>          // Required for: _mm_clmulepi64_si128() [Used in UpdateCRC32()]
+    #define RCORE_CRC32_PCLMUL
+#elif defined(__ARM_FEATURE_CRC32)
+    #include <arm_acle.h>           // Required for: __crc32d() [Used in UpdateCRC32()]
+    #define RCORE_CRC32_ARM
+#endif
+
 #if defined(__linux__) && !defined(_GNU_SOURCE)
     #define _GNU_SOURCE
 #endif
@@ -180,6 +197,9 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
 #if !defined(S_ISREG) && defined(S_IFMT) && defined(S_IFREG)
     #define S_ISREG(m) (((m) & S_IFMT) == S_IFREG)
 #endif
+#if !defined(S_ISDIR) && defined(S_IFMT) && defined(S_IFDIR)
+    #define S_ISDIR(m) (((m) & S_IFMT) == S_IFDIR)
+#endif
 
 #if defined(_WIN32) && (defined(_MSC_VER) || defined(__TINYC__))
     #define DIRENT_MALLOC RL_MALLOC
@@ -206,9 +226,6 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-#ifndef MAX_FILEPATH_CAPACITY
-    #define MAX_FILEPATH_CAPACITY       8192        // Maximum capacity for filepath
-#endif
 #ifndef MAX_FILEPATH_LENGTH
     #if defined(_WIN32)
         #define MAX_FILEPATH_LENGTH      256        // On Win32, MAX_PATH = 260 (limits.h) but Windows 10, Version 1607 enables long paths...
@@ -248,14 +265,68 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
 #ifndef MAX_DECOMPRESSION_SIZE
     #define MAX_DECOMPRESSION_SIZE        64        // Maximum size allocated for decompression in MB
 #endif
+#ifndef COMPRESSION_BLOCK_SIZE
+    #define COMPRESSION_BLOCK_SIZE   (1024*1024)    // Block size for parallel compression, blocks are compressed independently
+#endif
+
+#define COMPRESSION_QUALITY_DEFLATE        8        // Compression level 8, same as stbiw
+#define COMPRESSION_HEADER_SIZE            8        // Parallel compressed data header size: id "rDFB" + block size
+#define COMPRESSION_BLOCK_HEADER_SIZE      8        // Parallel compressed block header size: data size + compressed size
+
+#define ROTATE_LEFT(x, c)   (((x) << (c)) | ((x) >> (32 - (c))))  // Rotate 32 bit value left [Used in MD5, SHA-1]
+#define XXH64_ROTATE_LEFT(x, c)   (((x) << (c)) | ((x) >> (64 - (c))))    // Rotate 64 bit value left [Used in XXH64]
+#define XXH64_PRIME1    0x9E3779B185EBCA87ULL
+#define XXH64_PRIME2    0xC2B2AE3D27D4EB4FULL
+#define XXH64_PRIME3    0x165667B19E3779F9ULL
+#define XXH64_PRIME4    0x85EBCA77C2B2AE63ULL
+#define XXH64_PRIME5    0x27D4EB2F165667C5ULL
 
 #ifndef MAX_AUTOMATION_EVENTS
-    #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
+    #define MAX_AUTOMATION_EVENTS      16384        // Initial capacity of automation events list, grows as required while recording
+#endif
+#ifndef AUTOMATION_STREAM_BUFFER_SIZE
+    #define AUTOMATION_STREAM_BUFFER_SIZE  65536    // Automation events stream buffer size, stream files are written/read in blocks of this size
+#endif
+
+#ifndef FRAME_TIME_HISTORY_COUNT
+    #define FRAME_TIME_HISTORY_COUNT     512        // Frame times registered for frame time statistics
+#endif
+#ifndef FRAME_DEADLINE_MISS_TIME
+    #define FRAME_DEADLINE_MISS_TIME  0.0005        // Time in seconds a frame can end after its deadline before considered missed
+#endif
+#ifndef WAIT_SPIN_MARGIN_MIN
+    #define WAIT_SPIN_MARGIN_MIN     0.00005        // Minimum busy wait time in seconds at the end of a wait (SUPPORT_PARTIALBUSY_WAIT_LOOP)
+#endif
+#ifndef WAIT_SPIN_MARGIN_MAX
+    #define WAIT_SPIN_MARGIN_MAX       0.002        // Maximum busy wait time in seconds at the end of a wait (SUPPORT_PARTIALBUSY_WAIT_LOOP)
+#endif
+
+#ifndef GIF_RECORD_FRAMERATE
+    #define GIF_RECORD_FRAMERATE          10        // GIF recording framerate, automatic recording (CTRL+F12)
+#endif
+#ifndef GIF_RECORD_BITRATE
+    #define GIF_RECORD_BITRATE            16        // GIF recording maximum bit depth (msf_gif)
+#endif
+#ifndef MAX_RECORDING_QUEUE_FRAMES
+    #define MAX_RECORDING_QUEUE_FRAMES     4        // Maximum number of recorded frames waiting to be encoded, frames are dropped when full
+#endif
+#ifndef RECORDING_READBACK_BUFFERS
+    #define RECORDING_READBACK_BUFFERS     3        // Number of pixel buffers for async screen readback, readback data retrieved 2 frames later
+#endif
+
+#ifndef MAX_PROFILE_ZONES
+    #define MAX_PROFILE_ZONES            256        // Maximum number of profile zones registered per frame
+#endif
+#ifndef MAX_PROFILE_ZONE_DEPTH
+    #define MAX_PROFILE_ZONE_DEPTH        32        // Maximum profile zones nesting depth
+#endif
+#ifndef MAX_PROFILE_TRACE_FRAMES
+    #define MAX_PROFILE_TRACE_FRAMES     300        // Maximum number of frames recorded for profile trace export
 #endif
 
 #ifndef DIRECTORY_FILTER_TAG
     #define DIRECTORY_FILTER_TAG       "DIR"        // Name tag used to request directory inclusion on directory scan
-#endif                                              // NOTE: Used in ScanDirectoryFiles(), ScanDirectoryFilesRecursively() and LoadDirectoryFilesEx()
+#endif                                              // NOTE: Used in ScanDirectoryFiles() and LoadDirectoryFilesEx()
 
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
@@ -361,10 +432,148 @@ typedef struct CoreData {
         double target;                      // Desired time for one frame, if 0 not applied
         unsigned long long int base;        // Base time measure for hi-res timer (PLATFORM_ANDROID, PLATFORM_DRM)
         unsigned int frameCounter;          // Frame counter
+        double deadline;                    // Current frame deadline, frames are paced to absolute deadlines to avoid drift
+        double spinMargin;                  // Busy wait time at the end of a wait, adapted to measured sleep overshoot
+        float frameTimes[FRAME_TIME_HISTORY_COUNT];     // Frame times history, for frame time statistics
+        bool frameMissed[FRAME_TIME_HISTORY_COUNT];     // Frame missed its deadline history, for frame time statistics
+        unsigned int frameTimeCount;        // Frame times registered count
 
     } Time;
 } CoreData;
 
+#if defined(SUPPORT_COMPRESSION_API)
+// Parallel compression jobs data
+typedef struct CompressionJobData {
+    const unsigned char *data;      // Data to compress
+    int dataSize;                   // Data size
+    int blockCount;                 // Number of blocks
+    int jobCount;                   // Number of jobs, every job compresses an interleaved share of blocks
+    unsigned char *output;          // Output buffer, one slot per block
+    size_t slotSize;                // Output slot size per block (header + compression bound)
+    int *blockSizes;                // Compressed size per block
+} CompressionJobData;
+
+// Parallel decompression block
+typedef struct DecompressionBlock {
+    const unsigned char *compData;  // Block compressed data
+    int compDataSize;               // Block compressed data size
+    int dataOffset;                 // Block decompressed data offset
+    int dataSize;                   // Block decompressed data size
+    int result;                     // Block decompressed data size result
+} DecompressionBlock;
+
+// Parallel decompression jobs data
+typedef struct DecompressionJobData {
+    unsigned char *data;            // Decompressed data
+    DecompressionBlock *blocks;     // Blocks to decompress
+    int blockCount;                 // Number of blocks
+} DecompressionJobData;
+#endif
+
+// Directory scan state
+// NOTE: Entries names are appended in-place to path, no per-entry formatting or allocations
+typedef struct DirectoryScan {
+    const char *filter;             // Extensions filter, ';' separated (NULL for all files)
+    bool includeDirs;               // Directories are reported
+    bool scanSubdirs;               // Subdirectories are scanned recursively
+    ScanDirectoryCallback callback; // Callback per reported path
+    void *userData;                 // Callback user data
+    unsigned int count;             // Reported paths count
+    bool stop;                      // Scan stopped by callback
+    char path[MAX_FILEPATH_LENGTH]; // Current scan path
+} DirectoryScan;
+
+// File paths arena, null-terminated paths packed one after another
+typedef struct FilePathArena {
+    char *data;                     // Paths data
+    size_t size;                    // Paths data size in bytes
+    size_t capacity;                // Paths data capacity in bytes
+    unsigned int count;             // Paths count
+} FilePathArena;
+
+// Parallel directory scan jobs data, one job per base path subdirectory
+typedef struct DirectoryScanJobData {
+    const char *filter;             // Extensions filter
+    FilePathArena entries;          // Base path entries (all files and directories)
+    bool *entryIsDirectory;         // Base path entries type
+    unsigned int entryCapacity;     // Base path entries type capacity
+    char **subdirs;                 // Subdirectories to scan, one per job
+    FilePathArena *results;         // Subdirectories scan results, one per job
+} DirectoryScanJobData;
+
+#if defined(SUPPORT_GIF_RECORDING)
+// Screen recording formats
+typedef enum {
+    RECORDING_FORMAT_GIF = 0,       // Animated GIF (msf_gif)
+    RECORDING_FORMAT_QOI,           // QOI frames sequence, one file per frame
+    RECORDING_FORMAT_RAW            // Raw RGBA frames stream, single file
+} RecordingFormat;
+
+// Screen recording frame, filled on main thread, encoded on recorder background thread
+typedef struct RecordingFrame {
+    unsigned char *data;            // Frame pixel data (RGBA, top-left origin)
+    unsigned int index;             // Frame index
+    int delay;                      // Frame delay in centiseconds (GIF)
+} RecordingFrame;
+
+// Screen recorder state
+// NOTE: Screen is read into pixel buffers and retrieved a couple of frames later, when GPU is done,
+// retrieved frames are queued for encoding on a background thread, frames are dropped if the queue is full
+typedef struct ScreenRecorder {
+    bool recording;                 // Recording active
+    int format;                     // Recording format (RecordingFormat)
+    char fileName[MAX_FILEPATH_LENGTH]; // Recording file name (GIF, RAW) or frames file name prefix (QOI)
+    int width;                      // Recorded frames width
+    int height;                     // Recorded frames height
+    double interval;                // Time between recorded frames
+    double nextTime;                // Next frame record time
+    double prevTime;                // Previous frame record time
+    double delayError;              // Accumulated GIF frame delay rounding error (centiseconds)
+
+    unsigned int pixelBuffers[RECORDING_READBACK_BUFFERS];  // Pixel buffers for async readback (0 if not supported)
+    unsigned int readbackFrames[RECORDING_READBACK_BUFFERS]; // Frame counter when readback was requested
+    int readbackDelays[RECORDING_READBACK_BUFFERS];  // Frame delay of requested readbacks
+    int readbackHead;               // Oldest readback pending
+    int readbackCount;              // Readbacks pending
+
+    RecordingFrame frames[MAX_RECORDING_QUEUE_FRAMES];  // Frames ring, queued for encoding
+    unsigned int frameCount;        // Frames queued for encoding
+    unsigned int droppedCount;      // Frames dropped, encoding queue full
+    int droppedDelay;               // Delay of dropped frames, added to next queued frame delay (GIF)
+    BackgroundWorker *worker;       // Frames encoding background worker
+
+    MsfGifState gifState;           // GIF encoder state, used by background worker
+    FILE *rawFile;                  // Raw frames file, used by background worker
+} ScreenRecorder;
+#endif
+
+#if defined(SUPPORT_PROFILER)
+// Profile trace frame, recorded for trace export
+typedef struct ProfileTraceFrame {
+    double start;                   // Frame start time
+    double end;                     // Frame end time
+    FrameProfile profile;           // Frame profile
+    int zoneCount;                  // Frame zones count
+    ProfileZone zones[MAX_PROFILE_ZONES];   // Frame zones
+} ProfileTraceFrame;
+
+// Profiler state
+// NOTE: Zones are registered on one buffer while last frame zones are kept on the other one
+typedef struct Profiler {
+    ProfileZone zones[2][MAX_PROFILE_ZONES];    // Zones buffers: current frame and last frame
+    int zoneCount[2];               // Zones count per buffer
+    int current;                    // Current frame zones buffer index
+    int stack[MAX_PROFILE_ZONE_DEPTH];  // Open zones indices (-1 if zone not registered)
+    int depth;                      // Open zones count
+    double frameStart;              // Current frame start time
+    FrameProfile frame;             // Last frame profile
+    bool gpuProfiling;              // GPU timer queries enabled
+
+    ProfileTraceFrame *trace;       // Trace frames ring, allocated while recording
+    unsigned int traceCount;        // Trace frames recorded count
+} Profiler;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -382,9 +591,7 @@ static int screenshotCounter = 0;           // Screenshots counter
 #endif
 
 #if defined(SUPPORT_GIF_RECORDING)
-static unsigned int gifFrameCounter = 0;    // GIF frames counter
-static bool gifRecording = false;           // GIF recording state
-static MsfGifState gifState = { 0 };        // MSGIF context state
+static ScreenRecorder recorder = { 0 };     // Screen recorder state
 #endif
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
@@ -419,6 +626,16 @@ typedef enum AutomationEventType {
     ACTION_SETTARGETFPS             // param[0]: fps
 } AutomationEventType;
 
+#define AUTOMATION_EVENT_TYPE_COUNT     (ACTION_SETTARGETFPS + 1)
+#define AUTOMATION_EVENT_MAX_SIZE       32          // Maximum size of an encoded event (binary format)
+#define AUTOMATION_EVENTS_FILE_VERSION  1           // Binary format version
+
+// Platforms registering input events from platform input callbacks,
+// other platforms record input state changes once per frame, at EndDrawing()
+#if defined(PLATFORM_DESKTOP_GLFW)
+    #define AUTOMATION_EVENTS_INPUT_CALLBACKS
+#endif
+
 // Event type to config events flags
 // TODO: Not used at the moment
 typedef enum {
@@ -459,6 +676,47 @@ static const char *autoEventTypeName[] = {
     "ACTION_SETTARGETFPS"
 };
 
+// Event type parameters count, only those parameters are stored in binary format
+static const unsigned char autoEventParamCount[AUTOMATION_EVENT_TYPE_COUNT] = {
+    0,                  // EVENT_NONE
+    1, 1, 1, 1,         // INPUT_KEY_UP, INPUT_KEY_DOWN, INPUT_KEY_PRESSED, INPUT_KEY_RELEASED
+    1, 1, 2, 2,         // INPUT_MOUSE_BUTTON_UP, INPUT_MOUSE_BUTTON_DOWN, INPUT_MOUSE_POSITION, INPUT_MOUSE_WHEEL_MOTION
+    1, 1, 2, 2, 3,      // INPUT_GAMEPAD_CONNECT, INPUT_GAMEPAD_DISCONNECT, INPUT_GAMEPAD_BUTTON_UP, INPUT_GAMEPAD_BUTTON_DOWN, INPUT_GAMEPAD_AXIS_MOTION
+    1, 1, 3, 1,         // INPUT_TOUCH_UP, INPUT_TOUCH_DOWN, INPUT_TOUCH_POSITION, INPUT_GESTURE
+    0, 0, 0, 2,         // WINDOW_CLOSE, WINDOW_MAXIMIZE, WINDOW_MINIMIZE, WINDOW_RESIZE
+    0, 1                // ACTION_TAKE_SCREENSHOT, ACTION_SETTARGETFPS
+};
+
+// Automation events binary format delta coding state
+// NOTE: Binary format (.rae): "rAE " file id (4 bytes) and version (4 bytes), followed by events until end of file,
+// every event is stored as a byte with type (5 bits) and frame delta (3 bits, 7 means varint follows),
+// followed by its parameters, stored as zig-zag varint deltas to previous event parameters of same type
+// Frames going backwards are stored as an EVENT_NONE record with varint absolute frame
+typedef struct AutomationEventCodec {
+    unsigned int frame;                                 // Previous event frame
+    int params[AUTOMATION_EVENT_TYPE_COUNT][3];         // Previous event parameters, per event type
+} AutomationEventCodec;
+
+// Automation events stream, binary file written/read through a memory buffer
+struct rAutomationStream {
+    FILE *file;                         // Stream file
+    unsigned char *data;                // Stream data buffer (AUTOMATION_STREAM_BUFFER_SIZE)
+    int size;                           // Stream data buffer bytes available
+    int offset;                         // Stream data buffer read offset
+    bool ended;                         // Stream file end reached (reading)
+    AutomationEventCodec codec;         // Events delta coding state
+};
+
+// Automation events recorder state
+typedef struct AutomationEventRecorder {
+    unsigned int frame;                 // Frame registered for input events received, available on next frame
+    AutomationEvent pending;            // Last event recorded, not written yet (same frame mouse position/wheel events are merged)
+    unsigned int gesture;               // Last gesture recorded
+    Vector2 touchPosition[MAX_TOUCH_POINTS];    // Last touch positions recorded
+    int gamepadAxis[MAX_GAMEPADS][MAX_GAMEPAD_AXIS];    // Last gamepad axis values recorded
+    rAutomationStream stream;           // Events stream recorded to, if set
+} AutomationEventRecorder;
+
 /*
 // Automation event (24 bytes)
 // NOTE: Opaque struct, internal to raylib
@@ -471,8 +729,13 @@ struct AutomationEvent {
 
 static AutomationEventList *currentEventList = NULL;        // Current automation events list, set by user, keep internal pointer
 static bool automationEventRecording = false;               // Recording automation events flag
+static AutomationEventRecorder automationRecorder = { 0 };  // Automation events recorder state
 //static short automationEventEnabled = 0b0000001111111111; // TODO: Automation events enabled for recording/playing
 #endif
+
+#if defined(SUPPORT_PROFILER)
+static Profiler profiler = { 0 };           // Profiler state
+#endif
 //-----------------------------------------------------------------------------------
 
 //----------------------------------------------------------------------------------
@@ -484,6 +747,9 @@ static bool automationEventRecording = false;               // Recording automat
 extern void LoadFontDefault(void);      // [Module: text] Loads default font on InitWindow()
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
+#if defined(SUPPORT_MODULE_RTEXT)
+extern void UnloadTextResources(void);  // [Module: text] Unloads text internal resources (built-in fonts shaders)
+#endif
 
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
@@ -492,16 +758,59 @@ static void InitTimer(void);                                // Initialize timer,
 static void SetupFramebuffer(int width, int height);        // Setup main framebuffer (required by InitPlatform())
 static void SetupViewport(int width, int height);           // Set viewport for a provided width and height
 
-static void ScanDirectoryFiles(const char *basePath, FilePathList *list, const char *filter);   // Scan all files and directories in a base path
-static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *list, const char *filter);  // Scan all files and directories recursively from a base path
+static void WaitUntilTime(double time);                     // Wait until time (GetTime() based), adapting busy wait to sleep overshoot
+#if !defined(SUPPORT_BUSY_WAIT_LOOP)
+static void SleepUntilTime(double currentTime, double time);    // Sleep until time (GetTime() based), absolute deadline if available
+#endif
+static int CompareFrameTimes(const void *a, const void *b); // Compare frame times, used by qsort()
+
+static void ScanDirectoryEntries(DirectoryScan *scan, int pathLength);     // Scan directory entries at scan path, recursively if required
+static bool IsFileExtensionInFilter(const char *fileName, const char *filter);  // Check if file name extension is in filter (thread-safe)
+static bool AppendFilePath(const char *path, bool isDirectory, void *arena);    // Append path to paths arena (ScanDirectoryCallback)
+static bool AppendScanJobEntry(const char *path, bool isDirectory, void *job);  // Append base path entry to parallel scan jobs data (ScanDirectoryCallback)
+static void ScanDirectoryJob(void *data, int index);        // Scan subdirectory job (parallel directory scan)
+static void ScanDirectoryParallel(const char *basePath, const char *filter, FilePathArena *arena);  // Scan directory recursively, subdirectories scanned in parallel
+static FilePathList LoadFilePathList(const FilePathArena *arena);          // Load file paths list from arena (single memory block)
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
-static void RecordAutomationEvent(void); // Record frame events (to internal events array)
+static void RecordAutomationEvent(int type, int param0, int param1, int param2);   // Record automation event (from platform input callbacks)
+static void RecordAutomationFrameEvents(void);              // Record frame input state changes as automation events, at EndDrawing()
+static void WriteAutomationEvent(AutomationEvent event);    // Write automation event to events list and events stream
+static bool FlushAutomationEventStream(rAutomationStream *stream);     // Write automation events stream buffered data to file
+static bool ReadAutomationEventStream(rAutomationStream *stream, AutomationEvent *event);  // Read next automation event from stream
+static int EncodeAutomationEvent(AutomationEventCodec *codec, AutomationEvent event, unsigned char *data);  // Encode automation event (binary format), returns bytes written
+static int DecodeAutomationEvent(AutomationEventCodec *codec, const unsigned char *data, int dataSize, AutomationEvent *event);  // Decode automation event, returns bytes read, 0 if incomplete, -1 if invalid
+static bool AddAutomationEvent(AutomationEventList *list, AutomationEvent event);  // Add event to automation events list, capacity grows as required
+static int WriteVarint(unsigned char *data, unsigned int value);                   // Write LEB128 variable length value, returns bytes written
+static int ReadVarint(const unsigned char *data, int dataSize, unsigned int *value);   // Read LEB128 variable length value, returns bytes read, 0 if incomplete, -1 if invalid
+#endif
+
+#if defined(SUPPORT_GIF_RECORDING)
+static void RecordScreenFrame(void);                        // Record current screen frame, if recording frame is due
+static void ProcessRecordingReadbacks(bool waitAll);        // Retrieve finished screen readbacks and queue frames for encoding
+static void QueueRecordingFrame(unsigned int pixelBuffer, int delay);  // Queue screen frame for encoding, dropped if queue is full
+static void EncodeRecordingFrame(void *data);               // Encode recorded frame (background job)
+#endif
+
+#if defined(SUPPORT_PROFILER)
+static void EndProfileFrame(void);      // Register frame profile and zones, reset render statistics for next frame
+static bool AppendProfileTrace(char **buffer, size_t *bufferSize, size_t *offset, const char *format, ...);    // Append formatted text to trace buffer, buffer grows as required
+#endif
+
+static inline unsigned int ReadU32LE(const unsigned char *p);              // Read 32 bit little-endian value from bytes
+static inline unsigned long long ReadU64LE(const unsigned char *p);        // Read 64 bit little-endian value from bytes
+static inline unsigned long long XXH64Round(unsigned long long acc, unsigned long long input);  // XXH64 round, accumulate 64 bit input lane
+static unsigned int UpdateCRC32(unsigned int crc, const unsigned char *data, int dataSize);  // Update CRC32 value with data (no initial/final inversion)
+static void ProcessHashBlocks(HashState *state, const unsigned char *data, int blockCount);  // Process full hash blocks (MD5, SHA-1, XXH64)
+
+#if defined(SUPPORT_COMPRESSION_API)
+static void CompressDataJob(void *data, int index);         // Compress data blocks job (parallel compression)
+static void DecompressDataJob(void *data, int index);       // Decompress data block job (parallel decompression)
 #endif
 
 #if defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
-void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
+void __stdcall Sleep(unsigned long msTimeout);              // Required for: SleepUntilTime()
 #endif
 
 #if !defined(SUPPORT_MODULE_RTEXT)
@@ -722,16 +1031,26 @@ void InitWindow(int width, int height, const char *title)
 void CloseWindow(void)
 {
 #if defined(SUPPORT_GIF_RECORDING)
-    if (gifRecording)
-    {
-        MsfGifResult result = msf_gif_end(&gifState);
-        msf_gif_free(result);
-        gifRecording = false;
-    }
+    if (recorder.recording) StopScreenRecording();
 #endif
 
-#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    StopAutomationEventRecording();
+    SetAutomationEventStream(NULL);
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXT)
+    #if defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();        // WARNING: Module required: rtext
+    #endif
+    UnloadTextResources();      // WARNING: Module required: rtext
+#endif
+
+#if defined(SUPPORT_PROFILER)
+    RL_FREE(profiler.trace);
+    profiler.trace = NULL;
+    profiler.traceCount = 0;
+    profiler.gpuProfiling = false;
 #endif
 
     rlglClose();                // De-init rlgl
@@ -889,39 +1208,17 @@ void EndDrawing(void)
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
 #if defined(SUPPORT_GIF_RECORDING)
-    // Draw record indicator
-    if (gifRecording)
+    if (recorder.recording)
     {
-        #ifndef GIF_RECORD_FRAMERATE
-        #define GIF_RECORD_FRAMERATE    10
-        #endif
-        gifFrameCounter += (unsigned int)(GetFrameTime()*1000);
-
-        // NOTE: We record one gif frame depending on the desired gif framerate
-        if (gifFrameCounter > 1000/GIF_RECORD_FRAMERATE)
-        {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
-            Vector2 scale = GetWindowScaleDPI();
-            unsigned char *screenData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-
-            #ifndef GIF_RECORD_BITRATE
-            #define GIF_RECORD_BITRATE 16
-            #endif
-
-            // Add the frame to the gif recording, given how many frames have passed in centiseconds
-            msf_gif_frame(&gifState, screenData, gifFrameCounter/10, GIF_RECORD_BITRATE, (int)((float)CORE.Window.render.width*scale.x)*4);
-            gifFrameCounter -= 1000/GIF_RECORD_FRAMERATE;
-
-            RL_FREE(screenData);    // Free image data
-        }
+        // NOTE: Screen readback is requested before drawing the record indicator, it is not recorded
+        RecordScreenFrame();
 
     #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
         // Display the recording indicator every half-second
-        if ((int)(GetTime()/0.5)%2 == 1)
+        if (recorder.recording && ((int)(GetTime()/0.5)%2 == 1))
         {
             DrawCircle(30, CORE.Window.screen.height - 20, 10, MAROON);                 // WARNING: Module required: rshapes
-            DrawText("GIF RECORDING", 50, CORE.Window.screen.height - 25, 10, RED);     // WARNING: Module required: rtext
+            DrawText((recorder.format == RECORDING_FORMAT_GIF)? "GIF RECORDING" : "RECORDING", 50, CORE.Window.screen.height - 25, 10, RED);     // WARNING: Module required: rtext
         }
     #endif
 
@@ -930,7 +1227,8 @@ void EndDrawing(void)
 #endif
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
-    if (automationEventRecording) RecordAutomationEvent();    // Event recording
+    if (automationEventRecording) RecordAutomationFrameEvents();  // Event recording
+    automationRecorder.frame = CORE.Time.frameCounter + 1;      // Input received from now on is available next frame
 #endif
 
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
@@ -943,18 +1241,38 @@ void EndDrawing(void)
 
     CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
 
-    // Wait for some milliseconds...
-    if (CORE.Time.frame < CORE.Time.target)
+    bool frameMissed = false;
+
+    if (CORE.Time.target > 0.0)
     {
-        WaitTime(CORE.Time.target - CORE.Time.frame);
+        // Frames are paced to absolute deadlines, sleep overshoot on a frame does not delay next ones
+        // NOTE: First paced frame deadline is set from frame start time
+        if (CORE.Time.deadline <= 0.0) CORE.Time.deadline = CORE.Time.current - CORE.Time.frame + CORE.Time.target;
+        else CORE.Time.deadline += CORE.Time.target;
+
+        // Wait for some milliseconds...
+        if (CORE.Time.current < CORE.Time.deadline)
+        {
+            WaitUntilTime(CORE.Time.deadline);
 
-        CORE.Time.current = GetTime();
-        double waitTime = CORE.Time.current - CORE.Time.previous;
-        CORE.Time.previous = CORE.Time.current;
+            CORE.Time.current = GetTime();
+            double waitTime = CORE.Time.current - CORE.Time.previous;
+            CORE.Time.previous = CORE.Time.current;
 
-        CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
+            CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
+        }
+
+        frameMissed = ((CORE.Time.current - CORE.Time.deadline) > FRAME_DEADLINE_MISS_TIME);
+
+        // Deadline is reset when more than one frame late, no burst of frames to catch up
+        if ((CORE.Time.current - CORE.Time.deadline) > CORE.Time.target) CORE.Time.deadline = CORE.Time.current;
     }
 
+    // Register frame time for frame time statistics
+    CORE.Time.frameTimes[CORE.Time.frameTimeCount%FRAME_TIME_HISTORY_COUNT] = (float)CORE.Time.frame;
+    CORE.Time.frameMissed[CORE.Time.frameTimeCount%FRAME_TIME_HISTORY_COUNT] = frameMissed;
+    CORE.Time.frameTimeCount++;
+
     PollInputEvents();      // Poll user events (before next frame update)
 #endif
 
@@ -964,27 +1282,11 @@ void EndDrawing(void)
 #if defined(SUPPORT_GIF_RECORDING)
         if (IsKeyDown(KEY_LEFT_CONTROL))
         {
-            if (gifRecording)
-            {
-                gifRecording = false;
-
-                MsfGifResult result = msf_gif_end(&gifState);
-
-                SaveFileData(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
-                msf_gif_free(result);
-
-                TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
-            }
+            if (recorder.recording) StopScreenRecording();
             else
             {
-                gifRecording = true;
-                gifFrameCounter = 0;
-
-                Vector2 scale = GetWindowScaleDPI();
-                msf_gif_begin(&gifState, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
+                StartScreenRecording(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), GIF_RECORD_FRAMERATE);
                 screenshotCounter++;
-
-                TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
             }
         }
         else
@@ -996,6 +1298,10 @@ void EndDrawing(void)
     }
 #endif  // SUPPORT_SCREEN_CAPTURE
 
+#if defined(SUPPORT_PROFILER)
+    EndProfileFrame();
+#endif
+
     CORE.Time.frameCounter++;
 }
 
@@ -1409,6 +1715,34 @@ void UnloadShader(Shader shader)
     }
 }
 
+// Reload shader from files in place, i.e. on watched file changes
+// NOTE: On failure (shader compilation/linkage) previous shader is kept,
+// on success shader locations are reset to default ones, custom locations must be set again
+bool ReloadShader(Shader *shader, const char *vsFileName, const char *fsFileName)
+{
+    bool result = false;
+    Shader reloaded = LoadShader(vsFileName, fsFileName);
+
+    // NOTE: Default shader is returned if loading fails
+    if (IsShaderValid(reloaded) && (reloaded.id != rlGetShaderIdDefault()))
+    {
+        UnloadShader(*shader);
+        *shader = reloaded;
+        result = true;
+
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Shader reloaded successfully", shader->id);
+    }
+    else
+    {
+        if (reloaded.id == rlGetShaderIdDefault()) RL_FREE(reloaded.locs);
+        else UnloadShader(reloaded);
+
+        TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to reload shader, previous shader kept", shader->id);
+    }
+
+    return result;
+}
+
 // Get shader uniform location
 int GetShaderLocation(Shader shader, const char *uniformName)
 {
@@ -1647,6 +1981,8 @@ void SetTargetFPS(int fps)
     if (fps < 1) CORE.Time.target = 0.0;
     else CORE.Time.target = 1.0/(double)fps;
 
+    CORE.Time.deadline = 0.0;   // Frame deadlines are set again from next frame
+
     TRACELOG(LOG_INFO, "TIMER: Target time per frame: %02.03f milliseconds", (float)CORE.Time.target*1000.0f);
 }
 
@@ -1699,6 +2035,220 @@ float GetFrameTime(void)
     return (float)CORE.Time.frame;
 }
 
+// Get frame time statistics, measured over last frames (FRAME_TIME_HISTORY_COUNT)
+// NOTE: Frame times are registered by EndDrawing(), deadlines are only missed with a target FPS set
+FrameTimeStats GetFrameTimeStats(void)
+{
+    FrameTimeStats stats = { 0 };
+    float frameTimes[FRAME_TIME_HISTORY_COUNT] = { 0 };
+
+    int count = (CORE.Time.frameTimeCount < FRAME_TIME_HISTORY_COUNT)? (int)CORE.Time.frameTimeCount : FRAME_TIME_HISTORY_COUNT;
+
+    if (count > 0)
+    {
+        double total = 0.0;
+
+        for (int i = 0; i < count; i++)
+        {
+            frameTimes[i] = CORE.Time.frameTimes[i];
+            total += frameTimes[i];
+            if (CORE.Time.frameMissed[i]) stats.missedCount++;
+        }
+
+        qsort(frameTimes, count, sizeof(float), CompareFrameTimes);
+
+        // NOTE: Percentiles use nearest-rank method
+        stats.frameCount = count;
+        stats.average = (float)(total/count);
+        stats.median = frameTimes[(count - 1)/2];
+        stats.p95 = frameTimes[(95*count + 99)/100 - 1];
+        stats.p99 = frameTimes[(99*count + 99)/100 - 1];
+        stats.max = frameTimes[count - 1];
+    }
+
+    stats.spinMargin = (float)CORE.Time.spinMargin;
+
+    return stats;
+}
+
+#if defined(SUPPORT_PROFILER)
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Profiling
+//----------------------------------------------------------------------------------
+
+// Begin CPU profile zone
+// NOTE: Zone name pointer is stored, not copied, it must remain valid until zone data is used
+void BeginProfileZone(const char *name)
+{
+    int index = -1;
+    int current = profiler.current;
+
+    if (profiler.zoneCount[current] < MAX_PROFILE_ZONES)
+    {
+        index = profiler.zoneCount[current];
+        profiler.zoneCount[current]++;
+
+        profiler.zones[current][index].name = (name != NULL)? name : "";
+        profiler.zones[current][index].depth = profiler.depth;
+        profiler.zones[current][index].duration = 0.0f;
+        profiler.zones[current][index].start = GetTime();
+    }
+
+    if (profiler.depth < MAX_PROFILE_ZONE_DEPTH) profiler.stack[profiler.depth] = index;
+    profiler.depth++;
+}
+
+// End current CPU profile zone
+void EndProfileZone(void)
+{
+    double time = GetTime();
+
+    if (profiler.depth == 0)
+    {
+        TRACELOG(LOG_WARNING, "PROFILER: EndProfileZone() called without a matching BeginProfileZone()");
+        return;
+    }
+
+    profiler.depth--;
+
+    if (profiler.depth < MAX_PROFILE_ZONE_DEPTH)
+    {
+        int index = profiler.stack[profiler.depth];
+
+        if (index >= 0) profiler.zones[profiler.current][index].duration = (float)(time - profiler.zones[profiler.current][index].start);
+    }
+}
+
+// Get last frame profile
+FrameProfile GetFrameProfile(void)
+{
+    return profiler.frame;
+}
+
+// Get last frame profile zones
+// NOTE: Returned zones are valid until next EndDrawing()
+const ProfileZone *GetFrameProfileZones(int *count)
+{
+    int last = 1 - profiler.current;
+
+    if (count != NULL) *count = profiler.zoneCount[last];
+
+    return profiler.zones[last];
+}
+
+// Enable GPU time measure with timer queries
+// NOTE: Render batch draws and mesh draws are measured, results are available with a few frames of latency
+bool EnableGpuProfiling(void)
+{
+    profiler.gpuProfiling = rlEnableGpuTimers();
+
+    return profiler.gpuProfiling;
+}
+
+// Disable GPU time measure
+void DisableGpuProfiling(void)
+{
+    rlDisableGpuTimers();
+    profiler.gpuProfiling = false;
+}
+
+// Start recording frames profile for trace export
+// NOTE: Last MAX_PROFILE_TRACE_FRAMES frames are kept
+void StartProfileTrace(void)
+{
+    if (profiler.trace == NULL) profiler.trace = (ProfileTraceFrame *)RL_MALLOC(MAX_PROFILE_TRACE_FRAMES*sizeof(ProfileTraceFrame));
+
+    if (profiler.trace != NULL) TRACELOG(LOG_INFO, "PROFILER: Start profile trace recording");
+    else TRACELOG(LOG_WARNING, "PROFILER: Failed to allocate profile trace frames");
+
+    profiler.traceCount = 0;
+}
+
+// Export recorded frames profile as trace-event JSON and stop recording
+// NOTE: Trace can be opened with chrome://tracing or https://ui.perfetto.dev
+bool ExportProfileTrace(const char *fileName)
+{
+    bool success = false;
+
+    if (profiler.trace == NULL)
+    {
+        TRACELOG(LOG_WARNING, "PROFILER: Profile trace not recording, use StartProfileTrace()");
+        return success;
+    }
+
+    unsigned int frameCount = (profiler.traceCount < MAX_PROFILE_TRACE_FRAMES)? profiler.traceCount : MAX_PROFILE_TRACE_FRAMES;
+    unsigned int first = profiler.traceCount - frameCount;
+
+    // Calculate required buffer size, zone names could require escaping (2 chars per char)
+    size_t bufferSize = 64;
+    for (unsigned int i = 0; i < frameCount; i++)
+    {
+        const ProfileTraceFrame *frame = &profiler.trace[(first + i)%MAX_PROFILE_TRACE_FRAMES];
+
+        bufferSize += 640;
+        for (int z = 0; z < frame->zoneCount; z++) bufferSize += 2*strlen(frame->zones[z].name) + 128;
+    }
+
+    char *buffer = (char *)RL_MALLOC(bufferSize);
+    if (buffer == NULL) return success;
+
+    size_t offset = 0;
+    bool valid = AppendProfileTrace(&buffer, &bufferSize, &offset, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+    for (unsigned int i = 0; valid && (i < frameCount); i++)
+    {
+        const ProfileTraceFrame *frame = &profiler.trace[(first + i)%MAX_PROFILE_TRACE_FRAMES];
+        const FrameProfile *profile = &frame->profile;
+
+        // Frame event, zone events and frame counters, times in microseconds
+        valid = AppendProfileTrace(&buffer, &bufferSize, &offset,
+            "%s{\"name\":\"Frame %u\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+            (i > 0)? ",\n" : "", first + i, frame->start*1e6, (frame->end - frame->start)*1e6);
+
+        for (int z = 0; valid && (z < frame->zoneCount); z++)
+        {
+            const ProfileZone *zone = &frame->zones[z];
+
+            // Zone name escaped for JSON, long names are truncated
+            char name[256] = { 0 };
+            int length = 0;
+            for (const char *c = zone->name; (*c != '\0') && (length < (int)sizeof(name) - 2); c++)
+            {
+                if ((*c == '"') || (*c == '\\')) name[length++] = '\\';
+                name[length++] = ((unsigned char)*c < 0x20)? ' ' : *c;
+            }
+
+            valid = AppendProfileTrace(&buffer, &bufferSize, &offset, ",\n{\"name\":\"%s\",\"cat\":\"zone\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+                name, zone->start*1e6, zone->duration*1e6);
+        }
+
+        valid = valid && AppendProfileTrace(&buffer, &bufferSize, &offset,
+            ",\n{\"name\":\"Frame time (ms)\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"update\":%.3f,\"draw\":%.3f,\"gpu\":%.3f}}",
+            frame->start*1e6, profile->updateTime*1000.0f, profile->drawTime*1000.0f, (profile->gpuTime > 0.0f)? profile->gpuTime*1000.0f : 0.0f);
+        valid = valid && AppendProfileTrace(&buffer, &bufferSize, &offset,
+            ",\n{\"name\":\"Render\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"drawCalls\":%i,\"batchFlushes\":%i,\"batchOverflows\":%i,\"textureBinds\":%i,\"shaderChanges\":%i,\"stateChanges\":%i}}",
+            frame->start*1e6, profile->drawCalls, profile->batchFlushes, profile->batchOverflows, profile->textureBinds, profile->shaderChanges, profile->stateChanges);
+        valid = valid && AppendProfileTrace(&buffer, &bufferSize, &offset,
+            ",\n{\"name\":\"Uploads (KB)\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"uploaded\":%.3f}}",
+            frame->start*1e6, profile->uploadedBytes/1024.0f);
+    }
+
+    valid = valid && AppendProfileTrace(&buffer, &bufferSize, &offset, "\n]}\n");
+
+    if (valid) success = SaveFileText(fileName, buffer);
+    RL_FREE(buffer);
+
+    if (success) TRACELOG(LOG_INFO, "PROFILER: [%s] Profile trace exported successfully (%u frames)", fileName, frameCount);
+    else TRACELOG(LOG_WARNING, "PROFILER: [%s] Failed to export profile trace", fileName);
+
+    RL_FREE(profiler.trace);
+    profiler.trace = NULL;
+    profiler.traceCount = 0;
+
+    return success;
+}
+#endif  // SUPPORT_PROFILER
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Custom frame control
 //----------------------------------------------------------------------------------
@@ -1716,41 +2266,7 @@ void WaitTime(double seconds)
 {
     if (seconds < 0) return;    // Security check
 
-#if defined(SUPPORT_BUSY_WAIT_LOOP) || defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-    double destinationTime = GetTime() + seconds;
-#endif
-
-#if defined(SUPPORT_BUSY_WAIT_LOOP)
-    while (GetTime() < destinationTime) { }
-#else
-    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-        double sleepSeconds = seconds - seconds*0.05;  // NOTE: We reserve a percentage of the time for busy waiting
-    #else
-        double sleepSeconds = seconds;
-    #endif
-
-    // System halt functions
-    #if defined(_WIN32)
-        Sleep((unsigned long)(sleepSeconds*1000.0));
-    #endif
-    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
-        struct timespec req = { 0 };
-        time_t sec = sleepSeconds;
-        long nsec = (sleepSeconds - sec)*1000000000L;
-        req.tv_sec = sec;
-        req.tv_nsec = nsec;
-
-        // NOTE: Use nanosleep() on Unix platforms... usleep() it's deprecated
-        while (nanosleep(&req, &req) == -1) continue;
-    #endif
-    #if defined(__APPLE__)
-        usleep(sleepSeconds*1000000.0);
-    #endif
-
-    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-        while (GetTime() < destinationTime) { }
-    #endif
-#endif
+    WaitUntilTime(GetTime() + seconds);
 }
 
 //----------------------------------------------------------------------------------
@@ -1873,41 +2389,177 @@ void TakeScreenshot(const char *fileName)
 #endif
 }
 
-// Setup window configuration flags (view FLAGS)
-// NOTE: This function is expected to be called before window creation,
-// because it sets up some flags for the window creation process
-// To configure window states after creation, just use SetWindowState()
-void SetConfigFlags(unsigned int flags)
+// Start screen recording, file extension defines format:
+//  - .gif: animated GIF, frame rate limited to 50 fps (GIF frame delay is defined in centiseconds)
+//  - .qoi: QOI frames sequence (lossless), one file per frame: <fileName>_00000.qoi, <fileName>_00001.qoi...
+//  - .raw: raw RGBA frames stream (lossless), i.e. ffmpeg -f rawvideo -pix_fmt rgba -s <width>x<height> -r <fps> -i <fileName>
+// NOTE: Frames are recorded at provided fps (0 to record every frame) and encoded on a background thread,
+// frames are dropped if the encoder can not keep up with the recording rate
+bool StartScreenRecording(const char *fileName, int fps)
 {
-    // Selected flags are set but not evaluated at this point,
-    // flag evaluation happens at InitWindow() or SetWindowState()
-    CORE.Window.flags |= flags;
-}
-
-//----------------------------------------------------------------------------------
-// Module Functions Definition: File system
-//----------------------------------------------------------------------------------
+    bool success = false;
 
-// Check if the file exists
-bool FileExists(const char *fileName)
-{
-    bool result = false;
+#if defined(SUPPORT_GIF_RECORDING)
+    if (recorder.recording)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Screen recording already active");
+        return success;
+    }
 
-#if defined(_WIN32)
-    if (_access(fileName, 0) != -1) result = true;
-#else
-    if (access(fileName, F_OK) != -1) result = true;
+    int format = -1;
+    if (IsFileExtension(fileName, ".gif")) format = RECORDING_FORMAT_GIF;
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_FILEFORMAT_QOI)
+    else if (IsFileExtension(fileName, ".qoi")) format = RECORDING_FORMAT_QOI;
 #endif
+    else if (IsFileExtension(fileName, ".raw")) format = RECORDING_FORMAT_RAW;
 
-    // NOTE: Alternatively, stat() can be used instead of access()
-    //#include <sys/stat.h>
-    //struct stat statbuf;
-    //if (stat(filename, &statbuf) == 0) result = true;
+    if (format < 0)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screen recording format not supported", fileName);
+        return success;
+    }
 
-    return result;
-}
+    Vector2 scale = GetWindowScaleDPI();
+    ScreenRecorder *rec = &recorder;
 
-// Check file extension
+    memset(rec, 0, sizeof(ScreenRecorder));
+    rec->format = format;
+    rec->width = (int)((float)CORE.Window.render.width*scale.x);
+    rec->height = (int)((float)CORE.Window.render.height*scale.y);
+
+    if (format == RECORDING_FORMAT_GIF) fps = ((fps <= 0) || (fps > 50))? 50 : fps;
+    rec->interval = (fps > 0)? 1.0/fps : 0.0;
+    rec->nextTime = GetTime();
+    rec->prevTime = rec->nextTime - rec->interval;
+
+    // QOI frames file names use provided file name without extension as prefix
+    strncpy(rec->fileName, fileName, MAX_FILEPATH_LENGTH - 1);
+    if (format == RECORDING_FORMAT_QOI) *strrchr(rec->fileName, '.') = '\0';
+
+    success = true;
+
+    if (format == RECORDING_FORMAT_GIF) msf_gif_begin(&rec->gifState, rec->width, rec->height);
+    else if (format == RECORDING_FORMAT_RAW)
+    {
+        rec->rawFile = fopen(fileName, "wb");
+        success = (rec->rawFile != NULL);
+    }
+
+    for (int i = 0; (i < MAX_RECORDING_QUEUE_FRAMES) && success; i++)
+    {
+        rec->frames[i].data = (unsigned char *)RL_MALLOC((size_t)rec->width*rec->height*4);
+        success = (rec->frames[i].data != NULL);
+    }
+
+    if (success) rec->worker = LoadBackgroundWorker(MAX_RECORDING_QUEUE_FRAMES);
+    success = success && (rec->worker != NULL);
+
+    if (success)
+    {
+        // Async readback requires pixel buffers, if not supported frames are read synchronously
+        for (int i = 0; i < RECORDING_READBACK_BUFFERS; i++) rec->pixelBuffers[i] = rlLoadPixelBuffer(rec->width*rec->height*4);
+        if (rec->pixelBuffers[0] == 0) TRACELOG(LOG_INFO, "SYSTEM: Async screen readback not supported, screen read synchronously");
+
+        rec->recording = true;
+        TRACELOG(LOG_INFO, "SYSTEM: [%s] Start screen recording (%i x %i, %i fps)", fileName, rec->width, rec->height, fps);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: [%s] Failed to start screen recording", fileName);
+
+        if (format == RECORDING_FORMAT_GIF) msf_gif_free(msf_gif_end(&rec->gifState));
+        if (rec->rawFile != NULL) fclose(rec->rawFile);
+        for (int i = 0; i < MAX_RECORDING_QUEUE_FRAMES; i++) RL_FREE(rec->frames[i].data);
+        memset(rec, 0, sizeof(ScreenRecorder));
+    }
+#else
+    TRACELOG(LOG_WARNING, "SYSTEM: Screen recording requires SUPPORT_GIF_RECORDING");
+#endif
+
+    return success;
+}
+
+// Stop screen recording, waits for pending frames to be encoded
+void StopScreenRecording(void)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    ScreenRecorder *rec = &recorder;
+
+    if (!rec->recording) return;
+
+    ProcessRecordingReadbacks(true);
+    UnloadBackgroundWorker(rec->worker);    // Waits for queued frames to be encoded
+
+    for (int i = 0; i < RECORDING_READBACK_BUFFERS; i++) if (rec->pixelBuffers[i] != 0) rlUnloadPixelBuffer(rec->pixelBuffers[i]);
+    for (int i = 0; i < MAX_RECORDING_QUEUE_FRAMES; i++) RL_FREE(rec->frames[i].data);
+
+    bool success = true;
+
+    if (rec->format == RECORDING_FORMAT_GIF)
+    {
+        MsfGifResult result = msf_gif_end(&rec->gifState);
+        success = SaveFileData(rec->fileName, result.data, (int)result.dataSize);
+        msf_gif_free(result);
+    }
+    else if (rec->format == RECORDING_FORMAT_RAW) success = (fclose(rec->rawFile) == 0);
+
+    if (rec->droppedCount > 0) TRACELOG(LOG_WARNING, "SYSTEM: Screen recording dropped %u frames, encoding could not keep up", rec->droppedCount);
+
+    if (success) TRACELOG(LOG_INFO, "SYSTEM: [%s] Finish screen recording (%u frames)", rec->fileName, rec->frameCount);
+    else TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screen recording could not be saved", rec->fileName);
+
+    memset(rec, 0, sizeof(ScreenRecorder));
+#endif
+}
+
+// Check if screen is being recorded
+bool IsScreenRecording(void)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    return recorder.recording;
+#else
+    return false;
+#endif
+}
+
+// Setup window configuration flags (view FLAGS)
+// NOTE: This function is expected to be called before window creation,
+// because it sets up some flags for the window creation process
+// To configure window states after creation, just use SetWindowState()
+void SetConfigFlags(unsigned int flags)
+{
+    // Selected flags are set but not evaluated at this point,
+    // flag evaluation happens at InitWindow() or SetWindowState()
+    CORE.Window.flags |= flags;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: File system
+//----------------------------------------------------------------------------------
+
+// Check if the file exists
+bool FileExists(const char *fileName)
+{
+    bool result = false;
+    size_t archivedSize = 0;
+
+    if (IsFileArchived(fileName, &archivedSize)) return true;
+
+#if defined(_WIN32)
+    if (_access(fileName, 0) != -1) result = true;
+#else
+    if (access(fileName, F_OK) != -1) result = true;
+#endif
+
+    // NOTE: Alternatively, stat() can be used instead of access()
+    //#include <sys/stat.h>
+    //struct stat statbuf;
+    //if (stat(filename, &statbuf) == 0) result = true;
+
+    return result;
+}
+
+// Check file extension
 // NOTE: Extensions checking is not case-sensitive
 bool IsFileExtension(const char *fileName, const char *ext)
 {
@@ -1968,6 +2620,17 @@ int GetFileLength(const char *fileName)
     //stat(fileName, &result);
     //return result.st_size;
 
+    size_t archivedSize = 0;
+
+    if (IsFileArchived(fileName, &archivedSize))
+    {
+        // Check for size overflow (INT_MAX)
+        if (archivedSize > 2147483647) TRACELOG(LOG_WARNING, "[%s] File size overflows expected limit, do not use GetFileLength()", fileName);
+        else size = (int)archivedSize;
+
+        return size;
+    }
+
     FILE *file = fopen(fileName, "rb");
 
     if (file != NULL)
@@ -2226,71 +2889,65 @@ const char *GetApplicationDirectory(void)
 }
 
 // Load directory filepaths
-// NOTE: Base path is prepended to the scanned filepaths
-// WARNING: Directory is scanned twice, first time to get files count
+// NOTE: Base path is prepended to the scanned filepaths, directories are also included
 // No recursive scanning is done!
 FilePathList LoadDirectoryFiles(const char *dirPath)
 {
-    FilePathList files = { 0 };
-    unsigned int fileCounter = 0;
-
-    struct dirent *entity;
-    DIR *dir = opendir(dirPath);
-
-    if (dir != NULL) // It's a directory
-    {
-        // SCAN 1: Count files
-        while ((entity = readdir(dir)) != NULL)
-        {
-            // NOTE: We skip '.' (current dir) and '..' (parent dir) filepaths
-            if ((strcmp(entity->d_name, ".") != 0) && (strcmp(entity->d_name, "..") != 0)) fileCounter++;
-        }
-
-        // Memory allocation for dirFileCount
-        files.capacity = fileCounter;
-        files.paths = (char **)RL_MALLOC(files.capacity*sizeof(char *));
-        for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_MALLOC(MAX_FILEPATH_LENGTH*sizeof(char));
-
-        closedir(dir);
-
-        // SCAN 2: Read filepaths
-        // NOTE: Directory paths are also registered
-        ScanDirectoryFiles(dirPath, &files, NULL);
-
-        // Security check: read files.count should match fileCounter
-        if (files.count != files.capacity) TRACELOG(LOG_WARNING, "FILEIO: Read files count do not match capacity allocated");
-    }
-    else TRACELOG(LOG_WARNING, "FILEIO: Failed to open requested directory");  // Maybe it's a file...
-
-    return files;
+    return LoadDirectoryFilesEx(dirPath, NULL, false);
 }
 
 // Load directory filepaths with extension filtering and recursive directory scan
-// NOTE: On recursive loading we do not pre-scan for file count, we use MAX_FILEPATH_CAPACITY
+// NOTE: Directory is scanned in a single pass, paths are packed in a single memory block (no capacity limit),
+// on recursive scan, base path subdirectories are scanned in parallel if multiple cores are available
 FilePathList LoadDirectoryFilesEx(const char *basePath, const char *filter, bool scanSubdirs)
 {
-    FilePathList files = { 0 };
-
-    files.capacity = MAX_FILEPATH_CAPACITY;
-    files.paths = (char **)RL_CALLOC(files.capacity, sizeof(char *));
-    for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_CALLOC(MAX_FILEPATH_LENGTH, sizeof(char));
+    FilePathArena arena = { 0 };
 
     // WARNING: basePath is always prepended to scanned paths
-    if (scanSubdirs) ScanDirectoryFilesRecursively(basePath, &files, filter);
-    else ScanDirectoryFiles(basePath, &files, filter);
+    if (scanSubdirs && (GetWorkerThreadCount() > 1)) ScanDirectoryParallel(basePath, filter, &arena);
+    else ScanDirectoryFiles(basePath, filter, scanSubdirs, AppendFilePath, &arena);
+
+    FilePathList files = LoadFilePathList(&arena);
+    RL_FREE(arena.data);
 
     return files;
 }
 
 // Unload directory filepaths
+// NOTE: Paths pointers and strings are allocated in a single memory block
 // WARNING: files.count is not reseted to 0 after unloading
 void UnloadDirectoryFiles(FilePathList files)
 {
-    for (unsigned int i = 0; i < files.capacity; i++) RL_FREE(files.paths[i]);
-
     RL_FREE(files.paths);
 }
 
+// Scan directory filepaths calling callback per path
+// NOTE: No paths are stored, path passed to callback is only valid during the call,
+// filter works as on LoadDirectoryFilesEx(), use 'DIR' in the filter string to report directories
+unsigned int ScanDirectoryFiles(const char *basePath, const char *filter, bool scanSubdirs, ScanDirectoryCallback callback, void *userData)
+{
+    if ((basePath == NULL) || (callback == NULL)) return 0;
+
+    int pathLength = (int)strlen(basePath);
+    if (pathLength >= MAX_FILEPATH_LENGTH)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: Directory path too long (%s)", basePath);
+        return 0;
+    }
+
+    DirectoryScan scan = { 0 };
+    scan.filter = filter;
+    scan.includeDirs = (filter == NULL)? !scanSubdirs : (strstr(filter, DIRECTORY_FILTER_TAG) != NULL);
+    scan.scanSubdirs = scanSubdirs;
+    scan.callback = callback;
+    scan.userData = userData;
+    memcpy(scan.path, basePath, pathLength + 1);
+
+    ScanDirectoryEntries(&scan, pathLength);
+
+    return scan.count;
+}
+
 // Create directories (including full path requested), returns 0 on success
 int MakeDirectory(const char *dirPath)
 {
@@ -2462,18 +3119,25 @@ long GetFileModTime(const char *fileName)
 // Compress data (DEFLATE algorithm)
 unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize)
 {
-    #define COMPRESSION_QUALITY_DEFLATE  8
-
     unsigned char *compData = NULL;
+    *compDataSize = 0;
 
 #if defined(SUPPORT_COMPRESSION_API)
     // Compress data and generate a valid DEFLATE stream
-    struct sdefl *sdefl = RL_CALLOC(1, sizeof(struct sdefl));   // WARNING: Possible stack overflow, struct sdefl is almost 1MB
-    int bounds = sdefl_bound(dataSize);
-    compData = (unsigned char *)RL_CALLOC(bounds, 1);
+    Compressor compressor = LoadCompressor(COMPRESSION_QUALITY_DEFLATE);     // Compression level 8, same as stbiw
+    int bounds = GetCompressDataBound(dataSize);
+    compData = (unsigned char *)RL_MALLOC(bounds);
+
+    if ((compressor.state != NULL) && (compData != NULL))
+    {
+        *compDataSize = CompressDataTo(compressor, data, dataSize, compData, bounds);
 
-    *compDataSize = sdeflate(sdefl, compData, data, dataSize, COMPRESSION_QUALITY_DEFLATE);   // Compression level 8, same as stbiw
-    RL_FREE(sdefl);
+        // Shrink buffer to compressed data size
+        unsigned char *temp = (unsigned char *)RL_REALLOC(compData, (*compDataSize > 0)? *compDataSize : 1);
+        if (temp != NULL) compData = temp;
+    }
+
+    UnloadCompressor(compressor);
 
     TRACELOG(LOG_INFO, "SYSTEM: Compress data: Original size: %i -> Comp. size: %i", dataSize, *compDataSize);
 #endif
@@ -2482,23 +3146,48 @@ unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDa
 }
 
 // Decompress data (DEFLATE algorithm)
+// NOTE: Decompressed size is unknown, output buffer grows as required up to MAX_DECOMPRESSION_SIZE,
+// use DecompressDataTo() to decompress into a provided buffer when decompressed size is known
 unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize)
 {
     unsigned char *data = NULL;
+    *dataSize = 0;
 
 #if defined(SUPPORT_COMPRESSION_API)
     // Decompress data from a valid DEFLATE stream
-    data = (unsigned char *)RL_CALLOC(MAX_DECOMPRESSION_SIZE*1024*1024, 1);
-    int length = sinflate(data, MAX_DECOMPRESSION_SIZE*1024*1024, compData, compDataSize);
+    // NOTE: Decoding stops before any match or literal exceeding the output capacity, so, output was not
+    // truncated if at least a maximum length match (258 bytes) was still available at the end of the buffer
+    int maxCapacity = MAX_DECOMPRESSION_SIZE*1024*1024;
+    int capacity = (compDataSize < maxCapacity/4)? compDataSize*4 : maxCapacity;
+    if (capacity < 64*1024) capacity = 64*1024;
+    int length = 0;
+
+    while (true)
+    {
+        // WARNING: Output buffer is not reallocated on growing to avoid leaving copies of decompressed data in memory
+        RL_FREE(data);
+        data = (unsigned char *)RL_MALLOC(capacity);
+        if (data == NULL) break;
+
+        length = sinflate(data, capacity, compData, compDataSize);
 
-    // WARNING: RL_REALLOC can make (and leave) data copies in memory, be careful with sensitive compressed data!
-    // TODO: Use a different approach, create another buffer, copy data manually to it and wipe original buffer memory
-    unsigned char *temp = (unsigned char *)RL_REALLOC(data, length);
+        if ((length <= (capacity - 259)) || (capacity >= maxCapacity)) break;
+        capacity = ((capacity/2) < (maxCapacity - capacity))? capacity*2 : maxCapacity;
+    }
+
+    if ((data != NULL) && (length > (capacity - 259))) TRACELOG(LOG_WARNING, "SYSTEM: Decompressed data could be truncated, limit is MAX_DECOMPRESSION_SIZE (%i MB)", MAX_DECOMPRESSION_SIZE);
+
+    if (data != NULL)
+    {
+        // WARNING: RL_REALLOC can make (and leave) data copies in memory, be careful with sensitive compressed data!
+        // TODO: Use a different approach, create another buffer, copy data manually to it and wipe original buffer memory
+        unsigned char *temp = (unsigned char *)RL_REALLOC(data, (length > 0)? length : 1);
 
-    if (temp != NULL) data = temp;
-    else TRACELOG(LOG_WARNING, "SYSTEM: Failed to re-allocate required decompression memory");
+        if (temp != NULL) data = temp;
+        else TRACELOG(LOG_WARNING, "SYSTEM: Failed to re-allocate required decompression memory");
 
-    *dataSize = length;
+        *dataSize = length;
+    }
 
     TRACELOG(LOG_INFO, "SYSTEM: Decompress data: Comp. size: %i -> Original size: %i", compDataSize, *dataSize);
 #endif
@@ -2506,6 +3195,225 @@ unsigned char *DecompressData(const unsigned char *compData, int compDataSize, i
     return data;
 }
 
+// Load compressor (DEFLATE algorithm), compression level [0..8]
+// NOTE: Compressor state (almost 1MB) is allocated once and reused by every CompressDataTo() call
+Compressor LoadCompressor(int level)
+{
+    Compressor compressor = { 0 };
+
+#if defined(SUPPORT_COMPRESSION_API)
+    compressor.state = RL_CALLOC(1, sizeof(struct sdefl));
+    compressor.level = (level < SDEFL_LVL_MIN)? SDEFL_LVL_MIN : (level > SDEFL_LVL_MAX)? SDEFL_LVL_MAX : level;
+
+    if (compressor.state == NULL) TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate compressor state");
+#endif
+
+    return compressor;
+}
+
+// Unload compressor
+void UnloadCompressor(Compressor compressor)
+{
+    RL_FREE(compressor.state);
+}
+
+// Get maximum compressed data size (DEFLATE algorithm) for provided data size
+int GetCompressDataBound(int dataSize)
+{
+    int bound = 0;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    bound = sdefl_bound(dataSize);
+#endif
+
+    return bound;
+}
+
+// Compress data (DEFLATE algorithm) into provided buffer, returns compressed data size
+// NOTE: Output buffer capacity must be at least GetCompressDataBound(dataSize), 0 is returned otherwise
+int CompressDataTo(Compressor compressor, const unsigned char *data, int dataSize, unsigned char *compData, int compDataCapacity)
+{
+    int compDataSize = 0;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if ((compressor.state == NULL) || (data == NULL) || (compData == NULL) || (dataSize < 0)) return 0;
+
+    if (compDataCapacity < sdefl_bound(dataSize))
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Compression buffer too small (%i bytes, %i bytes required)", compDataCapacity, sdefl_bound(dataSize));
+        return 0;
+    }
+
+    compDataSize = sdeflate((struct sdefl *)compressor.state, compData, data, dataSize, compressor.level);
+#endif
+
+    return compDataSize;
+}
+
+// Decompress data (DEFLATE algorithm) into provided buffer, returns decompressed data size
+// NOTE: No memory is allocated, output is truncated at buffer capacity, use exact decompressed size if known
+int DecompressDataTo(const unsigned char *compData, int compDataSize, unsigned char *data, int dataCapacity)
+{
+    int dataSize = 0;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if ((compData == NULL) || (data == NULL)) return 0;
+
+    dataSize = sinflate(data, dataCapacity, compData, compDataSize);
+#endif
+
+    return dataSize;
+}
+
+// Compress data in independent blocks (DEFLATE algorithm) using worker threads
+// NOTE: Data is split in COMPRESSION_BLOCK_SIZE blocks, output is not a single DEFLATE stream,
+// use DecompressDataParallel() to decompress it, layout: [header][block][block]...
+unsigned char *CompressDataParallel(const unsigned char *data, int dataSize, int *compDataSize)
+{
+    unsigned char *compData = NULL;
+    *compDataSize = 0;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if ((data == NULL) || (dataSize < 0)) return NULL;
+
+    CompressionJobData job = { 0 };
+    job.data = data;
+    job.dataSize = dataSize;
+    job.blockCount = (dataSize + COMPRESSION_BLOCK_SIZE - 1)/COMPRESSION_BLOCK_SIZE;
+    job.slotSize = COMPRESSION_BLOCK_HEADER_SIZE + (size_t)sdefl_bound(COMPRESSION_BLOCK_SIZE);
+    job.jobCount = (job.blockCount < GetWorkerThreadCount())? job.blockCount : GetWorkerThreadCount();
+    if (job.jobCount < 1) job.jobCount = 1;
+
+    // Every block is compressed into its own slot and slots are packed after compression
+    job.output = (unsigned char *)RL_MALLOC(COMPRESSION_HEADER_SIZE + job.blockCount*job.slotSize);
+    job.blockSizes = (int *)RL_CALLOC((job.blockCount > 0)? job.blockCount : 1, sizeof(int));
+
+    if ((job.output != NULL) && (job.blockSizes != NULL))
+    {
+        RunParallelJobs(CompressDataJob, &job, job.jobCount);
+
+        size_t size = COMPRESSION_HEADER_SIZE;
+        bool valid = true;
+
+        for (int i = 0; i < job.blockCount; i++)
+        {
+            if (job.blockSizes[i] <= 0) valid = false;
+            if (!valid) break;
+
+            size_t blockSize = COMPRESSION_BLOCK_HEADER_SIZE + (size_t)job.blockSizes[i];
+            memmove(job.output + size, job.output + COMPRESSION_HEADER_SIZE + i*job.slotSize, blockSize);
+            size += blockSize;
+        }
+
+        if (valid && (size <= 2147483647))
+        {
+            unsigned int blockSize = COMPRESSION_BLOCK_SIZE;
+            memcpy(job.output, "rDFB", 4);
+            memcpy(job.output + 4, &blockSize, 4);
+
+            compData = (unsigned char *)RL_REALLOC(job.output, size);
+            if (compData == NULL) compData = job.output;
+            job.output = NULL;
+
+            *compDataSize = (int)size;
+        }
+    }
+
+    RL_FREE(job.output);
+    RL_FREE(job.blockSizes);
+
+    if (compData != NULL) TRACELOG(LOG_INFO, "SYSTEM: Compress data: Original size: %i -> Comp. size: %i (%i blocks)", dataSize, *compDataSize, job.blockCount);
+    else TRACELOG(LOG_WARNING, "SYSTEM: Failed to compress data");
+#endif
+
+    return compData;
+}
+
+// Decompress data compressed with CompressDataParallel() using worker threads
+unsigned char *DecompressDataParallel(const unsigned char *compData, int compDataSize, int *dataSize)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if ((compData == NULL) || (compDataSize < COMPRESSION_HEADER_SIZE) || (memcmp(compData, "rDFB", 4) != 0))
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Compressed data is not valid");
+        return NULL;
+    }
+
+    // Scan blocks to get decompressed size and block offsets
+    DecompressionJobData job = { 0 };
+    long long totalSize = 0;
+    int offset = COMPRESSION_HEADER_SIZE;
+    bool valid = true;
+
+    for (int pass = 0; valid && (pass < 2); pass++)
+    {
+        offset = COMPRESSION_HEADER_SIZE;
+        totalSize = 0;
+        job.blockCount = 0;
+
+        while (valid && (offset < compDataSize))
+        {
+            unsigned int size = 0;
+            unsigned int compSize = 0;
+
+            if ((compDataSize - offset) < COMPRESSION_BLOCK_HEADER_SIZE) { valid = false; break; }
+
+            memcpy(&size, compData + offset, 4);
+            memcpy(&compSize, compData + offset + 4, 4);
+            offset += COMPRESSION_BLOCK_HEADER_SIZE;
+
+            if ((compSize > (unsigned int)(compDataSize - offset)) || ((totalSize + size) > 2147483647)) { valid = false; break; }
+
+            if (pass == 1)
+            {
+                job.blocks[job.blockCount].compData = compData + offset;
+                job.blocks[job.blockCount].compDataSize = (int)compSize;
+                job.blocks[job.blockCount].dataOffset = (int)totalSize;
+                job.blocks[job.blockCount].dataSize = (int)size;
+            }
+
+            offset += (int)compSize;
+            totalSize += size;
+            job.blockCount++;
+        }
+
+        if (valid && (pass == 0))
+        {
+            job.blocks = (DecompressionBlock *)RL_CALLOC((job.blockCount > 0)? job.blockCount : 1, sizeof(DecompressionBlock));
+            if (job.blocks == NULL) valid = false;
+        }
+    }
+
+    if (valid) data = (unsigned char *)RL_MALLOC((totalSize > 0)? (size_t)totalSize : 1);
+
+    if (data != NULL)
+    {
+        // Blocks are independent, decompressed in parallel to exact size
+        job.data = data;
+        RunParallelJobs(DecompressDataJob, &job, job.blockCount);
+
+        for (int i = 0; i < job.blockCount; i++) if (job.blocks[i].result != job.blocks[i].dataSize) valid = false;
+
+        if (valid) *dataSize = (int)totalSize;
+        else
+        {
+            RL_FREE(data);
+            data = NULL;
+        }
+    }
+
+    RL_FREE(job.blocks);
+
+    if (data != NULL) TRACELOG(LOG_INFO, "SYSTEM: Decompress data: Comp. size: %i -> Original size: %i (%i blocks)", compDataSize, *dataSize, job.blockCount);
+    else TRACELOG(LOG_WARNING, "SYSTEM: Failed to decompress data");
+#endif
+
+    return data;
+}
+
 // Encode data to Base64 string
 char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize)
 {
@@ -2603,260 +3511,210 @@ unsigned char *DecodeDataBase64(const unsigned char *data, int *outputSize)
 // Compute CRC32 hash code
 unsigned int ComputeCRC32(unsigned char *data, int dataSize)
 {
-    static unsigned int crcTable[256] = {
-        0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
-        0x0eDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
-        0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
-        0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
-        0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
-        0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
-        0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
-        0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
-        0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
-        0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
-        0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
-        0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
-        0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
-        0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
-        0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
-        0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
-        0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
-        0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
-        0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
-        0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
-        0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
-        0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
-        0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
-        0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
-        0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
-        0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
-        0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
-        0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
-        0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
-        0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
-        0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
-        0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
-    };
+    return ~UpdateCRC32(~0u, data, dataSize);
+}
 
-    unsigned int crc = ~0u;
+// Compute MD5 hash code
+// NOTE: Returns a static int[4] array (16 bytes), use ComputeMD5To() for a thread-safe version
+unsigned int *ComputeMD5(unsigned char *data, int dataSize)
+{
+    static unsigned int hash[4] = { 0 };  // Hash to be returned
 
-    for (int i = 0; i < dataSize; i++) crc = (crc >> 8) ^ crcTable[data[i] ^ (crc & 0xff)];
+    ComputeMD5To(data, dataSize, hash);
 
-    return ~crc;
+    return hash;
 }
 
-// Compute MD5 hash code
-// NOTE: Returns a static int[4] array (16 bytes)
-unsigned int *ComputeMD5(unsigned char *data, int dataSize)
+// Compute SHA-1 hash code
+// NOTE: Returns a static int[5] array (20 bytes), use ComputeSHA1To() for a thread-safe version
+unsigned int *ComputeSHA1(unsigned char *data, int dataSize)
 {
-    #define ROTATE_LEFT(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
+    static unsigned int hash[5] = { 0 };  // Hash to be returned
 
-    static unsigned int hash[4] = { 0 };  // Hash to be returned
+    ComputeSHA1To(data, dataSize, hash);
 
-    // WARNING: All variables are unsigned 32 bit and wrap modulo 2^32 when calculating
+    return hash;
+}
 
-    // NOTE: r specifies the per-round shift amounts
-    unsigned int r[] = {
-        7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
-        5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
-        4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
-        6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
-    };
+// Compute MD5 hash code into provided int[4] array (16 bytes)
+void ComputeMD5To(const unsigned char *data, int dataSize, unsigned int *hash)
+{
+    HashState state = InitHash(HASH_MD5);
+    UpdateHash(&state, data, dataSize);
+    FinishHash(&state, hash);
+}
 
-    // Using binary integer part of the sines of integers (in radians) as constants
-    unsigned int k[] = {
-        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
-        0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
-        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
-        0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
-        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
-        0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
-        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
-        0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
-        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
-        0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
-        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
-        0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
-        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
-        0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
-        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
-        0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
-    };
+// Compute SHA-1 hash code into provided int[5] array (20 bytes)
+void ComputeSHA1To(const unsigned char *data, int dataSize, unsigned int *hash)
+{
+    HashState state = InitHash(HASH_SHA1);
+    UpdateHash(&state, data, dataSize);
+    FinishHash(&state, hash);
+}
 
-    hash[0] = 0x67452301;
-    hash[1] = 0xefcdab89;
-    hash[2] = 0x98badcfe;
-    hash[3] = 0x10325476;
+// Compute XXH64 hash code (64 bit, non-cryptographic)
+// NOTE: Fast hash intended for hash tables and cache keys, seed is 0
+unsigned long long ComputeXXH64(const unsigned char *data, int dataSize)
+{
+    unsigned int hash[2] = { 0 };
+
+    HashState state = InitHash(HASH_XXH64);
+    UpdateHash(&state, data, dataSize);
+    FinishHash(&state, hash);
 
-    // Pre-processing: adding a single 1 bit
-    // Append '1' bit to message
-    // NOTE: The input bytes are considered as bits strings,
-    // where the first bit is the most significant bit of the byte
+    return ((unsigned long long)hash[1] << 32) | hash[0];
+}
 
-    // Pre-processing: padding with zeros
-    // Append '0' bit until message length in bit 448 (mod 512)
-    // Append length mod (2 pow 64) to message
+// Init hash state for incremental hash computation
+HashState InitHash(int type)
+{
+    HashState state = { 0 };
+    state.type = type;
 
-    int newDataSize = ((((dataSize + 8)/64) + 1)*64) - 8;
+    switch (type)
+    {
+        case HASH_CRC32: state.state[0] = 0xFFFFFFFF; break;
+        case HASH_MD5:
+        {
+            state.state[0] = 0x67452301;
+            state.state[1] = 0xefcdab89;
+            state.state[2] = 0x98badcfe;
+            state.state[3] = 0x10325476;
+        } break;
+        case HASH_SHA1:
+        {
+            state.state[0] = 0x67452301;
+            state.state[1] = 0xEFCDAB89;
+            state.state[2] = 0x98BADCFE;
+            state.state[3] = 0x10325476;
+            state.state[4] = 0xC3D2E1F0;
+        } break;
+        case HASH_XXH64:
+        {
+            state.state[0] = XXH64_PRIME1 + XXH64_PRIME2;
+            state.state[1] = XXH64_PRIME2;
+            state.state[2] = 0;
+            state.state[3] = 0 - XXH64_PRIME1;
+        } break;
+        default: TRACELOG(LOG_WARNING, "SYSTEM: Hash type not supported (%i)", type); break;
+    }
 
-    unsigned char *msg = RL_CALLOC(newDataSize + 64, 1); // Initialize with '0' bits, allocating 64 extra bytes
-    memcpy(msg, data, dataSize);
-    msg[dataSize] = 128; // Write the '1' bit
+    return state;
+}
 
-    unsigned int bitsLen = 8*dataSize;
-    memcpy(msg + newDataSize, &bitsLen, 4); // Append the len in bits at the end of the buffer
+// Update hash state with data, data can be provided in multiple chunks of any size
+void UpdateHash(HashState *state, const unsigned char *data, int dataSize)
+{
+    if ((data == NULL) || (dataSize <= 0)) return;
 
-    // Process the message in successive 512-bit chunks for each 512-bit chunk of message
-    for (int offset = 0; offset < newDataSize; offset += (512/8))
+    if (state->type == HASH_CRC32)
     {
-        // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15
-        unsigned int *w = (unsigned int *)(msg + offset);
+        state->state[0] = UpdateCRC32((unsigned int)state->state[0], data, dataSize);
+        state->length += dataSize;
+        return;
+    }
 
-        // Initialize hash value for this chunk
-        unsigned int a = hash[0];
-        unsigned int b = hash[1];
-        unsigned int c = hash[2];
-        unsigned int d = hash[3];
+    int blockSize = (state->type == HASH_XXH64)? 32 : 64;
+    int pending = (int)(state->length%blockSize);
+    state->length += dataSize;
 
-        for (int i = 0; i < 64; i++)
-        {
-            unsigned int f = 0;
-            unsigned int g = 0;
+    // Complete pending block with new data
+    if (pending > 0)
+    {
+        int size = ((blockSize - pending) < dataSize)? (blockSize - pending) : dataSize;
+        memcpy(state->buffer + pending, data, size);
+        data += size;
+        dataSize -= size;
 
-            if (i < 16)
-            {
-                f = (b & c) | ((~b) & d);
-                g = i;
-            }
-            else if (i < 32)
-            {
-                f = (d & b) | ((~d) & c);
-                g = (5*i + 1)%16;
-            }
-            else if (i < 48)
-            {
-                f = b ^ c ^ d;
-                g = (3*i + 5)%16;
-            }
-            else
+        if ((pending + size) < blockSize) return;
+        ProcessHashBlocks(state, state->buffer, 1);
+    }
+
+    // Process full blocks directly from data, keep the remaining bytes pending
+    int blockCount = dataSize/blockSize;
+    if (blockCount > 0) ProcessHashBlocks(state, data, blockCount);
+    memcpy(state->buffer, data + blockCount*blockSize, dataSize - blockCount*blockSize);
+}
+
+// Finish hash computation, hash is written to provided array
+// NOTE: Hash array size depends on type: CRC32: int[1], MD5: int[4], SHA1: int[5], XXH64: int[2] (low word first)
+void FinishHash(HashState *state, unsigned int *hash)
+{
+    switch (state->type)
+    {
+        case HASH_CRC32: hash[0] = ~(unsigned int)state->state[0]; break;
+        case HASH_MD5:
+        case HASH_SHA1:
+        {
+            // Append '1' bit, pad with '0' bits until length is 448 (mod 512), append length in bits (64 bit)
+            // NOTE: MD5 appends length little-endian, SHA-1 big-endian
+            unsigned long long bitsLength = state->length*8;
+            int pending = (int)(state->length%64);
+            unsigned char padding[128] = { 0x80 };
+            int paddingSize = ((pending < 56)? 56 : 120) - pending;
+
+            for (int i = 0; i < 8; i++)
             {
-                f = c ^ (b | (~d));
-                g = (7*i)%16;
+                if (state->type == HASH_MD5) padding[paddingSize + i] = (unsigned char)(bitsLength >> (8*i));
+                else padding[paddingSize + i] = (unsigned char)(bitsLength >> (56 - 8*i));
             }
 
-            unsigned int temp = d;
-            d = c;
-            c = b;
-            b = b + ROTATE_LEFT((a + f + k[i] + w[g]), r[i]);
-            a = temp;
-        }
+            unsigned long long length = state->length;
+            UpdateHash(state, padding, paddingSize + 8);
+            state->length = length;
 
-        // Add chunk's hash to result so far
-        hash[0] += a;
-        hash[1] += b;
-        hash[2] += c;
-        hash[3] += d;
-    }
+            for (int i = 0; i < ((state->type == HASH_MD5)? 4 : 5); i++) hash[i] = (unsigned int)state->state[i];
+        } break;
+        case HASH_XXH64:
+        {
+            unsigned long long h = 0;
+            const unsigned long long *v = state->state;
 
-    RL_FREE(msg);
+            if (state->length >= 32)
+            {
+                h = XXH64_ROTATE_LEFT(v[0], 1) + XXH64_ROTATE_LEFT(v[1], 7) + XXH64_ROTATE_LEFT(v[2], 12) + XXH64_ROTATE_LEFT(v[3], 18);
+                for (int i = 0; i < 4; i++) h = (h ^ XXH64Round(0, v[i]))*XXH64_PRIME1 + XXH64_PRIME4;
+            }
+            else h = XXH64_PRIME5;
 
-    return hash;
-}
+            h += state->length;
 
-// Compute SHA-1 hash code
-// NOTE: Returns a static int[5] array (20 bytes)
-unsigned int *ComputeSHA1(unsigned char *data, int dataSize) {
-    #define ROTATE_LEFT(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
+            // Process pending bytes
+            const unsigned char *p = state->buffer;
+            int pending = (int)(state->length%32);
 
-    static unsigned int hash[5] = { 0 };  // Hash to be returned
+            for (; pending >= 8; pending -= 8, p += 8)
+            {
+                h ^= XXH64Round(0, ReadU64LE(p));
+                h = XXH64_ROTATE_LEFT(h, 27)*XXH64_PRIME1 + XXH64_PRIME4;
+            }
 
-    // Initialize hash values
-    hash[0] = 0x67452301;
-    hash[1] = 0xEFCDAB89;
-    hash[2] = 0x98BADCFE;
-    hash[3] = 0x10325476;
-    hash[4] = 0xC3D2E1F0;
-
-    // Pre-processing: adding a single 1 bit
-    // Append '1' bit to message
-    // NOTE: The input bytes are considered as bits strings,
-    // where the first bit is the most significant bit of the byte
-
-    // Pre-processing: padding with zeros
-    // Append '0' bit until message length in bit 448 (mod 512)
-    // Append length mod (2 pow 64) to message
-
-    int newDataSize = ((((dataSize + 8)/64) + 1)*64);
-
-    unsigned char *msg = RL_CALLOC(newDataSize, 1); // Initialize with '0' bits
-    memcpy(msg, data, dataSize);
-    msg[dataSize] = 128; // Write the '1' bit
-
-    unsigned int bitsLen = 8*dataSize;
-    msg[newDataSize-1] = bitsLen;
-
-    // Process the message in successive 512-bit chunks
-    for (int offset = 0; offset < newDataSize; offset += (512/8))
-    {
-        // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15
-        unsigned int w[80] = {0};
-        for (int i = 0; i < 16; i++) {
-            w[i] = (msg[offset + (i * 4) + 0] << 24) |
-                   (msg[offset + (i * 4) + 1] << 16) |
-                   (msg[offset + (i * 4) + 2] << 8) |
-                   (msg[offset + (i * 4) + 3]);
-        }
-
-        // Message schedule: extend the sixteen 32-bit words into eighty 32-bit words:
-        for (int i = 16; i < 80; ++i) {
-            w[i] = ROTATE_LEFT(w[i-3] ^ w[i-8] ^ w[i-14] ^ w[i-16], 1);
-        }
-
-        // Initialize hash value for this chunk
-        unsigned int a = hash[0];
-        unsigned int b = hash[1];
-        unsigned int c = hash[2];
-        unsigned int d = hash[3];
-        unsigned int e = hash[4];
-
-        for (int i = 0; i < 80; i++)
-        {
-            unsigned int f = 0;
-            unsigned int k = 0;
-
-            if (i < 20) {
-                f = (b & c) | ((~b) & d);
-                k = 0x5A827999;
-            } else if (i < 40) {
-                f = b ^ c ^ d;
-                k = 0x6ED9EBA1;
-            } else if (i < 60) {
-                f = (b & c) | (b & d) | (c & d);
-                k = 0x8F1BBCDC;
-            } else {
-                f = b ^ c ^ d;
-                k = 0xCA62C1D6;
+            if (pending >= 4)
+            {
+                h ^= (unsigned long long)ReadU32LE(p)*XXH64_PRIME1;
+                h = XXH64_ROTATE_LEFT(h, 23)*XXH64_PRIME2 + XXH64_PRIME3;
+                pending -= 4;
+                p += 4;
             }
 
-            unsigned int temp = ROTATE_LEFT(a, 5) + f + e + k + w[i];
-            e = d;
-            d = c;
-            c = ROTATE_LEFT(b, 30);
-            b = a;
-            a = temp;
-        }
+            for (; pending > 0; pending--, p++)
+            {
+                h ^= (*p)*XXH64_PRIME5;
+                h = XXH64_ROTATE_LEFT(h, 11)*XXH64_PRIME1;
+            }
 
-        // Add this chunk's hash to result so far
-        hash[0] += a;
-        hash[1] += b;
-        hash[2] += c;
-        hash[3] += d;
-        hash[4] += e;
+            // Final avalanche
+            h ^= h >> 33;
+            h *= XXH64_PRIME2;
+            h ^= h >> 29;
+            h *= XXH64_PRIME3;
+            h ^= h >> 32;
+
+            hash[0] = (unsigned int)h;
+            hash[1] = (unsigned int)(h >> 32);
+        } break;
+        default: break;
     }
-
-    free(msg);
-
-    return hash;
 }
 
 //----------------------------------------------------------------------------------
@@ -2864,6 +3722,7 @@ unsigned int *ComputeSHA1(unsigned char *data, int dataSize) {
 //----------------------------------------------------------------------------------
 
 // Load automation events list from file, NULL for empty list, capacity = MAX_AUTOMATION_EVENTS
+// NOTE: Binary (.rae) and text files are supported, format is detected from file id
 AutomationEventList LoadAutomationEventList(const char *fileName)
 {
     AutomationEventList list = { 0 };
@@ -2876,65 +3735,68 @@ AutomationEventList LoadAutomationEventList(const char *fileName)
     if (fileName == NULL) TRACELOG(LOG_INFO, "AUTOMATION: New empty events list loaded successfully");
     else
     {
-        // Load automation events file (binary)
-        /*
-        //int dataSize = 0;
-        //unsigned char *data = LoadFileData(fileName, &dataSize);
-
+        // Check events file id, binary files start with "rAE "
+        bool binary = false;
         FILE *raeFile = fopen(fileName, "rb");
-        unsigned char fileId[4] = { 0 };
 
-        fread(fileId, 1, 4, raeFile);
-
-        if ((fileId[0] == 'r') && (fileId[1] == 'A') && (fileId[2] == 'E') && (fileId[1] == ' '))
+        if (raeFile != NULL)
         {
-            fread(&eventCount, sizeof(int), 1, raeFile);
-            TRACELOG(LOG_WARNING, "Events loaded: %i\n", eventCount);
-            fread(events, sizeof(AutomationEvent), eventCount, raeFile);
+            unsigned char fileId[4] = { 0 };
+            binary = ((fread(fileId, 1, 4, raeFile) == 4) && (memcmp(fileId, "rAE ", 4) == 0));
+            fclose(raeFile);
         }
 
-        fclose(raeFile);
-        */
+        if (binary)
+        {
+            // Load events file (binary), all events read from stream
+            AutomationEventStream stream = LoadAutomationEventStream(fileName);
 
-        // Load events file (text)
-        //unsigned char *buffer = LoadFileText(fileName);
-        FILE *raeFile = fopen(fileName, "rt");
+            while (!stream.finished)
+            {
+                if (!AddAutomationEvent(&list, stream.next)) break;
+                stream.finished = !ReadAutomationEventStream(stream.stream, &stream.next);
+            }
 
-        if (raeFile != NULL)
+            UnloadAutomationEventStream(stream);
+        }
+        else
         {
-            unsigned int counter = 0;
-            char buffer[256] = { 0 };
-            char eventDesc[64] = { 0 };
+            // Load events file (text)
+            raeFile = fopen(fileName, "rt");
 
-            fgets(buffer, 256, raeFile);
-
-            while (!feof(raeFile))
+            if (raeFile != NULL)
             {
-                switch (buffer[0])
+                unsigned int eventCount = 0;
+                AutomationEvent event = { 0 };
+                char buffer[256] = { 0 };
+                char eventDesc[64] = { 0 };
+
+                fgets(buffer, 256, raeFile);
+
+                while (!feof(raeFile))
                 {
-                    case 'c': sscanf(buffer, "c %i", &list.count); break;
-                    case 'e':
+                    switch (buffer[0])
                     {
-                        sscanf(buffer, "e %d %d %d %d %d %d %[^\n]s", &list.events[counter].frame, &list.events[counter].type,
-                               &list.events[counter].params[0], &list.events[counter].params[1], &list.events[counter].params[2], &list.events[counter].params[3], eventDesc);
+                        case 'c': sscanf(buffer, "c %i", &eventCount); break;
+                        case 'e':
+                        {
+                            sscanf(buffer, "e %d %d %d %d %d %d %[^\n]s", &event.frame, &event.type,
+                                   &event.params[0], &event.params[1], &event.params[2], &event.params[3], eventDesc);
 
-                        counter++;
-                    } break;
-                    default: break;
-                }
+                            AddAutomationEvent(&list, event);
+                        } break;
+                        default: break;
+                    }
 
-                fgets(buffer, 256, raeFile);
-            }
+                    fgets(buffer, 256, raeFile);
+                }
 
-            if (counter != list.count)
-            {
-                TRACELOG(LOG_WARNING, "AUTOMATION: Events read from file [%i] do not mach event count specified [%i]", counter, list.count);
-                list.count = counter;
-            }
+                if (eventCount != list.count) TRACELOG(LOG_WARNING, "AUTOMATION: Events read from file [%i] do not mach event count specified [%i]", list.count, eventCount);
 
-            fclose(raeFile);
+                fclose(raeFile);
 
-            TRACELOG(LOG_INFO, "AUTOMATION: Events file loaded successfully");
+                TRACELOG(LOG_INFO, "AUTOMATION: Events file loaded successfully");
+            }
         }
 
         TRACELOG(LOG_INFO, "AUTOMATION: Events loaded from file: %i", list.count);
@@ -2951,52 +3813,60 @@ void UnloadAutomationEventList(AutomationEventList list)
 #endif
 }
 
-// Export automation events list as text file
+// Export automation events list as binary file (.rae) or text file (any other extension)
 bool ExportAutomationEventList(AutomationEventList list, const char *fileName)
 {
     bool success = false;
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
-    // Export events as binary file
-    // TODO: Save to memory buffer and SaveFileData()
-    /*
-    unsigned char fileId[4] = "rAE ";
-    FILE *raeFile = fopen(fileName, "wb");
-    fwrite(fileId, sizeof(unsigned char), 4, raeFile);
-    fwrite(&eventCount, sizeof(int), 1, raeFile);
-    fwrite(events, sizeof(AutomationEvent), eventCount, raeFile);
-    fclose(raeFile);
-    */
+    if (IsFileExtension(fileName, ".rae"))
+    {
+        // Export events as binary file, events delta encoded
+        unsigned char *data = (unsigned char *)RL_MALLOC(8 + list.count*AUTOMATION_EVENT_MAX_SIZE);
+        AutomationEventCodec codec = { 0 };
+        int dataSize = 8;
 
-    // Export events as text
-    // TODO: Save to memory buffer and SaveFileText()
-    char *txtData = (char *)RL_CALLOC(256*list.count + 2048, sizeof(char)); // 256 characters per line plus some header
+        memcpy(data, "rAE ", 4);
+        data[4] = AUTOMATION_EVENTS_FILE_VERSION; data[5] = 0; data[6] = 0; data[7] = 0;
 
-    int byteCount = 0;
-    byteCount += sprintf(txtData + byteCount, "#\n");
-    byteCount += sprintf(txtData + byteCount, "# Automation events exporter v1.0 - raylib automation events list\n");
-    byteCount += sprintf(txtData + byteCount, "#\n");
-    byteCount += sprintf(txtData + byteCount, "#    c <events_count>\n");
-    byteCount += sprintf(txtData + byteCount, "#    e <frame> <event_type> <param0> <param1> <param2> <param3> // <event_type_name>\n");
-    byteCount += sprintf(txtData + byteCount, "#\n");
-    byteCount += sprintf(txtData + byteCount, "# more info and bugs-report:  github.com/raysan5/raylib\n");
-    byteCount += sprintf(txtData + byteCount, "# feedback and support:       ray[at]raylib.com\n");
-    byteCount += sprintf(txtData + byteCount, "#\n");
-    byteCount += sprintf(txtData + byteCount, "# Copyright (c) 2023-2024 Ramon Santamaria (@raysan5)\n");
-    byteCount += sprintf(txtData + byteCount, "#\n\n");
+        for (unsigned int i = 0; i < list.count; i++) dataSize += EncodeAutomationEvent(&codec, list.events[i], data + dataSize);
 
-    // Add events data
-    byteCount += sprintf(txtData + byteCount, "c %i\n", list.count);
-    for (unsigned int i = 0; i < list.count; i++)
-    {
-        byteCount += snprintf(txtData + byteCount, 256, "e %i %i %i %i %i %i // Event: %s\n", list.events[i].frame, list.events[i].type,
-            list.events[i].params[0], list.events[i].params[1], list.events[i].params[2], list.events[i].params[3], autoEventTypeName[list.events[i].type]);
+        success = SaveFileData(fileName, data, dataSize);
+
+        RL_FREE(data);
     }
+    else
+    {
+        // Export events as text
+        // TODO: Save to memory buffer and SaveFileText()
+        char *txtData = (char *)RL_CALLOC(256*list.count + 2048, sizeof(char)); // 256 characters per line plus some header
+
+        int byteCount = 0;
+        byteCount += sprintf(txtData + byteCount, "#\n");
+        byteCount += sprintf(txtData + byteCount, "# Automation events exporter v1.0 - raylib automation events list\n");
+        byteCount += sprintf(txtData + byteCount, "#\n");
+        byteCount += sprintf(txtData + byteCount, "#    c <events_count>\n");
+        byteCount += sprintf(txtData + byteCount, "#    e <frame> <event_type> <param0> <param1> <param2> <param3> // <event_type_name>\n");
+        byteCount += sprintf(txtData + byteCount, "#\n");
+        byteCount += sprintf(txtData + byteCount, "# more info and bugs-report:  github.com/raysan5/raylib\n");
+        byteCount += sprintf(txtData + byteCount, "# feedback and support:       ray[at]raylib.com\n");
+        byteCount += sprintf(txtData + byteCount, "#\n");
+        byteCount += sprintf(txtData + byteCount, "# Copyright (c) 2023-2024 Ramon Santamaria (@raysan5)\n");
+        byteCount += sprintf(txtData + byteCount, "#\n\n");
+
+        // Add events data
+        byteCount += sprintf(txtData + byteCount, "c %i\n", list.count);
+        for (unsigned int i = 0; i < list.count; i++)
+        {
+            byteCount += snprintf(txtData + byteCount, 256, "e %i %i %i %i %i %i // Event: %s\n", list.events[i].frame, list.events[i].type,
+                list.events[i].params[0], list.events[i].params[1], list.events[i].params[2], list.events[i].params[3], autoEventTypeName[list.events[i].type]);
+        }
 
-    // NOTE: Text data size exported is determined by '\0' (NULL) character
-    success = SaveFileText(fileName, txtData);
+        // NOTE: Text data size exported is determined by '\0' (NULL) character
+        success = SaveFileText(fileName, txtData);
 
-    RL_FREE(txtData);
+        RL_FREE(txtData);
+    }
 #endif
 
     return success;
@@ -3010,16 +3880,145 @@ void SetAutomationEventList(AutomationEventList *list)
 #endif
 }
 
+// Set automation events binary file to stream recorded events to, NULL to close
+// NOTE: Events are buffered and written to file every frame, no events limit,
+// events are recorded to stream and events list (if set) at the same time
+bool SetAutomationEventStream(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    rAutomationStream *stream = &automationRecorder.stream;
+
+    // Close current events stream, pending event written first
+    if (stream->file != NULL)
+    {
+        if (automationRecorder.pending.type != EVENT_NONE) WriteAutomationEvent(automationRecorder.pending);
+        automationRecorder.pending.type = EVENT_NONE;
+
+        FlushAutomationEventStream(stream);
+        fclose(stream->file);
+        RL_FREE(stream->data);
+
+        *stream = (rAutomationStream){ 0 };
+
+        TRACELOG(LOG_INFO, "AUTOMATION: Events stream closed successfully");
+    }
+
+    if (fileName != NULL)
+    {
+        stream->file = fopen(fileName, "wb");
+
+        if (stream->file != NULL)
+        {
+            stream->data = (unsigned char *)RL_MALLOC(AUTOMATION_STREAM_BUFFER_SIZE);
+
+            memcpy(stream->data, "rAE ", 4);
+            stream->data[4] = AUTOMATION_EVENTS_FILE_VERSION; stream->data[5] = 0; stream->data[6] = 0; stream->data[7] = 0;
+            stream->size = 8;
+
+            TRACELOG(LOG_INFO, "AUTOMATION: [%s] Events stream opened successfully", fileName);
+            success = true;
+        }
+        else TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Failed to open events stream file", fileName);
+    }
+    else success = true;
+#endif
+
+    return success;
+}
+
+// Load automation events stream from binary file, events are read on demand
+AutomationEventStream LoadAutomationEventStream(const char *fileName)
+{
+    AutomationEventStream stream = { 0 };
+    stream.finished = true;
+
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    FILE *raeFile = fopen(fileName, "rb");
+
+    if (raeFile != NULL)
+    {
+        unsigned char header[8] = { 0 };
+
+        if ((fread(header, 1, 8, raeFile) == 8) && (memcmp(header, "rAE ", 4) == 0) && (ReadU32LE(header + 4) == AUTOMATION_EVENTS_FILE_VERSION))
+        {
+            stream.stream = (rAutomationStream *)RL_CALLOC(1, sizeof(rAutomationStream));
+            stream.stream->file = raeFile;
+            stream.stream->data = (unsigned char *)RL_MALLOC(AUTOMATION_STREAM_BUFFER_SIZE);
+
+            // Read first event, ready to be played
+            stream.finished = !ReadAutomationEventStream(stream.stream, &stream.next);
+
+            TRACELOG(LOG_INFO, "AUTOMATION: [%s] Events stream loaded successfully", fileName);
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Events file is not a valid binary events file", fileName);
+            fclose(raeFile);
+        }
+    }
+    else TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Failed to open events stream file", fileName);
+#endif
+
+    return stream;
+}
+
+// Unload automation events stream
+void UnloadAutomationEventStream(AutomationEventStream stream)
+{
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    if (stream.stream != NULL)
+    {
+        fclose(stream.stream->file);
+        RL_FREE(stream.stream->data);
+        RL_FREE(stream.stream);
+    }
+#endif
+}
+
+// Play automation events from stream up to provided frame, returns number of events played
+int PlayAutomationEventStream(AutomationEventStream *stream, unsigned int frame)
+{
+    int count = 0;
+
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    while (!stream->finished && (stream->next.frame <= frame))
+    {
+        PlayAutomationEvent(stream->next);
+        stream->count++;
+        count++;
+
+        stream->finished = !ReadAutomationEventStream(stream->stream, &stream->next);
+    }
+#endif
+
+    return count;
+}
+
 // Set automation event internal base frame to start recording
 void SetAutomationEventBaseFrame(int frame)
 {
     CORE.Time.frameCounter = frame;
 }
 
-// Start recording automation events (AutomationEventList must be set)
+// Start recording automation events (AutomationEventList and/or events stream must be set)
 void StartAutomationEventRecording(void)
 {
 #if defined(SUPPORT_AUTOMATION_EVENTS)
+    if ((currentEventList == NULL) && (automationRecorder.stream.file == NULL)) TRACELOG(LOG_WARNING, "AUTOMATION: No events list or events stream set to record to");
+
+    // Current input state registered, only changes are recorded
+    automationRecorder.pending.type = EVENT_NONE;
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    automationRecorder.gesture = GESTURES.current;
+#endif
+    for (int id = 0; id < MAX_TOUCH_POINTS; id++) automationRecorder.touchPosition[id] = CORE.Input.Touch.position[id];
+    for (int gamepad = 0; gamepad < MAX_GAMEPADS; gamepad++)
+    {
+        for (int axis = 0; axis < MAX_GAMEPAD_AXIS; axis++) automationRecorder.gamepadAxis[gamepad][axis] = (int)(CORE.Input.Gamepad.axisState[gamepad][axis]*32768.0f);
+    }
+
     automationEventRecording = true;
 #endif
 }
@@ -3028,6 +4027,18 @@ void StartAutomationEventRecording(void)
 void StopAutomationEventRecording(void)
 {
 #if defined(SUPPORT_AUTOMATION_EVENTS)
+    if (!automationEventRecording) return;
+
+    // Write pending event and stream buffered data
+    if (automationRecorder.pending.type != EVENT_NONE) WriteAutomationEvent(automationRecorder.pending);
+    automationRecorder.pending.type = EVENT_NONE;
+
+    if (automationRecorder.stream.file != NULL)
+    {
+        FlushAutomationEventStream(&automationRecorder.stream);
+        fflush(automationRecorder.stream.file);
+    }
+
     automationEventRecording = false;
 #endif
 }
@@ -3105,7 +4116,7 @@ void PlayAutomationEvent(AutomationEvent event)
             default: break;
         }
 
-        TRACELOG(LOG_INFO, "AUTOMATION PLAY: Frame: %i | Event type: %i | Event parameters: %i, %i, %i", event.frame, event.type, event.params[0], event.params[1], event.params[2]);
+        TRACELOGD("AUTOMATION PLAY: Frame: %i | Event type: %i | Event parameters: %i, %i, %i", event.frame, event.type, event.params[0], event.params[1], event.params[2]);
     }
 #endif
 }
@@ -3531,6 +4542,101 @@ void InitTimer(void)
 #endif
 
     CORE.Time.previous = GetTime();     // Get time as double
+    CORE.Time.spinMargin = WAIT_SPIN_MARGIN_MAX/2;
+}
+
+// Wait until time (GetTime() based)
+// NOTE: With SUPPORT_PARTIALBUSY_WAIT_LOOP, sleep ends spinMargin before required time and a busy wait loop
+// waits the remaining time, spinMargin is adapted to the sleep overshoot measured on every wait
+static void WaitUntilTime(double time)
+{
+#if defined(SUPPORT_BUSY_WAIT_LOOP)
+    while (GetTime() < time) { }
+#else
+    double currentTime = GetTime();
+
+    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+        double sleepTime = time - CORE.Time.spinMargin;
+    #else
+        double sleepTime = time;
+    #endif
+
+    if (sleepTime > currentTime)
+    {
+        SleepUntilTime(currentTime, sleepTime);
+
+    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+        // Margin grows fast on late wake ups and decays slowly on early ones,
+        // tracking a high percentile of the overshoot without spinning for the worst case
+        double overshoot = GetTime() - sleepTime;
+
+        if (overshoot > CORE.Time.spinMargin) CORE.Time.spinMargin += (overshoot - CORE.Time.spinMargin)*0.25;
+        else CORE.Time.spinMargin -= (CORE.Time.spinMargin - overshoot)*0.02;
+
+        if (CORE.Time.spinMargin < WAIT_SPIN_MARGIN_MIN) CORE.Time.spinMargin = WAIT_SPIN_MARGIN_MIN;
+        else if (CORE.Time.spinMargin > WAIT_SPIN_MARGIN_MAX) CORE.Time.spinMargin = WAIT_SPIN_MARGIN_MAX;
+    #endif
+    }
+
+    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+        while (GetTime() < time) { }
+    #endif
+#endif
+}
+
+#if !defined(SUPPORT_BUSY_WAIT_LOOP)
+// Sleep until time (GetTime() based)
+// NOTE: On Linux and FreeBSD, an absolute monotonic deadline is used, built from a monotonic clock
+// sample taken together with a new GetTime() sample, so delays before the sleep call (i.e. preemption)
+// or while sleeping (i.e. signals) do not extend the sleep, currentTime is only used on other platforms
+static void SleepUntilTime(double currentTime, double time)
+{
+#if defined(__linux__) || defined(__FreeBSD__)
+    (void)currentTime;
+
+    struct timespec deadline = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    double seconds = time - GetTime();
+
+    if (seconds <= 0.0) return;
+
+    long long nsec = (long long)deadline.tv_nsec + (long long)(seconds*1000000000.0);
+    deadline.tv_sec += (time_t)(nsec/1000000000LL);
+    deadline.tv_nsec = (long)(nsec%1000000000LL);
+
+    // NOTE: clock_nanosleep() returns error value, sleep restarted if interrupted by a signal (EINTR)
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) continue;
+#else
+    double seconds = time - currentTime;
+
+    // System halt functions
+    #if defined(_WIN32)
+        Sleep((unsigned long)(seconds*1000.0));
+    #endif
+    #if defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
+        struct timespec req = { 0 };
+        time_t sec = seconds;
+        long nsec = (seconds - sec)*1000000000L;
+        req.tv_sec = sec;
+        req.tv_nsec = nsec;
+
+        // NOTE: Use nanosleep() on Unix platforms... usleep() it's deprecated
+        while (nanosleep(&req, &req) == -1) continue;
+    #endif
+    #if defined(__APPLE__)
+        usleep(seconds*1000000.0);
+    #endif
+#endif
+}
+#endif
+
+// Compare frame times, used by qsort()
+static int CompareFrameTimes(const void *a, const void *b)
+{
+    float timeA = *(const float *)a;
+    float timeB = *(const float *)b;
+
+    return (timeA > timeB) - (timeA < timeB);
 }
 
 // Set viewport for a provided width and height
@@ -3638,395 +4744,1409 @@ void SetupFramebuffer(int width, int height)
     }
 }
 
-// Scan all files and directories in a base path
-// WARNING: files.paths[] must be previously allocated and
-// contain enough space to store all required paths
-static void ScanDirectoryFiles(const char *basePath, FilePathList *files, const char *filter)
+// Scan directory entries at scan path, recursively if required
+// NOTE: Entry type is taken from d_type if available, stat() is only used for links or unknown types
+static void ScanDirectoryEntries(DirectoryScan *scan, int pathLength)
 {
-    static char path[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, MAX_FILEPATH_LENGTH);
-
-    struct dirent *dp = NULL;
-    DIR *dir = opendir(basePath);
+    DIR *dir = opendir(scan->path);
 
     if (dir != NULL)
     {
-        while ((dp = readdir(dir)) != NULL)
+        struct dirent *dp = NULL;
+
+        while (!scan->stop && ((dp = readdir(dir)) != NULL))
         {
-            if ((strcmp(dp->d_name, ".") != 0) &&
-                (strcmp(dp->d_name, "..") != 0))
+            const char *name = dp->d_name;
+
+            // NOTE: We skip '.' (current dir) and '..' (parent dir) filepaths
+            if ((name[0] == '.') && ((name[1] == '\0') || ((name[1] == '.') && (name[2] == '\0')))) continue;
+
+            int nameLength = (int)strlen(name);
+            if ((pathLength + 1 + nameLength) >= MAX_FILEPATH_LENGTH)
             {
-            #if defined(_WIN32)
-                sprintf(path, "%s\\%s", basePath, dp->d_name);
-            #else
-                sprintf(path, "%s/%s", basePath, dp->d_name);
-            #endif
+                TRACELOG(LOG_WARNING, "FILEIO: Path too long, entry skipped (%s)", name);
+                continue;
+            }
 
-                if (filter != NULL)
-                {
-                    if (IsPathFile(path))
-                    {
-                        if (IsFileExtension(path, filter))
-                        {
-                            strcpy(files->paths[files->count], path);
-                            files->count++;
-                        }
-                    }
-                    else
-                    {
-                        if (TextFindIndex(filter, DIRECTORY_FILTER_TAG) >= 0)
-                        {
-                            strcpy(files->paths[files->count], path);
-                            files->count++;
-                        }
-                    }
-                }
-                else
+            // Construct new path from our base path
+        #if defined(_WIN32)
+            scan->path[pathLength] = '\\';
+        #else
+            scan->path[pathLength] = '/';
+        #endif
+            memcpy(scan->path + pathLength + 1, name, nameLength + 1);
+
+            bool isDirectory = false;
+        #if defined(DT_DIR)
+            if ((dp->d_type == DT_UNKNOWN) || (dp->d_type == DT_LNK))
+            {
+                struct stat result = { 0 };
+                isDirectory = ((stat(scan->path, &result) == 0) && S_ISDIR(result.st_mode));
+            }
+            else isDirectory = (dp->d_type == DT_DIR);
+        #else
+            struct stat result = { 0 };
+            isDirectory = ((stat(scan->path, &result) == 0) && S_ISDIR(result.st_mode));
+        #endif
+
+            if (isDirectory)
+            {
+                if (scan->includeDirs)
                 {
-                    strcpy(files->paths[files->count], path);
-                    files->count++;
+                    scan->count++;
+                    if (!scan->callback(scan->path, true, scan->userData)) scan->stop = true;
                 }
+
+                if (scan->scanSubdirs && !scan->stop) ScanDirectoryEntries(scan, pathLength + 1 + nameLength);
+            }
+            else if ((scan->filter == NULL) || IsFileExtensionInFilter(name, scan->filter))
+            {
+                scan->count++;
+                if (!scan->callback(scan->path, false, scan->userData)) scan->stop = true;
             }
         }
 
         closedir(dir);
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+    else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", scan->path);
+
+    scan->path[pathLength] = '\0';
 }
 
-// Scan all files and directories recursively from a base path
-static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *files, const char *filter)
+// Check if file name extension is in filter (';' separated extensions)
+// NOTE: Same comparison as IsFileExtension() but without static buffers, so it can be used from scan jobs
+static bool IsFileExtensionInFilter(const char *fileName, const char *filter)
 {
-    char path[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, MAX_FILEPATH_LENGTH);
-
-    struct dirent *dp = NULL;
-    DIR *dir = opendir(basePath);
+    bool result = false;
+    const char *fileExt = strrchr(fileName, '.');
 
-    if (dir != NULL)
+    if (fileExt != NULL)
     {
-        while (((dp = readdir(dir)) != NULL) && (files->count < files->capacity))
+#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_TEXT_MANIPULATION)
+        int extLength = (int)strlen(fileExt);
+        const char *checkExt = filter;
+
+        while (!result && (checkExt[0] != '\0'))
         {
-            if ((strcmp(dp->d_name, ".") != 0) && (strcmp(dp->d_name, "..") != 0))
+            int checkLength = 0;
+            while ((checkExt[checkLength] != '\0') && (checkExt[checkLength] != ';')) checkLength++;
+
+            if (checkLength == extLength)
             {
-                // Construct new path from our base path
-            #if defined(_WIN32)
-                sprintf(path, "%s\\%s", basePath, dp->d_name);
-            #else
-                sprintf(path, "%s/%s", basePath, dp->d_name);
-            #endif
-
-                if (IsPathFile(path))
+                result = true;
+
+                for (int i = 0; i < extLength; i++)
                 {
-                    if (filter != NULL)
-                    {
-                        if (IsFileExtension(path, filter))
-                        {
-                            strcpy(files->paths[files->count], path);
-                            files->count++;
-                        }
-                    }
-                    else
-                    {
-                        strcpy(files->paths[files->count], path);
-                        files->count++;
-                    }
+                    char a = fileExt[i];
+                    char b = checkExt[i];
+                    if ((a >= 'A') && (a <= 'Z')) a += 32;
+                    if ((b >= 'A') && (b <= 'Z')) b += 32;
 
-                    if (files->count >= files->capacity)
+                    if (a != b)
                     {
-                        TRACELOG(LOG_WARNING, "FILEIO: Maximum filepath scan capacity reached (%i files)", files->capacity);
+                        result = false;
                         break;
                     }
                 }
-                else
-                {
-                    if ((filter != NULL) && (TextFindIndex(filter, DIRECTORY_FILTER_TAG) >= 0))
-                    {
-                        strcpy(files->paths[files->count], path);
-                        files->count++;
-                    }
+            }
 
-                    if (files->count >= files->capacity)
-                    {
-                        TRACELOG(LOG_WARNING, "FILEIO: Maximum filepath scan capacity reached (%i files)", files->capacity);
-                        break;
-                    }
+            checkExt += checkLength;
+            if (checkExt[0] == ';') checkExt++;
+        }
+#else
+        if (strcmp(fileExt, filter) == 0) result = true;
+#endif
+    }
 
-                    ScanDirectoryFilesRecursively(path, files, filter);
-                }
-            }
+    return result;
+}
+
+// Append path to paths arena
+// NOTE: Used as ScanDirectoryCallback, stops scanning if memory can not be allocated
+static bool AppendFilePath(const char *path, bool isDirectory, void *arena)
+{
+    (void)isDirectory;
+    FilePathArena *paths = (FilePathArena *)arena;
+    size_t length = strlen(path) + 1;
+
+    if ((paths->size + length) > paths->capacity)
+    {
+        size_t capacity = (paths->capacity > 0)? paths->capacity*2 : 64*1024;
+        while (capacity < (paths->size + length)) capacity *= 2;
+
+        char *data = (char *)RL_REALLOC(paths->data, capacity);
+        if (data == NULL)
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: Failed to allocate memory for scanned paths (%u paths)", paths->count);
+            return false;
         }
 
-        closedir(dir);
+        paths->data = data;
+        paths->capacity = capacity;
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+
+    memcpy(paths->data + paths->size, path, length);
+    paths->size += length;
+    paths->count++;
+
+    return true;
 }
 
-#if defined(SUPPORT_AUTOMATION_EVENTS)
-// Automation event recording
-// NOTE: Recording is by default done at EndDrawing(), before PollInputEvents()
-static void RecordAutomationEvent(void)
+// Append base path entry to parallel scan jobs data
+static bool AppendScanJobEntry(const char *path, bool isDirectory, void *job)
 {
-    // Checking events in current frame and save them into currentEventList
-    // TODO: How important is the current frame? Could it be modified?
+    DirectoryScanJobData *scanJob = (DirectoryScanJobData *)job;
 
-    if (currentEventList->count == currentEventList->capacity) return;    // Security check
+    if (scanJob->entries.count >= scanJob->entryCapacity)
+    {
+        unsigned int capacity = (scanJob->entryCapacity > 0)? scanJob->entryCapacity*2 : 256;
+        bool *entryIsDirectory = (bool *)RL_REALLOC(scanJob->entryIsDirectory, capacity*sizeof(bool));
+        if (entryIsDirectory == NULL) return false;
 
-    // Keyboard input events recording
-    //-------------------------------------------------------------------------------------
-    for (int key = 0; key < MAX_KEYBOARD_KEYS; key++)
+        scanJob->entryIsDirectory = entryIsDirectory;
+        scanJob->entryCapacity = capacity;
+    }
+
+    if (!AppendFilePath(path, isDirectory, &scanJob->entries)) return false;
+    scanJob->entryIsDirectory[scanJob->entries.count - 1] = isDirectory;
+
+    return true;
+}
+
+// Scan subdirectory job, scan results are stored in its own arena
+static void ScanDirectoryJob(void *data, int index)
+{
+    DirectoryScanJobData *job = (DirectoryScanJobData *)data;
+
+    ScanDirectoryFiles(job->subdirs[index], job->filter, true, AppendFilePath, &job->results[index]);
+}
+
+// Scan directory recursively, base path subdirectories are scanned in parallel
+// NOTE: Resulting paths order matches the serial scan, subdirectory paths are merged after its entry
+static void ScanDirectoryParallel(const char *basePath, const char *filter, FilePathArena *arena)
+{
+    DirectoryScanJobData job = { 0 };
+    job.filter = filter;
+
+    // Scan base path entries, no filtering, all subdirectories are required
+    ScanDirectoryFiles(basePath, NULL, false, AppendScanJobEntry, &job);
+
+    int subdirCount = 0;
+    for (unsigned int i = 0; i < job.entries.count; i++) if (job.entryIsDirectory[i]) subdirCount++;
+
+    if (subdirCount > 0)
     {
-        // Event type: INPUT_KEY_UP (only saved once)
-        if (CORE.Input.Keyboard.previousKeyState[key] && !CORE.Input.Keyboard.currentKeyState[key])
+        job.subdirs = (char **)RL_MALLOC(subdirCount*sizeof(char *));
+        job.results = (FilePathArena *)RL_CALLOC(subdirCount, sizeof(FilePathArena));
+
+        if ((job.subdirs != NULL) && (job.results != NULL))
         {
-            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-            currentEventList->events[currentEventList->count].type = INPUT_KEY_UP;
-            currentEventList->events[currentEventList->count].params[0] = key;
-            currentEventList->events[currentEventList->count].params[1] = 0;
-            currentEventList->events[currentEventList->count].params[2] = 0;
+            char *entry = job.entries.data;
+            for (unsigned int i = 0, k = 0; i < job.entries.count; i++)
+            {
+                if (job.entryIsDirectory[i]) job.subdirs[k++] = entry;
+                entry += strlen(entry) + 1;
+            }
 
-            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_KEY_UP | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-            currentEventList->count++;
+            RunParallelJobs(ScanDirectoryJob, &job, subdirCount);
         }
+        else subdirCount = -1;
+    }
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+    // Merge base path entries and subdirectories results
+    if (subdirCount >= 0)
+    {
+        bool includeDirs = ((filter != NULL) && (strstr(filter, DIRECTORY_FILTER_TAG) != NULL));
+        const char *entry = job.entries.data;
 
-        // Event type: INPUT_KEY_DOWN
-        if (CORE.Input.Keyboard.currentKeyState[key])
+        for (unsigned int i = 0, k = 0; i < job.entries.count; i++)
         {
-            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-            currentEventList->events[currentEventList->count].type = INPUT_KEY_DOWN;
-            currentEventList->events[currentEventList->count].params[0] = key;
-            currentEventList->events[currentEventList->count].params[1] = 0;
-            currentEventList->events[currentEventList->count].params[2] = 0;
+            if (job.entryIsDirectory[i])
+            {
+                if (includeDirs) AppendFilePath(entry, true, arena);
 
-            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_KEY_DOWN | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-            currentEventList->count++;
-        }
+                FilePathArena *result = &job.results[k++];
+                const char *path = result->data;
+                for (unsigned int j = 0; j < result->count; j++)
+                {
+                    if (!AppendFilePath(path, false, arena)) break;
+                    path += strlen(path) + 1;
+                }
+            }
+            else if ((filter == NULL) || IsFileExtensionInFilter(GetFileName(entry), filter)) AppendFilePath(entry, false, arena);
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+            entry += strlen(entry) + 1;
+        }
     }
-    //-------------------------------------------------------------------------------------
+    else TRACELOG(LOG_WARNING, "FILEIO: Failed to allocate memory for directory scan jobs");
 
-    // Mouse input currentEventList->events recording
-    //-------------------------------------------------------------------------------------
-    for (int button = 0; button < MAX_MOUSE_BUTTONS; button++)
+    for (int i = 0; i < subdirCount; i++) RL_FREE(job.results[i].data);
+    RL_FREE(job.results);
+    RL_FREE(job.subdirs);
+    RL_FREE(job.entryIsDirectory);
+    RL_FREE(job.entries.data);
+}
+
+// Load file paths list from arena
+// NOTE: Paths pointers and strings are stored in a single memory block, freed by UnloadDirectoryFiles()
+static FilePathList LoadFilePathList(const FilePathArena *arena)
+{
+    FilePathList files = { 0 };
+
+    if (arena->count > 0)
     {
-        // Event type: INPUT_MOUSE_BUTTON_UP
-        if (CORE.Input.Mouse.previousButtonState[button] && !CORE.Input.Mouse.currentButtonState[button])
+        char **paths = (char **)RL_MALLOC(arena->count*sizeof(char *) + arena->size);
+
+        if (paths != NULL)
         {
-            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-            currentEventList->events[currentEventList->count].type = INPUT_MOUSE_BUTTON_UP;
-            currentEventList->events[currentEventList->count].params[0] = button;
-            currentEventList->events[currentEventList->count].params[1] = 0;
-            currentEventList->events[currentEventList->count].params[2] = 0;
+            char *data = (char *)(paths + arena->count);
+            memcpy(data, arena->data, arena->size);
+
+            for (unsigned int i = 0; i < arena->count; i++)
+            {
+                paths[i] = data;
+                data += strlen(data) + 1;
+            }
 
-            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_MOUSE_BUTTON_UP | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-            currentEventList->count++;
+            files.capacity = arena->count;
+            files.count = arena->count;
+            files.paths = paths;
         }
+        else TRACELOG(LOG_WARNING, "FILEIO: Failed to allocate memory for file paths list");
+    }
+
+    return files;
+}
+
+// Read 32 bit little-endian value from bytes
+static inline unsigned int ReadU32LE(const unsigned char *p)
+{
+    return (unsigned int)p[0] | ((unsigned int)p[1] << 8) | ((unsigned int)p[2] << 16) | ((unsigned int)p[3] << 24);
+}
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+// Read 64 bit little-endian value from bytes
+static inline unsigned long long ReadU64LE(const unsigned char *p)
+{
+    return (unsigned long long)ReadU32LE(p) | ((unsigned long long)ReadU32LE(p + 4) << 32);
+}
 
-        // Event type: INPUT_MOUSE_BUTTON_DOWN
-        if (CORE.Input.Mouse.currentButtonState[button])
+// Update CRC32 value with data (no initial/final inversion)
+// NOTE: Using PCLMULQDQ folding (x86) or CRC32 instructions (ARMv8) if enabled on compilation,
+// slicing-by-8 tables otherwise (processing 8 bytes per iteration)
+static unsigned int UpdateCRC32(unsigned int crc, const unsigned char *data, int dataSize)
+{
+    static const unsigned int crcTable[8][256] = {
+        {
+            0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+            0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+            0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+            0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+            0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+            0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+            0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+            0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+            0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+            0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+            0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+            0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+            0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+            0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+            0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+            0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+            0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+            0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+            0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+            0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+            0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+            0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+            0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+            0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+            0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+            0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+            0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+            0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+            0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+            0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+            0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+            0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
+        },
+        {
+            0x00000000, 0x191B3141, 0x32366282, 0x2B2D53C3, 0x646CC504, 0x7D77F445, 0x565AA786, 0x4F4196C7,
+            0xC8D98A08, 0xD1C2BB49, 0xFAEFE88A, 0xE3F4D9CB, 0xACB54F0C, 0xB5AE7E4D, 0x9E832D8E, 0x87981CCF,
+            0x4AC21251, 0x53D92310, 0x78F470D3, 0x61EF4192, 0x2EAED755, 0x37B5E614, 0x1C98B5D7, 0x05838496,
+            0x821B9859, 0x9B00A918, 0xB02DFADB, 0xA936CB9A, 0xE6775D5D, 0xFF6C6C1C, 0xD4413FDF, 0xCD5A0E9E,
+            0x958424A2, 0x8C9F15E3, 0xA7B24620, 0xBEA97761, 0xF1E8E1A6, 0xE8F3D0E7, 0xC3DE8324, 0xDAC5B265,
+            0x5D5DAEAA, 0x44469FEB, 0x6F6BCC28, 0x7670FD69, 0x39316BAE, 0x202A5AEF, 0x0B07092C, 0x121C386D,
+            0xDF4636F3, 0xC65D07B2, 0xED705471, 0xF46B6530, 0xBB2AF3F7, 0xA231C2B6, 0x891C9175, 0x9007A034,
+            0x179FBCFB, 0x0E848DBA, 0x25A9DE79, 0x3CB2EF38, 0x73F379FF, 0x6AE848BE, 0x41C51B7D, 0x58DE2A3C,
+            0xF0794F05, 0xE9627E44, 0xC24F2D87, 0xDB541CC6, 0x94158A01, 0x8D0EBB40, 0xA623E883, 0xBF38D9C2,
+            0x38A0C50D, 0x21BBF44C, 0x0A96A78F, 0x138D96CE, 0x5CCC0009, 0x45D73148, 0x6EFA628B, 0x77E153CA,
+            0xBABB5D54, 0xA3A06C15, 0x888D3FD6, 0x91960E97, 0xDED79850, 0xC7CCA911, 0xECE1FAD2, 0xF5FACB93,
+            0x7262D75C, 0x6B79E61D, 0x4054B5DE, 0x594F849F, 0x160E1258, 0x0F152319, 0x243870DA, 0x3D23419B,
+            0x65FD6BA7, 0x7CE65AE6, 0x57CB0925, 0x4ED03864, 0x0191AEA3, 0x188A9FE2, 0x33A7CC21, 0x2ABCFD60,
+            0xAD24E1AF, 0xB43FD0EE, 0x9F12832D, 0x8609B26C, 0xC94824AB, 0xD05315EA, 0xFB7E4629, 0xE2657768,
+            0x2F3F79F6, 0x362448B7, 0x1D091B74, 0x04122A35, 0x4B53BCF2, 0x52488DB3, 0x7965DE70, 0x607EEF31,
+            0xE7E6F3FE, 0xFEFDC2BF, 0xD5D0917C, 0xCCCBA03D, 0x838A36FA, 0x9A9107BB, 0xB1BC5478, 0xA8A76539,
+            0x3B83984B, 0x2298A90A, 0x09B5FAC9, 0x10AECB88, 0x5FEF5D4F, 0x46F46C0E, 0x6DD93FCD, 0x74C20E8C,
+            0xF35A1243, 0xEA412302, 0xC16C70C1, 0xD8774180, 0x9736D747, 0x8E2DE606, 0xA500B5C5, 0xBC1B8484,
+            0x71418A1A, 0x685ABB5B, 0x4377E898, 0x5A6CD9D9, 0x152D4F1E, 0x0C367E5F, 0x271B2D9C, 0x3E001CDD,
+            0xB9980012, 0xA0833153, 0x8BAE6290, 0x92B553D1, 0xDDF4C516, 0xC4EFF457, 0xEFC2A794, 0xF6D996D5,
+            0xAE07BCE9, 0xB71C8DA8, 0x9C31DE6B, 0x852AEF2A, 0xCA6B79ED, 0xD37048AC, 0xF85D1B6F, 0xE1462A2E,
+            0x66DE36E1, 0x7FC507A0, 0x54E85463, 0x4DF36522, 0x02B2F3E5, 0x1BA9C2A4, 0x30849167, 0x299FA026,
+            0xE4C5AEB8, 0xFDDE9FF9, 0xD6F3CC3A, 0xCFE8FD7B, 0x80A96BBC, 0x99B25AFD, 0xB29F093E, 0xAB84387F,
+            0x2C1C24B0, 0x350715F1, 0x1E2A4632, 0x07317773, 0x4870E1B4, 0x516BD0F5, 0x7A468336, 0x635DB277,
+            0xCBFAD74E, 0xD2E1E60F, 0xF9CCB5CC, 0xE0D7848D, 0xAF96124A, 0xB68D230B, 0x9DA070C8, 0x84BB4189,
+            0x03235D46, 0x1A386C07, 0x31153FC4, 0x280E0E85, 0x674F9842, 0x7E54A903, 0x5579FAC0, 0x4C62CB81,
+            0x8138C51F, 0x9823F45E, 0xB30EA79D, 0xAA1596DC, 0xE554001B, 0xFC4F315A, 0xD7626299, 0xCE7953D8,
+            0x49E14F17, 0x50FA7E56, 0x7BD72D95, 0x62CC1CD4, 0x2D8D8A13, 0x3496BB52, 0x1FBBE891, 0x06A0D9D0,
+            0x5E7EF3EC, 0x4765C2AD, 0x6C48916E, 0x7553A02F, 0x3A1236E8, 0x230907A9, 0x0824546A, 0x113F652B,
+            0x96A779E4, 0x8FBC48A5, 0xA4911B66, 0xBD8A2A27, 0xF2CBBCE0, 0xEBD08DA1, 0xC0FDDE62, 0xD9E6EF23,
+            0x14BCE1BD, 0x0DA7D0FC, 0x268A833F, 0x3F91B27E, 0x70D024B9, 0x69CB15F8, 0x42E6463B, 0x5BFD777A,
+            0xDC656BB5, 0xC57E5AF4, 0xEE530937, 0xF7483876, 0xB809AEB1, 0xA1129FF0, 0x8A3FCC33, 0x9324FD72
+        },
         {
-            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-            currentEventList->events[currentEventList->count].type = INPUT_MOUSE_BUTTON_DOWN;
-            currentEventList->events[currentEventList->count].params[0] = button;
-            currentEventList->events[currentEventList->count].params[1] = 0;
-            currentEventList->events[currentEventList->count].params[2] = 0;
+            0x00000000, 0x01C26A37, 0x0384D46E, 0x0246BE59, 0x0709A8DC, 0x06CBC2EB, 0x048D7CB2, 0x054F1685,
+            0x0E1351B8, 0x0FD13B8F, 0x0D9785D6, 0x0C55EFE1, 0x091AF964, 0x08D89353, 0x0A9E2D0A, 0x0B5C473D,
+            0x1C26A370, 0x1DE4C947, 0x1FA2771E, 0x1E601D29, 0x1B2F0BAC, 0x1AED619B, 0x18ABDFC2, 0x1969B5F5,
+            0x1235F2C8, 0x13F798FF, 0x11B126A6, 0x10734C91, 0x153C5A14, 0x14FE3023, 0x16B88E7A, 0x177AE44D,
+            0x384D46E0, 0x398F2CD7, 0x3BC9928E, 0x3A0BF8B9, 0x3F44EE3C, 0x3E86840B, 0x3CC03A52, 0x3D025065,
+            0x365E1758, 0x379C7D6F, 0x35DAC336, 0x3418A901, 0x3157BF84, 0x3095D5B3, 0x32D36BEA, 0x331101DD,
+            0x246BE590, 0x25A98FA7, 0x27EF31FE, 0x262D5BC9, 0x23624D4C, 0x22A0277B, 0x20E69922, 0x2124F315,
+            0x2A78B428, 0x2BBADE1F, 0x29FC6046, 0x283E0A71, 0x2D711CF4, 0x2CB376C3, 0x2EF5C89A, 0x2F37A2AD,
+            0x709A8DC0, 0x7158E7F7, 0x731E59AE, 0x72DC3399, 0x7793251C, 0x76514F2B, 0x7417F172, 0x75D59B45,
+            0x7E89DC78, 0x7F4BB64F, 0x7D0D0816, 0x7CCF6221, 0x798074A4, 0x78421E93, 0x7A04A0CA, 0x7BC6CAFD,
+            0x6CBC2EB0, 0x6D7E4487, 0x6F38FADE, 0x6EFA90E9, 0x6BB5866C, 0x6A77EC5B, 0x68315202, 0x69F33835,
+            0x62AF7F08, 0x636D153F, 0x612BAB66, 0x60E9C151, 0x65A6D7D4, 0x6464BDE3, 0x662203BA, 0x67E0698D,
+            0x48D7CB20, 0x4915A117, 0x4B531F4E, 0x4A917579, 0x4FDE63FC, 0x4E1C09CB, 0x4C5AB792, 0x4D98DDA5,
+            0x46C49A98, 0x4706F0AF, 0x45404EF6, 0x448224C1, 0x41CD3244, 0x400F5873, 0x4249E62A, 0x438B8C1D,
+            0x54F16850, 0x55330267, 0x5775BC3E, 0x56B7D609, 0x53F8C08C, 0x523AAABB, 0x507C14E2, 0x51BE7ED5,
+            0x5AE239E8, 0x5B2053DF, 0x5966ED86, 0x58A487B1, 0x5DEB9134, 0x5C29FB03, 0x5E6F455A, 0x5FAD2F6D,
+            0xE1351B80, 0xE0F771B7, 0xE2B1CFEE, 0xE373A5D9, 0xE63CB35C, 0xE7FED96B, 0xE5B86732, 0xE47A0D05,
+            0xEF264A38, 0xEEE4200F, 0xECA29E56, 0xED60F461, 0xE82FE2E4, 0xE9ED88D3, 0xEBAB368A, 0xEA695CBD,
+            0xFD13B8F0, 0xFCD1D2C7, 0xFE976C9E, 0xFF5506A9, 0xFA1A102C, 0xFBD87A1B, 0xF99EC442, 0xF85CAE75,
+            0xF300E948, 0xF2C2837F, 0xF0843D26, 0xF1465711, 0xF4094194, 0xF5CB2BA3, 0xF78D95FA, 0xF64FFFCD,
+            0xD9785D60, 0xD8BA3757, 0xDAFC890E, 0xDB3EE339, 0xDE71F5BC, 0xDFB39F8B, 0xDDF521D2, 0xDC374BE5,
+            0xD76B0CD8, 0xD6A966EF, 0xD4EFD8B6, 0xD52DB281, 0xD062A404, 0xD1A0CE33, 0xD3E6706A, 0xD2241A5D,
+            0xC55EFE10, 0xC49C9427, 0xC6DA2A7E, 0xC7184049, 0xC25756CC, 0xC3953CFB, 0xC1D382A2, 0xC011E895,
+            0xCB4DAFA8, 0xCA8FC59F, 0xC8C97BC6, 0xC90B11F1, 0xCC440774, 0xCD866D43, 0xCFC0D31A, 0xCE02B92D,
+            0x91AF9640, 0x906DFC77, 0x922B422E, 0x93E92819, 0x96A63E9C, 0x976454AB, 0x9522EAF2, 0x94E080C5,
+            0x9FBCC7F8, 0x9E7EADCF, 0x9C381396, 0x9DFA79A1, 0x98B56F24, 0x99770513, 0x9B31BB4A, 0x9AF3D17D,
+            0x8D893530, 0x8C4B5F07, 0x8E0DE15E, 0x8FCF8B69, 0x8A809DEC, 0x8B42F7DB, 0x89044982, 0x88C623B5,
+            0x839A6488, 0x82580EBF, 0x801EB0E6, 0x81DCDAD1, 0x8493CC54, 0x8551A663, 0x8717183A, 0x86D5720D,
+            0xA9E2D0A0, 0xA820BA97, 0xAA6604CE, 0xABA46EF9, 0xAEEB787C, 0xAF29124B, 0xAD6FAC12, 0xACADC625,
+            0xA7F18118, 0xA633EB2F, 0xA4755576, 0xA5B73F41, 0xA0F829C4, 0xA13A43F3, 0xA37CFDAA, 0xA2BE979D,
+            0xB5C473D0, 0xB40619E7, 0xB640A7BE, 0xB782CD89, 0xB2CDDB0C, 0xB30FB13B, 0xB1490F62, 0xB08B6555,
+            0xBBD72268, 0xBA15485F, 0xB853F606, 0xB9919C31, 0xBCDE8AB4, 0xBD1CE083, 0xBF5A5EDA, 0xBE9834ED
+        },
+        {
+            0x00000000, 0xB8BC6765, 0xAA09C88B, 0x12B5AFEE, 0x8F629757, 0x37DEF032, 0x256B5FDC, 0x9DD738B9,
+            0xC5B428EF, 0x7D084F8A, 0x6FBDE064, 0xD7018701, 0x4AD6BFB8, 0xF26AD8DD, 0xE0DF7733, 0x58631056,
+            0x5019579F, 0xE8A530FA, 0xFA109F14, 0x42ACF871, 0xDF7BC0C8, 0x67C7A7AD, 0x75720843, 0xCDCE6F26,
+            0x95AD7F70, 0x2D111815, 0x3FA4B7FB, 0x8718D09E, 0x1ACFE827, 0xA2738F42, 0xB0C620AC, 0x087A47C9,
+            0xA032AF3E, 0x188EC85B, 0x0A3B67B5, 0xB28700D0, 0x2F503869, 0x97EC5F0C, 0x8559F0E2, 0x3DE59787,
+            0x658687D1, 0xDD3AE0B4, 0xCF8F4F5A, 0x7733283F, 0xEAE41086, 0x525877E3, 0x40EDD80D, 0xF851BF68,
+            0xF02BF8A1, 0x48979FC4, 0x5A22302A, 0xE29E574F, 0x7F496FF6, 0xC7F50893, 0xD540A77D, 0x6DFCC018,
+            0x359FD04E, 0x8D23B72B, 0x9F9618C5, 0x272A7FA0, 0xBAFD4719, 0x0241207C, 0x10F48F92, 0xA848E8F7,
+            0x9B14583D, 0x23A83F58, 0x311D90B6, 0x89A1F7D3, 0x1476CF6A, 0xACCAA80F, 0xBE7F07E1, 0x06C36084,
+            0x5EA070D2, 0xE61C17B7, 0xF4A9B859, 0x4C15DF3C, 0xD1C2E785, 0x697E80E0, 0x7BCB2F0E, 0xC377486B,
+            0xCB0D0FA2, 0x73B168C7, 0x6104C729, 0xD9B8A04C, 0x446F98F5, 0xFCD3FF90, 0xEE66507E, 0x56DA371B,
+            0x0EB9274D, 0xB6054028, 0xA4B0EFC6, 0x1C0C88A3, 0x81DBB01A, 0x3967D77F, 0x2BD27891, 0x936E1FF4,
+            0x3B26F703, 0x839A9066, 0x912F3F88, 0x299358ED, 0xB4446054, 0x0CF80731, 0x1E4DA8DF, 0xA6F1CFBA,
+            0xFE92DFEC, 0x462EB889, 0x549B1767, 0xEC277002, 0x71F048BB, 0xC94C2FDE, 0xDBF98030, 0x6345E755,
+            0x6B3FA09C, 0xD383C7F9, 0xC1366817, 0x798A0F72, 0xE45D37CB, 0x5CE150AE, 0x4E54FF40, 0xF6E89825,
+            0xAE8B8873, 0x1637EF16, 0x048240F8, 0xBC3E279D, 0x21E91F24, 0x99557841, 0x8BE0D7AF, 0x335CB0CA,
+            0xED59B63B, 0x55E5D15E, 0x47507EB0, 0xFFEC19D5, 0x623B216C, 0xDA874609, 0xC832E9E7, 0x708E8E82,
+            0x28ED9ED4, 0x9051F9B1, 0x82E4565F, 0x3A58313A, 0xA78F0983, 0x1F336EE6, 0x0D86C108, 0xB53AA66D,
+            0xBD40E1A4, 0x05FC86C1, 0x1749292F, 0xAFF54E4A, 0x322276F3, 0x8A9E1196, 0x982BBE78, 0x2097D91D,
+            0x78F4C94B, 0xC048AE2E, 0xD2FD01C0, 0x6A4166A5, 0xF7965E1C, 0x4F2A3979, 0x5D9F9697, 0xE523F1F2,
+            0x4D6B1905, 0xF5D77E60, 0xE762D18E, 0x5FDEB6EB, 0xC2098E52, 0x7AB5E937, 0x680046D9, 0xD0BC21BC,
+            0x88DF31EA, 0x3063568F, 0x22D6F961, 0x9A6A9E04, 0x07BDA6BD, 0xBF01C1D8, 0xADB46E36, 0x15080953,
+            0x1D724E9A, 0xA5CE29FF, 0xB77B8611, 0x0FC7E174, 0x9210D9CD, 0x2AACBEA8, 0x38191146, 0x80A57623,
+            0xD8C66675, 0x607A0110, 0x72CFAEFE, 0xCA73C99B, 0x57A4F122, 0xEF189647, 0xFDAD39A9, 0x45115ECC,
+            0x764DEE06, 0xCEF18963, 0xDC44268D, 0x64F841E8, 0xF92F7951, 0x41931E34, 0x5326B1DA, 0xEB9AD6BF,
+            0xB3F9C6E9, 0x0B45A18C, 0x19F00E62, 0xA14C6907, 0x3C9B51BE, 0x842736DB, 0x96929935, 0x2E2EFE50,
+            0x2654B999, 0x9EE8DEFC, 0x8C5D7112, 0x34E11677, 0xA9362ECE, 0x118A49AB, 0x033FE645, 0xBB838120,
+            0xE3E09176, 0x5B5CF613, 0x49E959FD, 0xF1553E98, 0x6C820621, 0xD43E6144, 0xC68BCEAA, 0x7E37A9CF,
+            0xD67F4138, 0x6EC3265D, 0x7C7689B3, 0xC4CAEED6, 0x591DD66F, 0xE1A1B10A, 0xF3141EE4, 0x4BA87981,
+            0x13CB69D7, 0xAB770EB2, 0xB9C2A15C, 0x017EC639, 0x9CA9FE80, 0x241599E5, 0x36A0360B, 0x8E1C516E,
+            0x866616A7, 0x3EDA71C2, 0x2C6FDE2C, 0x94D3B949, 0x090481F0, 0xB1B8E695, 0xA30D497B, 0x1BB12E1E,
+            0x43D23E48, 0xFB6E592D, 0xE9DBF6C3, 0x516791A6, 0xCCB0A91F, 0x740CCE7A, 0x66B96194, 0xDE0506F1
+        },
+        {
+            0x00000000, 0x3D6029B0, 0x7AC05360, 0x47A07AD0, 0xF580A6C0, 0xC8E08F70, 0x8F40F5A0, 0xB220DC10,
+            0x30704BC1, 0x0D106271, 0x4AB018A1, 0x77D03111, 0xC5F0ED01, 0xF890C4B1, 0xBF30BE61, 0x825097D1,
+            0x60E09782, 0x5D80BE32, 0x1A20C4E2, 0x2740ED52, 0x95603142, 0xA80018F2, 0xEFA06222, 0xD2C04B92,
+            0x5090DC43, 0x6DF0F5F3, 0x2A508F23, 0x1730A693, 0xA5107A83, 0x98705333, 0xDFD029E3, 0xE2B00053,
+            0xC1C12F04, 0xFCA106B4, 0xBB017C64, 0x866155D4, 0x344189C4, 0x0921A074, 0x4E81DAA4, 0x73E1F314,
+            0xF1B164C5, 0xCCD14D75, 0x8B7137A5, 0xB6111E15, 0x0431C205, 0x3951EBB5, 0x7EF19165, 0x4391B8D5,
+            0xA121B886, 0x9C419136, 0xDBE1EBE6, 0xE681C256, 0x54A11E46, 0x69C137F6, 0x2E614D26, 0x13016496,
+            0x9151F347, 0xAC31DAF7, 0xEB91A027, 0xD6F18997, 0x64D15587, 0x59B17C37, 0x1E1106E7, 0x23712F57,
+            0x58F35849, 0x659371F9, 0x22330B29, 0x1F532299, 0xAD73FE89, 0x9013D739, 0xD7B3ADE9, 0xEAD38459,
+            0x68831388, 0x55E33A38, 0x124340E8, 0x2F236958, 0x9D03B548, 0xA0639CF8, 0xE7C3E628, 0xDAA3CF98,
+            0x3813CFCB, 0x0573E67B, 0x42D39CAB, 0x7FB3B51B, 0xCD93690B, 0xF0F340BB, 0xB7533A6B, 0x8A3313DB,
+            0x0863840A, 0x3503ADBA, 0x72A3D76A, 0x4FC3FEDA, 0xFDE322CA, 0xC0830B7A, 0x872371AA, 0xBA43581A,
+            0x9932774D, 0xA4525EFD, 0xE3F2242D, 0xDE920D9D, 0x6CB2D18D, 0x51D2F83D, 0x167282ED, 0x2B12AB5D,
+            0xA9423C8C, 0x9422153C, 0xD3826FEC, 0xEEE2465C, 0x5CC29A4C, 0x61A2B3FC, 0x2602C92C, 0x1B62E09C,
+            0xF9D2E0CF, 0xC4B2C97F, 0x8312B3AF, 0xBE729A1F, 0x0C52460F, 0x31326FBF, 0x7692156F, 0x4BF23CDF,
+            0xC9A2AB0E, 0xF4C282BE, 0xB362F86E, 0x8E02D1DE, 0x3C220DCE, 0x0142247E, 0x46E25EAE, 0x7B82771E,
+            0xB1E6B092, 0x8C869922, 0xCB26E3F2, 0xF646CA42, 0x44661652, 0x79063FE2, 0x3EA64532, 0x03C66C82,
+            0x8196FB53, 0xBCF6D2E3, 0xFB56A833, 0xC6368183, 0x74165D93, 0x49767423, 0x0ED60EF3, 0x33B62743,
+            0xD1062710, 0xEC660EA0, 0xABC67470, 0x96A65DC0, 0x248681D0, 0x19E6A860, 0x5E46D2B0, 0x6326FB00,
+            0xE1766CD1, 0xDC164561, 0x9BB63FB1, 0xA6D61601, 0x14F6CA11, 0x2996E3A1, 0x6E369971, 0x5356B0C1,
+            0x70279F96, 0x4D47B626, 0x0AE7CCF6, 0x3787E546, 0x85A73956, 0xB8C710E6, 0xFF676A36, 0xC2074386,
+            0x4057D457, 0x7D37FDE7, 0x3A978737, 0x07F7AE87, 0xB5D77297, 0x88B75B27, 0xCF1721F7, 0xF2770847,
+            0x10C70814, 0x2DA721A4, 0x6A075B74, 0x576772C4, 0xE547AED4, 0xD8278764, 0x9F87FDB4, 0xA2E7D404,
+            0x20B743D5, 0x1DD76A65, 0x5A7710B5, 0x67173905, 0xD537E515, 0xE857CCA5, 0xAFF7B675, 0x92979FC5,
+            0xE915E8DB, 0xD475C16B, 0x93D5BBBB, 0xAEB5920B, 0x1C954E1B, 0x21F567AB, 0x66551D7B, 0x5B3534CB,
+            0xD965A31A, 0xE4058AAA, 0xA3A5F07A, 0x9EC5D9CA, 0x2CE505DA, 0x11852C6A, 0x562556BA, 0x6B457F0A,
+            0x89F57F59, 0xB49556E9, 0xF3352C39, 0xCE550589, 0x7C75D999, 0x4115F029, 0x06B58AF9, 0x3BD5A349,
+            0xB9853498, 0x84E51D28, 0xC34567F8, 0xFE254E48, 0x4C059258, 0x7165BBE8, 0x36C5C138, 0x0BA5E888,
+            0x28D4C7DF, 0x15B4EE6F, 0x521494BF, 0x6F74BD0F, 0xDD54611F, 0xE03448AF, 0xA794327F, 0x9AF41BCF,
+            0x18A48C1E, 0x25C4A5AE, 0x6264DF7E, 0x5F04F6CE, 0xED242ADE, 0xD044036E, 0x97E479BE, 0xAA84500E,
+            0x4834505D, 0x755479ED, 0x32F4033D, 0x0F942A8D, 0xBDB4F69D, 0x80D4DF2D, 0xC774A5FD, 0xFA148C4D,
+            0x78441B9C, 0x4524322C, 0x028448FC, 0x3FE4614C, 0x8DC4BD5C, 0xB0A494EC, 0xF704EE3C, 0xCA64C78C
+        },
+        {
+            0x00000000, 0xCB5CD3A5, 0x4DC8A10B, 0x869472AE, 0x9B914216, 0x50CD91B3, 0xD659E31D, 0x1D0530B8,
+            0xEC53826D, 0x270F51C8, 0xA19B2366, 0x6AC7F0C3, 0x77C2C07B, 0xBC9E13DE, 0x3A0A6170, 0xF156B2D5,
+            0x03D6029B, 0xC88AD13E, 0x4E1EA390, 0x85427035, 0x9847408D, 0x531B9328, 0xD58FE186, 0x1ED33223,
+            0xEF8580F6, 0x24D95353, 0xA24D21FD, 0x6911F258, 0x7414C2E0, 0xBF481145, 0x39DC63EB, 0xF280B04E,
+            0x07AC0536, 0xCCF0D693, 0x4A64A43D, 0x81387798, 0x9C3D4720, 0x57619485, 0xD1F5E62B, 0x1AA9358E,
+            0xEBFF875B, 0x20A354FE, 0xA6372650, 0x6D6BF5F5, 0x706EC54D, 0xBB3216E8, 0x3DA66446, 0xF6FAB7E3,
+            0x047A07AD, 0xCF26D408, 0x49B2A6A6, 0x82EE7503, 0x9FEB45BB, 0x54B7961E, 0xD223E4B0, 0x197F3715,
+            0xE82985C0, 0x23755665, 0xA5E124CB, 0x6EBDF76E, 0x73B8C7D6, 0xB8E41473, 0x3E7066DD, 0xF52CB578,
+            0x0F580A6C, 0xC404D9C9, 0x4290AB67, 0x89CC78C2, 0x94C9487A, 0x5F959BDF, 0xD901E971, 0x125D3AD4,
+            0xE30B8801, 0x28575BA4, 0xAEC3290A, 0x659FFAAF, 0x789ACA17, 0xB3C619B2, 0x35526B1C, 0xFE0EB8B9,
+            0x0C8E08F7, 0xC7D2DB52, 0x4146A9FC, 0x8A1A7A59, 0x971F4AE1, 0x5C439944, 0xDAD7EBEA, 0x118B384F,
+            0xE0DD8A9A, 0x2B81593F, 0xAD152B91, 0x6649F834, 0x7B4CC88C, 0xB0101B29, 0x36846987, 0xFDD8BA22,
+            0x08F40F5A, 0xC3A8DCFF, 0x453CAE51, 0x8E607DF4, 0x93654D4C, 0x58399EE9, 0xDEADEC47, 0x15F13FE2,
+            0xE4A78D37, 0x2FFB5E92, 0xA96F2C3C, 0x6233FF99, 0x7F36CF21, 0xB46A1C84, 0x32FE6E2A, 0xF9A2BD8F,
+            0x0B220DC1, 0xC07EDE64, 0x46EAACCA, 0x8DB67F6F, 0x90B34FD7, 0x5BEF9C72, 0xDD7BEEDC, 0x16273D79,
+            0xE7718FAC, 0x2C2D5C09, 0xAAB92EA7, 0x61E5FD02, 0x7CE0CDBA, 0xB7BC1E1F, 0x31286CB1, 0xFA74BF14,
+            0x1EB014D8, 0xD5ECC77D, 0x5378B5D3, 0x98246676, 0x852156CE, 0x4E7D856B, 0xC8E9F7C5, 0x03B52460,
+            0xF2E396B5, 0x39BF4510, 0xBF2B37BE, 0x7477E41B, 0x6972D4A3, 0xA22E0706, 0x24BA75A8, 0xEFE6A60D,
+            0x1D661643, 0xD63AC5E6, 0x50AEB748, 0x9BF264ED, 0x86F75455, 0x4DAB87F0, 0xCB3FF55E, 0x006326FB,
+            0xF135942E, 0x3A69478B, 0xBCFD3525, 0x77A1E680, 0x6AA4D638, 0xA1F8059D, 0x276C7733, 0xEC30A496,
+            0x191C11EE, 0xD240C24B, 0x54D4B0E5, 0x9F886340, 0x828D53F8, 0x49D1805D, 0xCF45F2F3, 0x04192156,
+            0xF54F9383, 0x3E134026, 0xB8873288, 0x73DBE12D, 0x6EDED195, 0xA5820230, 0x2316709E, 0xE84AA33B,
+            0x1ACA1375, 0xD196C0D0, 0x5702B27E, 0x9C5E61DB, 0x815B5163, 0x4A0782C6, 0xCC93F068, 0x07CF23CD,
+            0xF6999118, 0x3DC542BD, 0xBB513013, 0x700DE3B6, 0x6D08D30E, 0xA65400AB, 0x20C07205, 0xEB9CA1A0,
+            0x11E81EB4, 0xDAB4CD11, 0x5C20BFBF, 0x977C6C1A, 0x8A795CA2, 0x41258F07, 0xC7B1FDA9, 0x0CED2E0C,
+            0xFDBB9CD9, 0x36E74F7C, 0xB0733DD2, 0x7B2FEE77, 0x662ADECF, 0xAD760D6A, 0x2BE27FC4, 0xE0BEAC61,
+            0x123E1C2F, 0xD962CF8A, 0x5FF6BD24, 0x94AA6E81, 0x89AF5E39, 0x42F38D9C, 0xC467FF32, 0x0F3B2C97,
+            0xFE6D9E42, 0x35314DE7, 0xB3A53F49, 0x78F9ECEC, 0x65FCDC54, 0xAEA00FF1, 0x28347D5F, 0xE368AEFA,
+            0x16441B82, 0xDD18C827, 0x5B8CBA89, 0x90D0692C, 0x8DD55994, 0x46898A31, 0xC01DF89F, 0x0B412B3A,
+            0xFA1799EF, 0x314B4A4A, 0xB7DF38E4, 0x7C83EB41, 0x6186DBF9, 0xAADA085C, 0x2C4E7AF2, 0xE712A957,
+            0x15921919, 0xDECECABC, 0x585AB812, 0x93066BB7, 0x8E035B0F, 0x455F88AA, 0xC3CBFA04, 0x089729A1,
+            0xF9C19B74, 0x329D48D1, 0xB4093A7F, 0x7F55E9DA, 0x6250D962, 0xA90C0AC7, 0x2F987869, 0xE4C4ABCC
+        },
+        {
+            0x00000000, 0xA6770BB4, 0x979F1129, 0x31E81A9D, 0xF44F2413, 0x52382FA7, 0x63D0353A, 0xC5A73E8E,
+            0x33EF4E67, 0x959845D3, 0xA4705F4E, 0x020754FA, 0xC7A06A74, 0x61D761C0, 0x503F7B5D, 0xF64870E9,
+            0x67DE9CCE, 0xC1A9977A, 0xF0418DE7, 0x56368653, 0x9391B8DD, 0x35E6B369, 0x040EA9F4, 0xA279A240,
+            0x5431D2A9, 0xF246D91D, 0xC3AEC380, 0x65D9C834, 0xA07EF6BA, 0x0609FD0E, 0x37E1E793, 0x9196EC27,
+            0xCFBD399C, 0x69CA3228, 0x582228B5, 0xFE552301, 0x3BF21D8F, 0x9D85163B, 0xAC6D0CA6, 0x0A1A0712,
+            0xFC5277FB, 0x5A257C4F, 0x6BCD66D2, 0xCDBA6D66, 0x081D53E8, 0xAE6A585C, 0x9F8242C1, 0x39F54975,
+            0xA863A552, 0x0E14AEE6, 0x3FFCB47B, 0x998BBFCF, 0x5C2C8141, 0xFA5B8AF5, 0xCBB39068, 0x6DC49BDC,
+            0x9B8CEB35, 0x3DFBE081, 0x0C13FA1C, 0xAA64F1A8, 0x6FC3CF26, 0xC9B4C492, 0xF85CDE0F, 0x5E2BD5BB,
+            0x440B7579, 0xE27C7ECD, 0xD3946450, 0x75E36FE4, 0xB044516A, 0x16335ADE, 0x27DB4043, 0x81AC4BF7,
+            0x77E43B1E, 0xD19330AA, 0xE07B2A37, 0x460C2183, 0x83AB1F0D, 0x25DC14B9, 0x14340E24, 0xB2430590,
+            0x23D5E9B7, 0x85A2E203, 0xB44AF89E, 0x123DF32A, 0xD79ACDA4, 0x71EDC610, 0x4005DC8D, 0xE672D739,
+            0x103AA7D0, 0xB64DAC64, 0x87A5B6F9, 0x21D2BD4D, 0xE47583C3, 0x42028877, 0x73EA92EA, 0xD59D995E,
+            0x8BB64CE5, 0x2DC14751, 0x1C295DCC, 0xBA5E5678, 0x7FF968F6, 0xD98E6342, 0xE86679DF, 0x4E11726B,
+            0xB8590282, 0x1E2E0936, 0x2FC613AB, 0x89B1181F, 0x4C162691, 0xEA612D25, 0xDB8937B8, 0x7DFE3C0C,
+            0xEC68D02B, 0x4A1FDB9F, 0x7BF7C102, 0xDD80CAB6, 0x1827F438, 0xBE50FF8C, 0x8FB8E511, 0x29CFEEA5,
+            0xDF879E4C, 0x79F095F8, 0x48188F65, 0xEE6F84D1, 0x2BC8BA5F, 0x8DBFB1EB, 0xBC57AB76, 0x1A20A0C2,
+            0x8816EAF2, 0x2E61E146, 0x1F89FBDB, 0xB9FEF06F, 0x7C59CEE1, 0xDA2EC555, 0xEBC6DFC8, 0x4DB1D47C,
+            0xBBF9A495, 0x1D8EAF21, 0x2C66B5BC, 0x8A11BE08, 0x4FB68086, 0xE9C18B32, 0xD82991AF, 0x7E5E9A1B,
+            0xEFC8763C, 0x49BF7D88, 0x78576715, 0xDE206CA1, 0x1B87522F, 0xBDF0599B, 0x8C184306, 0x2A6F48B2,
+            0xDC27385B, 0x7A5033EF, 0x4BB82972, 0xEDCF22C6, 0x28681C48, 0x8E1F17FC, 0xBFF70D61, 0x198006D5,
+            0x47ABD36E, 0xE1DCD8DA, 0xD034C247, 0x7643C9F3, 0xB3E4F77D, 0x1593FCC9, 0x247BE654, 0x820CEDE0,
+            0x74449D09, 0xD23396BD, 0xE3DB8C20, 0x45AC8794, 0x800BB91A, 0x267CB2AE, 0x1794A833, 0xB1E3A387,
+            0x20754FA0, 0x86024414, 0xB7EA5E89, 0x119D553D, 0xD43A6BB3, 0x724D6007, 0x43A57A9A, 0xE5D2712E,
+            0x139A01C7, 0xB5ED0A73, 0x840510EE, 0x22721B5A, 0xE7D525D4, 0x41A22E60, 0x704A34FD, 0xD63D3F49,
+            0xCC1D9F8B, 0x6A6A943F, 0x5B828EA2, 0xFDF58516, 0x3852BB98, 0x9E25B02C, 0xAFCDAAB1, 0x09BAA105,
+            0xFFF2D1EC, 0x5985DA58, 0x686DC0C5, 0xCE1ACB71, 0x0BBDF5FF, 0xADCAFE4B, 0x9C22E4D6, 0x3A55EF62,
+            0xABC30345, 0x0DB408F1, 0x3C5C126C, 0x9A2B19D8, 0x5F8C2756, 0xF9FB2CE2, 0xC813367F, 0x6E643DCB,
+            0x982C4D22, 0x3E5B4696, 0x0FB35C0B, 0xA9C457BF, 0x6C636931, 0xCA146285, 0xFBFC7818, 0x5D8B73AC,
+            0x03A0A617, 0xA5D7ADA3, 0x943FB73E, 0x3248BC8A, 0xF7EF8204, 0x519889B0, 0x6070932D, 0xC6079899,
+            0x304FE870, 0x9638E3C4, 0xA7D0F959, 0x01A7F2ED, 0xC400CC63, 0x6277C7D7, 0x539FDD4A, 0xF5E8D6FE,
+            0x647E3AD9, 0xC209316D, 0xF3E12BF0, 0x55962044, 0x90311ECA, 0x3646157E, 0x07AE0FE3, 0xA1D90457,
+            0x579174BE, 0xF1E67F0A, 0xC00E6597, 0x66796E23, 0xA3DE50AD, 0x05A95B19, 0x34414184, 0x92364A30
+        },
+        {
+            0x00000000, 0xCCAA009E, 0x4225077D, 0x8E8F07E3, 0x844A0EFA, 0x48E00E64, 0xC66F0987, 0x0AC50919,
+            0xD3E51BB5, 0x1F4F1B2B, 0x91C01CC8, 0x5D6A1C56, 0x57AF154F, 0x9B0515D1, 0x158A1232, 0xD92012AC,
+            0x7CBB312B, 0xB01131B5, 0x3E9E3656, 0xF23436C8, 0xF8F13FD1, 0x345B3F4F, 0xBAD438AC, 0x767E3832,
+            0xAF5E2A9E, 0x63F42A00, 0xED7B2DE3, 0x21D12D7D, 0x2B142464, 0xE7BE24FA, 0x69312319, 0xA59B2387,
+            0xF9766256, 0x35DC62C8, 0xBB53652B, 0x77F965B5, 0x7D3C6CAC, 0xB1966C32, 0x3F196BD1, 0xF3B36B4F,
+            0x2A9379E3, 0xE639797D, 0x68B67E9E, 0xA41C7E00, 0xAED97719, 0x62737787, 0xECFC7064, 0x205670FA,
+            0x85CD537D, 0x496753E3, 0xC7E85400, 0x0B42549E, 0x01875D87, 0xCD2D5D19, 0x43A25AFA, 0x8F085A64,
+            0x562848C8, 0x9A824856, 0x140D4FB5, 0xD8A74F2B, 0xD2624632, 0x1EC846AC, 0x9047414F, 0x5CED41D1,
+            0x299DC2ED, 0xE537C273, 0x6BB8C590, 0xA712C50E, 0xADD7CC17, 0x617DCC89, 0xEFF2CB6A, 0x2358CBF4,
+            0xFA78D958, 0x36D2D9C6, 0xB85DDE25, 0x74F7DEBB, 0x7E32D7A2, 0xB298D73C, 0x3C17D0DF, 0xF0BDD041,
+            0x5526F3C6, 0x998CF358, 0x1703F4BB, 0xDBA9F425, 0xD16CFD3C, 0x1DC6FDA2, 0x9349FA41, 0x5FE3FADF,
+            0x86C3E873, 0x4A69E8ED, 0xC4E6EF0E, 0x084CEF90, 0x0289E689, 0xCE23E617, 0x40ACE1F4, 0x8C06E16A,
+            0xD0EBA0BB, 0x1C41A025, 0x92CEA7C6, 0x5E64A758, 0x54A1AE41, 0x980BAEDF, 0x1684A93C, 0xDA2EA9A2,
+            0x030EBB0E, 0xCFA4BB90, 0x412BBC73, 0x8D81BCED, 0x8744B5F4, 0x4BEEB56A, 0xC561B289, 0x09CBB217,
+            0xAC509190, 0x60FA910E, 0xEE7596ED, 0x22DF9673, 0x281A9F6A, 0xE4B09FF4, 0x6A3F9817, 0xA6959889,
+            0x7FB58A25, 0xB31F8ABB, 0x3D908D58, 0xF13A8DC6, 0xFBFF84DF, 0x37558441, 0xB9DA83A2, 0x7570833C,
+            0x533B85DA, 0x9F918544, 0x111E82A7, 0xDDB48239, 0xD7718B20, 0x1BDB8BBE, 0x95548C5D, 0x59FE8CC3,
+            0x80DE9E6F, 0x4C749EF1, 0xC2FB9912, 0x0E51998C, 0x04949095, 0xC83E900B, 0x46B197E8, 0x8A1B9776,
+            0x2F80B4F1, 0xE32AB46F, 0x6DA5B38C, 0xA10FB312, 0xABCABA0B, 0x6760BA95, 0xE9EFBD76, 0x2545BDE8,
+            0xFC65AF44, 0x30CFAFDA, 0xBE40A839, 0x72EAA8A7, 0x782FA1BE, 0xB485A120, 0x3A0AA6C3, 0xF6A0A65D,
+            0xAA4DE78C, 0x66E7E712, 0xE868E0F1, 0x24C2E06F, 0x2E07E976, 0xE2ADE9E8, 0x6C22EE0B, 0xA088EE95,
+            0x79A8FC39, 0xB502FCA7, 0x3B8DFB44, 0xF727FBDA, 0xFDE2F2C3, 0x3148F25D, 0xBFC7F5BE, 0x736DF520,
+            0xD6F6D6A7, 0x1A5CD639, 0x94D3D1DA, 0x5879D144, 0x52BCD85D, 0x9E16D8C3, 0x1099DF20, 0xDC33DFBE,
+            0x0513CD12, 0xC9B9CD8C, 0x4736CA6F, 0x8B9CCAF1, 0x8159C3E8, 0x4DF3C376, 0xC37CC495, 0x0FD6C40B,
+            0x7AA64737, 0xB60C47A9, 0x3883404A, 0xF42940D4, 0xFEEC49CD, 0x32464953, 0xBCC94EB0, 0x70634E2E,
+            0xA9435C82, 0x65E95C1C, 0xEB665BFF, 0x27CC5B61, 0x2D095278, 0xE1A352E6, 0x6F2C5505, 0xA386559B,
+            0x061D761C, 0xCAB77682, 0x44387161, 0x889271FF, 0x825778E6, 0x4EFD7878, 0xC0727F9B, 0x0CD87F05,
+            0xD5F86DA9, 0x19526D37, 0x97DD6AD4, 0x5B776A4A, 0x51B26353, 0x9D1863CD, 0x1397642E, 0xDF3D64B0,
+            0x83D02561, 0x4F7A25FF, 0xC1F5221C, 0x0D5F2282, 0x079A2B9B, 0xCB302B05, 0x45BF2CE6, 0x89152C78,
+            0x50353ED4, 0x9C9F3E4A, 0x121039A9, 0xDEBA3937, 0xD47F302E, 0x18D530B0, 0x965A3753, 0x5AF037CD,
+            0xFF6B144A, 0x33C114D4, 0xBD4E1337, 0x71E413A9, 0x7B211AB0, 0xB78B1A2E, 0x39041DCD, 0xF5AE1D53,
+            0x2C8E0FFF, 0xE0240F61, 0x6EAB0882, 0xA201081C, 0xA8C40105, 0x646E019B, 0xEAE10678, 0x264B06E6
+        }
+    };
 
-            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_MOUSE_BUTTON_DOWN | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-            currentEventList->count++;
+#if defined(RCORE_CRC32_PCLMUL)
+    // Fold 4x128 bit blocks in parallel, reduce to 128 bit, fold remaining 128 bit blocks, Barrett reduce to 32 bit
+    // REF: Intel white paper: Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction
+    if (dataSize >= 64)
+    {
+        const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+        const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+        const __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+        const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+        const __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+
+        __m128i x1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + 0)), _mm_cvtsi32_si128((int)crc));
+        __m128i x2 = _mm_loadu_si128((const __m128i *)(data + 16));
+        __m128i x3 = _mm_loadu_si128((const __m128i *)(data + 32));
+        __m128i x4 = _mm_loadu_si128((const __m128i *)(data + 48));
+        data += 64;
+        dataSize -= 64;
+
+        while (dataSize >= 64)
+        {
+            x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k1k2, 0x11), _mm_clmulepi64_si128(x1, k1k2, 0x00)), _mm_loadu_si128((const __m128i *)(data + 0)));
+            x2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x2, k1k2, 0x11), _mm_clmulepi64_si128(x2, k1k2, 0x00)), _mm_loadu_si128((const __m128i *)(data + 16)));
+            x3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x3, k1k2, 0x11), _mm_clmulepi64_si128(x3, k1k2, 0x00)), _mm_loadu_si128((const __m128i *)(data + 32)));
+            x4 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x4, k1k2, 0x11), _mm_clmulepi64_si128(x4, k1k2, 0x00)), _mm_loadu_si128((const __m128i *)(data + 48)));
+            data += 64;
+            dataSize -= 64;
         }
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
-    }
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), _mm_clmulepi64_si128(x1, k3k4, 0x00)), x2);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), _mm_clmulepi64_si128(x1, k3k4, 0x00)), x3);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), _mm_clmulepi64_si128(x1, k3k4, 0x00)), x4);
 
-    // Event type: INPUT_MOUSE_POSITION (only saved if changed)
-    if (((int)CORE.Input.Mouse.currentPosition.x != (int)CORE.Input.Mouse.previousPosition.x) ||
-        ((int)CORE.Input.Mouse.currentPosition.y != (int)CORE.Input.Mouse.previousPosition.y))
-    {
-        currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-        currentEventList->events[currentEventList->count].type = INPUT_MOUSE_POSITION;
-        currentEventList->events[currentEventList->count].params[0] = (int)CORE.Input.Mouse.currentPosition.x;
-        currentEventList->events[currentEventList->count].params[1] = (int)CORE.Input.Mouse.currentPosition.y;
-        currentEventList->events[currentEventList->count].params[2] = 0;
+        while (dataSize >= 16)
+        {
+            x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), _mm_clmulepi64_si128(x1, k3k4, 0x00)), _mm_loadu_si128((const __m128i *)data));
+            data += 16;
+            dataSize -= 16;
+        }
+
+        // Fold 128 bit to 64 bit
+        x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+        x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+        x2 = _mm_srli_si128(x1, 4);
+        x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask), k5k0, 0x00), x2);
 
-        TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_MOUSE_POSITION | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-        currentEventList->count++;
+        // Barrett reduction to 32 bit
+        x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), poly, 0x10);
+        x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask), poly, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        crc = (unsigned int)_mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
     }
+#elif defined(RCORE_CRC32_ARM)
+    for (; dataSize >= 8; data += 8, dataSize -= 8) crc = __crc32d(crc, ReadU64LE(data));
+#endif
 
-    // Event type: INPUT_MOUSE_WHEEL_MOTION
-    if (((int)CORE.Input.Mouse.currentWheelMove.x != (int)CORE.Input.Mouse.previousWheelMove.x) ||
-        ((int)CORE.Input.Mouse.currentWheelMove.y != (int)CORE.Input.Mouse.previousWheelMove.y))
+    for (; dataSize >= 8; data += 8, dataSize -= 8)
     {
-        currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-        currentEventList->events[currentEventList->count].type = INPUT_MOUSE_WHEEL_MOTION;
-        currentEventList->events[currentEventList->count].params[0] = (int)CORE.Input.Mouse.currentWheelMove.x;
-        currentEventList->events[currentEventList->count].params[1] = (int)CORE.Input.Mouse.currentWheelMove.y;
-        currentEventList->events[currentEventList->count].params[2] = 0;
-
-        TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_MOUSE_WHEEL_MOTION | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-        currentEventList->count++;
+        unsigned int one = ReadU32LE(data) ^ crc;
+        unsigned int two = ReadU32LE(data + 4);
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        crc = crcTable[7][one & 0xff] ^ crcTable[6][(one >> 8) & 0xff] ^ crcTable[5][(one >> 16) & 0xff] ^ crcTable[4][one >> 24] ^
+              crcTable[3][two & 0xff] ^ crcTable[2][(two >> 8) & 0xff] ^ crcTable[1][(two >> 16) & 0xff] ^ crcTable[0][two >> 24];
     }
-    //-------------------------------------------------------------------------------------
 
-    // Touch input currentEventList->events recording
-    //-------------------------------------------------------------------------------------
-    for (int id = 0; id < MAX_TOUCH_POINTS; id++)
+    for (; dataSize > 0; data++, dataSize--) crc = (crc >> 8) ^ crcTable[0][(crc ^ *data) & 0xff];
+
+    return crc;
+}
+
+// XXH64 round, accumulate 64 bit input lane
+static inline unsigned long long XXH64Round(unsigned long long acc, unsigned long long input)
+{
+    acc += input*XXH64_PRIME2;
+    acc = XXH64_ROTATE_LEFT(acc, 31);
+    acc *= XXH64_PRIME1;
+
+    return acc;
+}
+
+// Process full hash blocks (MD5, SHA-1: 64 bytes, XXH64: 32 bytes)
+static void ProcessHashBlocks(HashState *state, const unsigned char *data, int blockCount)
+{
+    // MD5 per-round shift amounts
+    static const unsigned char r[64] = {
+        7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+        5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+        4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+        6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+    };
+
+    // MD5 constants, binary integer part of the sines of integers (in radians)
+    static const unsigned int k[64] = {
+        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
+        0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+        0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+        0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+        0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+        0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
+        0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
+        0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+        0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+    };
+
+    for (int block = 0; block < blockCount; block++)
     {
-        // Event type: INPUT_TOUCH_UP
-        if (CORE.Input.Touch.previousTouchState[id] && !CORE.Input.Touch.currentTouchState[id])
+        switch (state->type)
         {
-            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-            currentEventList->events[currentEventList->count].type = INPUT_TOUCH_UP;
-            currentEventList->events[currentEventList->count].params[0] = id;
-            currentEventList->events[currentEventList->count].params[1] = 0;
-            currentEventList->events[currentEventList->count].params[2] = 0;
+            case HASH_MD5:
+            {
+                const unsigned char *chunk = data + block*64;
+                unsigned int w[16] = { 0 };
+                for (int i = 0; i < 16; i++) w[i] = ReadU32LE(chunk + i*4);
+
+                unsigned int a = (unsigned int)state->state[0];
+                unsigned int b = (unsigned int)state->state[1];
+                unsigned int c = (unsigned int)state->state[2];
+                unsigned int d = (unsigned int)state->state[3];
+
+                #define MD5_STEP(f, g) { unsigned int temp = a + (f) + k[i] + w[g]; a = d; d = c; c = b; b = b + ROTATE_LEFT(temp, r[i]); }
+                for (int i = 0; i < 16; i++) MD5_STEP((b & c) | ((~b) & d), i);
+                for (int i = 16; i < 32; i++) MD5_STEP((d & b) | ((~d) & c), (5*i + 1)%16);
+                for (int i = 32; i < 48; i++) MD5_STEP(b ^ c ^ d, (3*i + 5)%16);
+                for (int i = 48; i < 64; i++) MD5_STEP(c ^ (b | (~d)), (7*i)%16);
+                #undef MD5_STEP
+
+                state->state[0] = (unsigned int)(state->state[0] + a);
+                state->state[1] = (unsigned int)(state->state[1] + b);
+                state->state[2] = (unsigned int)(state->state[2] + c);
+                state->state[3] = (unsigned int)(state->state[3] + d);
+            } break;
+            case HASH_SHA1:
+            {
+                const unsigned char *chunk = data + block*64;
+
+                // Message schedule: extend sixteen 32-bit big-endian words into eighty 32-bit words
+                unsigned int w[80] = { 0 };
+                for (int i = 0; i < 16; i++) w[i] = ((unsigned int)chunk[i*4] << 24) | ((unsigned int)chunk[i*4 + 1] << 16) | ((unsigned int)chunk[i*4 + 2] << 8) | chunk[i*4 + 3];
+                for (int i = 16; i < 80; i++) w[i] = ROTATE_LEFT(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+                unsigned int a = (unsigned int)state->state[0];
+                unsigned int b = (unsigned int)state->state[1];
+                unsigned int c = (unsigned int)state->state[2];
+                unsigned int d = (unsigned int)state->state[3];
+                unsigned int e = (unsigned int)state->state[4];
+
+                #define SHA1_STEP(f, k) { unsigned int temp = ROTATE_LEFT(a, 5) + (f) + e + (k) + w[i]; e = d; d = c; c = ROTATE_LEFT(b, 30); b = a; a = temp; }
+                for (int i = 0; i < 20; i++) SHA1_STEP((b & c) | ((~b) & d), 0x5A827999);
+                for (int i = 20; i < 40; i++) SHA1_STEP(b ^ c ^ d, 0x6ED9EBA1);
+                for (int i = 40; i < 60; i++) SHA1_STEP((b & c) | (b & d) | (c & d), 0x8F1BBCDC);
+                for (int i = 60; i < 80; i++) SHA1_STEP(b ^ c ^ d, 0xCA62C1D6);
+                #undef SHA1_STEP
+
+                state->state[0] = (unsigned int)(state->state[0] + a);
+                state->state[1] = (unsigned int)(state->state[1] + b);
+                state->state[2] = (unsigned int)(state->state[2] + c);
+                state->state[3] = (unsigned int)(state->state[3] + d);
+                state->state[4] = (unsigned int)(state->state[4] + e);
+            } break;
+            case HASH_XXH64:
+            {
+                const unsigned char *stripe = data + block*32;
 
-            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_TOUCH_UP | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-            currentEventList->count++;
+                for (int i = 0; i < 4; i++) state->state[i] = XXH64Round(state->state[i], ReadU64LE(stripe + i*8));
+            } break;
+            default: break;
         }
+    }
+}
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+#if defined(SUPPORT_COMPRESSION_API)
+// Compress data blocks job, every job compresses its interleaved share of blocks
+// NOTE: Every job uses its own compressor, reused for all its blocks
+static void CompressDataJob(void *data, int index)
+{
+    CompressionJobData *job = (CompressionJobData *)data;
+    Compressor compressor = LoadCompressor(COMPRESSION_QUALITY_DEFLATE);
 
-        // Event type: INPUT_TOUCH_DOWN
-        if (CORE.Input.Touch.currentTouchState[id])
-        {
-            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-            currentEventList->events[currentEventList->count].type = INPUT_TOUCH_DOWN;
-            currentEventList->events[currentEventList->count].params[0] = id;
-            currentEventList->events[currentEventList->count].params[1] = 0;
-            currentEventList->events[currentEventList->count].params[2] = 0;
+    for (int i = index; (compressor.state != NULL) && (i < job->blockCount); i += job->jobCount)
+    {
+        unsigned char *slot = job->output + COMPRESSION_HEADER_SIZE + i*job->slotSize;
+        int offset = i*COMPRESSION_BLOCK_SIZE;
+        unsigned int size = ((job->dataSize - offset) < COMPRESSION_BLOCK_SIZE)? (unsigned int)(job->dataSize - offset) : COMPRESSION_BLOCK_SIZE;
+        unsigned int compSize = (unsigned int)CompressDataTo(compressor, job->data + offset, (int)size, slot + COMPRESSION_BLOCK_HEADER_SIZE, (int)(job->slotSize - COMPRESSION_BLOCK_HEADER_SIZE));
+
+        memcpy(slot, &size, 4);
+        memcpy(slot + 4, &compSize, 4);
+        job->blockSizes[i] = (int)compSize;
+    }
 
-            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_TOUCH_DOWN | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-            currentEventList->count++;
-        }
+    UnloadCompressor(compressor);
+}
+
+// Decompress data block job
+static void DecompressDataJob(void *data, int index)
+{
+    DecompressionJobData *job = (DecompressionJobData *)data;
+    DecompressionBlock *block = &job->blocks[index];
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+    block->result = DecompressDataTo(block->compData, block->compDataSize, job->data + block->dataOffset, block->dataSize);
+}
+#endif
 
-        // Event type: INPUT_TOUCH_POSITION
-        // TODO: It requires the id!
-        /*
-        if (((int)CORE.Input.Touch.currentPosition[id].x != (int)CORE.Input.Touch.previousPosition[id].x) ||
-            ((int)CORE.Input.Touch.currentPosition[id].y != (int)CORE.Input.Touch.previousPosition[id].y))
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+// Record automation event, written when next event is recorded
+// NOTE: Input events are registered for the frame they are available on, consecutive
+// mouse position/wheel events on same frame are merged, only last state is recorded
+static void RecordAutomationEvent(int type, int param0, int param1, int param2)
+{
+    if (!automationEventRecording) return;
+
+    AutomationEvent *pending = &automationRecorder.pending;
+
+    if ((pending->type == (unsigned int)type) && (pending->frame == automationRecorder.frame) &&
+        ((type == INPUT_MOUSE_POSITION) || (type == INPUT_MOUSE_WHEEL_MOTION)))
+    {
+        pending->params[0] = param0;
+        pending->params[1] = param1;
+    }
+    else
+    {
+        if (pending->type != EVENT_NONE) WriteAutomationEvent(*pending);
+
+        pending->frame = automationRecorder.frame;
+        pending->type = type;
+        pending->params[0] = param0;
+        pending->params[1] = param1;
+        pending->params[2] = param2;
+        pending->params[3] = 0;
+    }
+}
+
+// Record frame input state changes as automation events
+// NOTE: Called at EndDrawing(), before PollInputEvents(), keyboard/mouse/gamepad/touch
+// input is recorded from platform input callbacks instead, if available
+static void RecordAutomationFrameEvents(void)
+{
+    automationRecorder.frame = CORE.Time.frameCounter;
+
+#if !defined(AUTOMATION_EVENTS_INPUT_CALLBACKS)
+    // Keyboard input events recording
+    //-------------------------------------------------------------------------------------
+    if (memcmp(CORE.Input.Keyboard.currentKeyState, CORE.Input.Keyboard.previousKeyState, MAX_KEYBOARD_KEYS) != 0)
+    {
+        for (int key = 0; key < MAX_KEYBOARD_KEYS; key++)
         {
-            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-            currentEventList->events[currentEventList->count].type = INPUT_TOUCH_POSITION;
-            currentEventList->events[currentEventList->count].params[0] = id;
-            currentEventList->events[currentEventList->count].params[1] = (int)CORE.Input.Touch.currentPosition[id].x;
-            currentEventList->events[currentEventList->count].params[2] = (int)CORE.Input.Touch.currentPosition[id].y;
+            // Event type: INPUT_KEY_UP, INPUT_KEY_DOWN (only saved on change)
+            if (CORE.Input.Keyboard.currentKeyState[key] != CORE.Input.Keyboard.previousKeyState[key])
+            {
+                RecordAutomationEvent(CORE.Input.Keyboard.currentKeyState[key]? INPUT_KEY_DOWN : INPUT_KEY_UP, key, 0, 0);
+            }
+        }
+    }
+    //-------------------------------------------------------------------------------------
 
-            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_TOUCH_POSITION | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-            currentEventList->count++;
+    // Mouse input events recording
+    //-------------------------------------------------------------------------------------
+    for (int button = 0; button < MAX_MOUSE_BUTTONS; button++)
+    {
+        // Event type: INPUT_MOUSE_BUTTON_UP, INPUT_MOUSE_BUTTON_DOWN (only saved on change)
+        if (CORE.Input.Mouse.currentButtonState[button] != CORE.Input.Mouse.previousButtonState[button])
+        {
+            RecordAutomationEvent(CORE.Input.Mouse.currentButtonState[button]? INPUT_MOUSE_BUTTON_DOWN : INPUT_MOUSE_BUTTON_UP, button, 0, 0);
         }
-        */
+    }
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+    // Event type: INPUT_MOUSE_POSITION (only saved on change)
+    if (((int)CORE.Input.Mouse.currentPosition.x != (int)CORE.Input.Mouse.previousPosition.x) ||
+        ((int)CORE.Input.Mouse.currentPosition.y != (int)CORE.Input.Mouse.previousPosition.y))
+    {
+        RecordAutomationEvent(INPUT_MOUSE_POSITION, (int)CORE.Input.Mouse.currentPosition.x, (int)CORE.Input.Mouse.currentPosition.y, 0);
+    }
+
+    // Event type: INPUT_MOUSE_WHEEL_MOTION (only saved on wheel move)
+    if (((int)CORE.Input.Mouse.currentWheelMove.x != 0) || ((int)CORE.Input.Mouse.currentWheelMove.y != 0))
+    {
+        RecordAutomationEvent(INPUT_MOUSE_WHEEL_MOTION, (int)CORE.Input.Mouse.currentWheelMove.x, (int)CORE.Input.Mouse.currentWheelMove.y, 0);
     }
     //-------------------------------------------------------------------------------------
 
-    // Gamepad input currentEventList->events recording
+    // Touch input events recording
     //-------------------------------------------------------------------------------------
-    for (int gamepad = 0; gamepad < MAX_GAMEPADS; gamepad++)
+    for (int id = 0; id < MAX_TOUCH_POINTS; id++)
     {
-        // Event type: INPUT_GAMEPAD_CONNECT
-        /*
-        if ((CORE.Input.Gamepad.currentState[gamepad] != CORE.Input.Gamepad.previousState[gamepad]) &&
-            (CORE.Input.Gamepad.currentState[gamepad])) // Check if changed to ready
+        // Event type: INPUT_TOUCH_UP, INPUT_TOUCH_DOWN (only saved on change)
+        if (CORE.Input.Touch.currentTouchState[id] != CORE.Input.Touch.previousTouchState[id])
         {
-            // TODO: Save gamepad connect event
+            RecordAutomationEvent(CORE.Input.Touch.currentTouchState[id]? INPUT_TOUCH_DOWN : INPUT_TOUCH_UP, id, 0, 0);
         }
-        */
 
-        // Event type: INPUT_GAMEPAD_DISCONNECT
-        /*
-        if ((CORE.Input.Gamepad.currentState[gamepad] != CORE.Input.Gamepad.previousState[gamepad]) &&
-            (!CORE.Input.Gamepad.currentState[gamepad])) // Check if changed to not-ready
+        // Event type: INPUT_TOUCH_POSITION (only saved on change)
+        if (((int)CORE.Input.Touch.position[id].x != (int)automationRecorder.touchPosition[id].x) ||
+            ((int)CORE.Input.Touch.position[id].y != (int)automationRecorder.touchPosition[id].y))
         {
-            // TODO: Save gamepad disconnect event
+            RecordAutomationEvent(INPUT_TOUCH_POSITION, id, (int)CORE.Input.Touch.position[id].x, (int)CORE.Input.Touch.position[id].y);
+            automationRecorder.touchPosition[id] = CORE.Input.Touch.position[id];
         }
-        */
+    }
+    //-------------------------------------------------------------------------------------
 
+    // Gamepad input events recording
+    //-------------------------------------------------------------------------------------
+    for (int gamepad = 0; gamepad < MAX_GAMEPADS; gamepad++)
+    {
         for (int button = 0; button < MAX_GAMEPAD_BUTTONS; button++)
         {
-            // Event type: INPUT_GAMEPAD_BUTTON_UP
-            if (CORE.Input.Gamepad.previousButtonState[gamepad][button] && !CORE.Input.Gamepad.currentButtonState[gamepad][button])
+            // Event type: INPUT_GAMEPAD_BUTTON_UP, INPUT_GAMEPAD_BUTTON_DOWN (only saved on change)
+            if (CORE.Input.Gamepad.currentButtonState[gamepad][button] != CORE.Input.Gamepad.previousButtonState[gamepad][button])
             {
-                currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-                currentEventList->events[currentEventList->count].type = INPUT_GAMEPAD_BUTTON_UP;
-                currentEventList->events[currentEventList->count].params[0] = gamepad;
-                currentEventList->events[currentEventList->count].params[1] = button;
-                currentEventList->events[currentEventList->count].params[2] = 0;
-
-                TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_GAMEPAD_BUTTON_UP | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-                currentEventList->count++;
+                RecordAutomationEvent(CORE.Input.Gamepad.currentButtonState[gamepad][button]? INPUT_GAMEPAD_BUTTON_DOWN : INPUT_GAMEPAD_BUTTON_UP, gamepad, button, 0);
             }
+        }
 
-            if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        for (int axis = 0; axis < MAX_GAMEPAD_AXIS; axis++)
+        {
+            // Event type: INPUT_GAMEPAD_AXIS_MOTION (only saved on change)
+            int value = (int)(CORE.Input.Gamepad.axisState[gamepad][axis]*32768.0f);
 
-            // Event type: INPUT_GAMEPAD_BUTTON_DOWN
-            if (CORE.Input.Gamepad.currentButtonState[gamepad][button])
+            if (value != automationRecorder.gamepadAxis[gamepad][axis])
             {
-                currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-                currentEventList->events[currentEventList->count].type = INPUT_GAMEPAD_BUTTON_DOWN;
-                currentEventList->events[currentEventList->count].params[0] = gamepad;
-                currentEventList->events[currentEventList->count].params[1] = button;
-                currentEventList->events[currentEventList->count].params[2] = 0;
-
-                TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_GAMEPAD_BUTTON_DOWN | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-                currentEventList->count++;
+                RecordAutomationEvent(INPUT_GAMEPAD_AXIS_MOTION, gamepad, axis, value);
+                automationRecorder.gamepadAxis[gamepad][axis] = value;
             }
+        }
+    }
+    //-------------------------------------------------------------------------------------
+#endif
 
-            if (currentEventList->count == currentEventList->capacity) return;    // Security check
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    // Gestures input events recording
+    //-------------------------------------------------------------------------------------
+    // Event type: INPUT_GESTURE (only saved on change)
+    if (GESTURES.current != automationRecorder.gesture)
+    {
+        RecordAutomationEvent(INPUT_GESTURE, GESTURES.current, 0, 0);
+        automationRecorder.gesture = GESTURES.current;
+    }
+    //-------------------------------------------------------------------------------------
+#endif
+
+    // Pending event and stream buffered data written to file every frame, recorded events are kept on a crash
+    // NOTE: Input events received from now on are registered for next frame, pending event can not be merged anymore
+    if (automationRecorder.pending.type != EVENT_NONE) WriteAutomationEvent(automationRecorder.pending);
+    automationRecorder.pending.type = EVENT_NONE;
+
+    if ((automationRecorder.stream.file != NULL) && (automationRecorder.stream.size > 0))
+    {
+        FlushAutomationEventStream(&automationRecorder.stream);
+        fflush(automationRecorder.stream.file);
+    }
+}
+
+// Write automation event to events list and events stream
+static void WriteAutomationEvent(AutomationEvent event)
+{
+    if (currentEventList != NULL) AddAutomationEvent(currentEventList, event);
+
+    rAutomationStream *stream = &automationRecorder.stream;
+
+    if (stream->file != NULL)
+    {
+        // Buffered data written to file when buffer is full
+        if ((stream->size + AUTOMATION_EVENT_MAX_SIZE) > AUTOMATION_STREAM_BUFFER_SIZE) FlushAutomationEventStream(stream);
+
+        stream->size += EncodeAutomationEvent(&stream->codec, event, stream->data + stream->size);
+    }
+
+    TRACELOGD("AUTOMATION: Frame: %i | Event type: %s | Event parameters: %i, %i, %i", event.frame, autoEventTypeName[event.type], event.params[0], event.params[1], event.params[2]);
+}
+
+// Write automation events stream buffered data to file
+static bool FlushAutomationEventStream(rAutomationStream *stream)
+{
+    bool success = true;
+
+    if (stream->size > 0)
+    {
+        if (fwrite(stream->data, 1, stream->size, stream->file) != (size_t)stream->size)
+        {
+            TRACELOG(LOG_WARNING, "AUTOMATION: Failed to write events stream data, events lost");
+            success = false;
         }
 
-        for (int axis = 0; axis < MAX_GAMEPAD_AXIS; axis++)
+        stream->size = 0;
+    }
+
+    return success;
+}
+
+// Read next automation event from stream, stream data buffer refilled from file as required
+static bool ReadAutomationEventStream(rAutomationStream *stream, AutomationEvent *event)
+{
+    int result = 0;
+
+    while (result == 0)
+    {
+        result = DecodeAutomationEvent(&stream->codec, stream->data + stream->offset, stream->size - stream->offset, event);
+
+        if (result == 0)
         {
-            // Event type: INPUT_GAMEPAD_AXIS_MOTION
-            float defaultMovement = (axis == GAMEPAD_AXIS_LEFT_TRIGGER || axis == GAMEPAD_AXIS_RIGHT_TRIGGER)? -1.0f : 0.0f;
-            if (GetGamepadAxisMovement(gamepad, axis) != defaultMovement)
+            if (stream->ended)
             {
-                currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-                currentEventList->events[currentEventList->count].type = INPUT_GAMEPAD_AXIS_MOTION;
-                currentEventList->events[currentEventList->count].params[0] = gamepad;
-                currentEventList->events[currentEventList->count].params[1] = axis;
-                currentEventList->events[currentEventList->count].params[2] = (int)(CORE.Input.Gamepad.axisState[gamepad][axis]*32768.0f);
-
-                TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_GAMEPAD_AXIS_MOTION | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-                currentEventList->count++;
+                if (stream->offset < stream->size) TRACELOG(LOG_WARNING, "AUTOMATION: Events stream data truncated, last event not available");
+                break;
             }
 
-            if (currentEventList->count == currentEventList->capacity) return;    // Security check
+            // Move remaining data to buffer start and refill buffer from file
+            int remaining = stream->size - stream->offset;
+            memmove(stream->data, stream->data + stream->offset, remaining);
+
+            stream->size = remaining + (int)fread(stream->data + remaining, 1, AUTOMATION_STREAM_BUFFER_SIZE - remaining, stream->file);
+            stream->offset = 0;
+
+            if (stream->size < AUTOMATION_STREAM_BUFFER_SIZE) stream->ended = true;
         }
+        else if (result < 0) TRACELOG(LOG_WARNING, "AUTOMATION: Events stream data not valid, stream finished");
+        else stream->offset += result;
     }
-    //-------------------------------------------------------------------------------------
 
-#if defined(SUPPORT_GESTURES_SYSTEM)
-    // Gestures input currentEventList->events recording
-    //-------------------------------------------------------------------------------------
-    if (GESTURES.current != GESTURE_NONE)
+    return (result > 0);
+}
+
+// Encode automation event (binary format), returns bytes written (AUTOMATION_EVENT_MAX_SIZE max)
+// NOTE: EVENT_NONE events are not stored, they are reserved for absolute frame records
+static int EncodeAutomationEvent(AutomationEventCodec *codec, AutomationEvent event, unsigned char *data)
+{
+    int size = 0;
+
+    if ((event.type == EVENT_NONE) || (event.type >= AUTOMATION_EVENT_TYPE_COUNT)) return 0;
+
+    // Frame going backwards (i.e. base frame changed), absolute frame record required
+    if (event.frame < codec->frame)
     {
-        // Event type: INPUT_GESTURE
-        currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-        currentEventList->events[currentEventList->count].type = INPUT_GESTURE;
-        currentEventList->events[currentEventList->count].params[0] = GESTURES.current;
-        currentEventList->events[currentEventList->count].params[1] = 0;
-        currentEventList->events[currentEventList->count].params[2] = 0;
+        data[size] = EVENT_NONE;
+        size++;
+        size += WriteVarint(data + size, event.frame);
+        codec->frame = event.frame;
+    }
+
+    // Event type and frame delta, frame deltas over 6 frames stored as varint
+    unsigned int frameDelta = event.frame - codec->frame;
 
-        TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_GESTURE | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-        currentEventList->count++;
+    data[size] = (unsigned char)(event.type | (((frameDelta < 7)? frameDelta : 7) << 5));
+    size++;
+    if (frameDelta >= 7) size += WriteVarint(data + size, frameDelta - 7);
+
+    codec->frame = event.frame;
+
+    // Event parameters, stored as zig-zag encoded deltas to previous event of same type
+    for (int i = 0; i < autoEventParamCount[event.type]; i++)
+    {
+        unsigned int delta = (unsigned int)event.params[i] - (unsigned int)codec->params[event.type][i];
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        size += WriteVarint(data + size, (delta << 1) ^ (0u - (delta >> 31)));
+        codec->params[event.type][i] = event.params[i];
+    }
+
+    return size;
+}
+
+// Decode automation event (binary format), returns bytes read, 0 if data is incomplete, -1 if data is not valid
+// NOTE: Codec state is only updated when a complete event is decoded
+static int DecodeAutomationEvent(AutomationEventCodec *codec, const unsigned char *data, int dataSize, AutomationEvent *event)
+{
+    AutomationEvent decoded = { 0 };
+    unsigned int frame = codec->frame;
+    unsigned int value = 0;
+    int size = 0;
+    int result = 0;
+
+    // Absolute frame record
+    if ((dataSize > 0) && (data[0] == EVENT_NONE))
+    {
+        result = ReadVarint(data + 1, dataSize - 1, &frame);
+        if (result <= 0) return result;
+        size = 1 + result;
+    }
+
+    if (size >= dataSize) return 0;
+
+    // Event type and frame delta
+    unsigned int type = data[size] & 0x1f;
+    unsigned int frameDelta = data[size] >> 5;
+    size++;
+
+    if ((type == EVENT_NONE) || (type >= AUTOMATION_EVENT_TYPE_COUNT)) return -1;
+
+    if (frameDelta == 7)
+    {
+        result = ReadVarint(data + size, dataSize - size, &value);
+        if (result <= 0) return result;
+        frameDelta += value;
+        size += result;
+    }
+
+    decoded.frame = frame + frameDelta;
+    decoded.type = type;
+
+    // Event parameters
+    for (int i = 0; i < autoEventParamCount[type]; i++)
+    {
+        result = ReadVarint(data + size, dataSize - size, &value);
+        if (result <= 0) return result;
+        size += result;
+
+        decoded.params[i] = (int)((unsigned int)codec->params[type][i] + ((value >> 1) ^ (0u - (value & 1))));
+    }
+
+    codec->frame = decoded.frame;
+    for (int i = 0; i < autoEventParamCount[type]; i++) codec->params[type][i] = decoded.params[i];
+
+    *event = decoded;
+
+    return size;
+}
+
+// Add event to automation events list, capacity grows as required
+static bool AddAutomationEvent(AutomationEventList *list, AutomationEvent event)
+{
+    if (list->count == list->capacity)
+    {
+        unsigned int capacity = (list->capacity > 0)? list->capacity*2 : MAX_AUTOMATION_EVENTS;
+        AutomationEvent *events = (AutomationEvent *)RL_REALLOC(list->events, capacity*sizeof(AutomationEvent));
+
+        if (events == NULL)
+        {
+            TRACELOG(LOG_WARNING, "AUTOMATION: Failed to grow events list, event not added");
+            return false;
+        }
+
+        list->events = events;
+        list->capacity = capacity;
+    }
+
+    list->events[list->count] = event;
+    list->count++;
+
+    return true;
+}
+
+// Write LEB128 variable length value, returns bytes written (5 bytes max)
+static int WriteVarint(unsigned char *data, unsigned int value)
+{
+    int size = 0;
+
+    while (value >= 0x80)
+    {
+        data[size] = (unsigned char)((value & 0x7f) | 0x80);
+        value >>= 7;
+        size++;
+    }
+
+    data[size] = (unsigned char)value;
+
+    return size + 1;
+}
+
+// Read LEB128 variable length value, returns bytes read, 0 if data is incomplete, -1 if data is not valid
+static int ReadVarint(const unsigned char *data, int dataSize, unsigned int *value)
+{
+    unsigned int result = 0;
+
+    for (int i = 0; i < 5; i++)
+    {
+        if (i >= dataSize) return 0;
+
+        result |= (unsigned int)(data[i] & 0x7f) << (7*i);
+
+        if ((data[i] & 0x80) == 0)
+        {
+            *value = result;
+            return i + 1;
+        }
+    }
+
+    return -1;
+}
+#endif
+
+#if defined(SUPPORT_GIF_RECORDING)
+// Record current screen frame, if recording frame is due
+// NOTE: Called at EndDrawing(), before buffers swap
+static void RecordScreenFrame(void)
+{
+    ScreenRecorder *rec = &recorder;
+
+    // Finished readbacks are queued for encoding, before requesting a new one
+    ProcessRecordingReadbacks(false);
+
+    Vector2 scale = GetWindowScaleDPI();
+    if ((rec->width != (int)((float)CORE.Window.render.width*scale.x)) || (rec->height != (int)((float)CORE.Window.render.height*scale.y)))
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Screen size changed, screen recording stopped");
+        StopScreenRecording();
+        return;
+    }
+
+    double time = GetTime();
+    if (time < rec->nextTime) return;
+
+    // Next frame time is kept on the recording rate grid, unless recording falls behind
+    rec->nextTime += rec->interval;
+    if (rec->nextTime < time) rec->nextTime = time;
+
+    // GIF frame delay in centiseconds, rounding error carried to next frames
+    double delay = (time - rec->prevTime)*100.0 + rec->delayError;
+    int delayCs = (int)(delay + 0.5);
+    if (delayCs < 2) delayCs = 2;       // Minimum delay supported by GIF viewers
+    rec->delayError = delay - delayCs;
+    rec->prevTime = time;
+
+    if (rec->pixelBuffers[0] != 0)
+    {
+        int index = (rec->readbackHead + rec->readbackCount)%RECORDING_READBACK_BUFFERS;
+
+        rlReadScreenPixelsAsync(rec->pixelBuffers[index], rec->width, rec->height);
+        rec->readbackFrames[index] = CORE.Time.frameCounter;
+        rec->readbackDelays[index] = delayCs;
+        rec->readbackCount++;
+
+        // All pixel buffers in use, oldest readback is retrieved now (could wait for GPU)
+        if (rec->readbackCount == RECORDING_READBACK_BUFFERS)
+        {
+            QueueRecordingFrame(rec->pixelBuffers[rec->readbackHead], rec->readbackDelays[rec->readbackHead]);
+            rec->readbackHead = (rec->readbackHead + 1)%RECORDING_READBACK_BUFFERS;
+            rec->readbackCount--;
+        }
+    }
+    else QueueRecordingFrame(0, delayCs);
+}
+
+// Retrieve finished screen readbacks and queue frames for encoding
+// NOTE: Readbacks are retrieved RECORDING_READBACK_BUFFERS - 1 frames after request, GPU is usually done by then
+static void ProcessRecordingReadbacks(bool waitAll)
+{
+    ScreenRecorder *rec = &recorder;
+
+    while ((rec->readbackCount > 0) &&
+           (waitAll || ((CORE.Time.frameCounter - rec->readbackFrames[rec->readbackHead]) >= (RECORDING_READBACK_BUFFERS - 1))))
+    {
+        QueueRecordingFrame(rec->pixelBuffers[rec->readbackHead], rec->readbackDelays[rec->readbackHead]);
+        rec->readbackHead = (rec->readbackHead + 1)%RECORDING_READBACK_BUFFERS;
+        rec->readbackCount--;
+    }
+}
+
+// Queue screen frame for encoding, read from pixel buffer (or screen if pixel buffer is 0)
+// NOTE: Frame is dropped if encoding queue is full, render thread never waits for the encoder,
+// dropped frames delay is added to next queued frame, so GIF playback keeps capture timing
+static void QueueRecordingFrame(unsigned int pixelBuffer, int delay)
+{
+    ScreenRecorder *rec = &recorder;
+
+    if (GetBackgroundJobCount(rec->worker) >= MAX_RECORDING_QUEUE_FRAMES)
+    {
+        rec->droppedCount++;
+        rec->droppedDelay += delay;
+        return;
+    }
+
+    // Frames are encoded in order, oldest queue slot is free when queue is not full
+    RecordingFrame *frame = &rec->frames[rec->frameCount%MAX_RECORDING_QUEUE_FRAMES];
+    frame->index = rec->frameCount;
+    frame->delay = delay + rec->droppedDelay;
+
+    bool success = false;
+
+    if (pixelBuffer != 0) success = rlGetPixelBufferData(pixelBuffer, rec->width, rec->height, frame->data);
+    else
+    {
+        unsigned char *screenData = rlReadScreenPixels(rec->width, rec->height);
+
+        if (screenData != NULL)
+        {
+            memcpy(frame->data, screenData, (size_t)rec->width*rec->height*4);
+            RL_FREE(screenData);
+            success = true;
+        }
+    }
+
+    if (success && PushBackgroundJob(rec->worker, EncodeRecordingFrame, frame))
+    {
+        rec->frameCount++;
+        rec->droppedDelay = 0;
+    }
+    else
+    {
+        rec->droppedCount++;
+        rec->droppedDelay += delay;
+    }
+}
+
+// Encode recorded frame (background job)
+// WARNING: Running on recorder background thread, only frame data and encoder state can be accessed
+static void EncodeRecordingFrame(void *data)
+{
+    RecordingFrame *frame = (RecordingFrame *)data;
+    ScreenRecorder *rec = &recorder;
+    int pixelCount = rec->width*rec->height;
+
+    if (rec->format == RECORDING_FORMAT_GIF)
+    {
+        msf_gif_frame(&rec->gifState, frame->data, frame->delay, GIF_RECORD_BITRATE, rec->width*4);
+        return;
+    }
+
+    // Set alpha component value to 255 (no trasparent image retrieval)
+    // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+    for (int i = 0; i < pixelCount; i++) frame->data[i*4 + 3] = 255;
+
+    if (rec->format == RECORDING_FORMAT_RAW)
+    {
+        if (fwrite(frame->data, 4, pixelCount, rec->rawFile) != (size_t)pixelCount) TRACELOG(LOG_WARNING, "SYSTEM: Failed to write recorded frame %u", frame->index);
+    }
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_FILEFORMAT_QOI)
+    else if (rec->format == RECORDING_FORMAT_QOI)
+    {
+        // NOTE: Frame file written directly, TextFormat() and file callbacks are not thread-safe
+        char path[MAX_FILEPATH_LENGTH + 16] = { 0 };
+        int pathLength = snprintf(path, sizeof(path), "%s_%05u.qoi", rec->fileName, frame->index);
+
+        if ((pathLength < 0) || (pathLength >= (int)sizeof(path)))
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: Recorded frame %u file path too long, frame skipped", frame->index);
+            return;
+        }
+
+        qoi_desc desc = { (unsigned int)rec->width, (unsigned int)rec->height, 4, QOI_SRGB };
+        int qoiSize = 0;
+        void *qoiData = qoi_encode(frame->data, &desc, &qoiSize);   // WARNING: Module required: rtextures
+
+        FILE *file = (qoiData != NULL)? fopen(path, "wb") : NULL;
+        bool success = (file != NULL) && (fwrite(qoiData, 1, qoiSize, file) == (size_t)qoiSize);
+        if (file != NULL) success = (fclose(file) == 0) && success;
+
+        if (!success) TRACELOG(LOG_WARNING, "SYSTEM: [%s] Failed to write recorded frame", path);
+        RL_FREE(qoiData);
     }
-    //-------------------------------------------------------------------------------------
 #endif
 }
+#endif  // SUPPORT_GIF_RECORDING
+
+#if defined(SUPPORT_PROFILER)
+// Register frame profile and zones, reset render statistics for next frame
+// NOTE: Called at EndDrawing(), after buffers swap and frame time control
+static void EndProfileFrame(void)
+{
+    // Zones left open are closed at frame end
+    if (profiler.depth > 0)
+    {
+        TRACELOGD("PROFILER: %i profile zones not closed at frame end", profiler.depth);
+        while (profiler.depth > 0) EndProfileZone();
+    }
+
+    double time = GetTime();
+    rlRenderStats stats = rlGetRenderStats();
+
+    FrameProfile *frame = &profiler.frame;
+    frame->updateTime = (float)CORE.Time.update;
+    frame->drawTime = (float)CORE.Time.draw;
+    frame->gpuTime = profiler.gpuProfiling? (float)stats.gpuTime : -1.0f;
+    frame->gpuTimerCount = stats.gpuTimerCount;
+    frame->gpuTimerSkipped = stats.gpuTimerSkipped;
+    frame->drawCalls = stats.drawCalls;
+    frame->vertexCount = stats.vertexCount;
+    frame->batchFlushes = stats.batchFlushes;
+    frame->batchOverflows = stats.batchOverflows;
+    frame->textureBinds = stats.textureBinds;
+    frame->shaderChanges = stats.shaderChanges;
+    frame->stateChanges = stats.stateChanges;
+    frame->uploadedBytes = (unsigned int)stats.uploadedBytes;
+
+    rlResetRenderStats();
+
+    int current = profiler.current;
+
+    if (profiler.trace != NULL)
+    {
+        ProfileTraceFrame *traceFrame = &profiler.trace[profiler.traceCount%MAX_PROFILE_TRACE_FRAMES];
+
+        traceFrame->start = profiler.frameStart;
+        traceFrame->end = time;
+        traceFrame->profile = *frame;
+        traceFrame->zoneCount = profiler.zoneCount[current];
+        memcpy(traceFrame->zones, profiler.zones[current], profiler.zoneCount[current]*sizeof(ProfileZone));
+
+        profiler.traceCount++;
+    }
+
+    // Current frame zones become last frame zones, next frame registers zones on the other buffer
+    profiler.current = 1 - current;
+    profiler.zoneCount[profiler.current] = 0;
+    profiler.frameStart = time;
+}
+
+// Append formatted text to trace buffer, buffer grows as required
+// NOTE: Returns false if buffer could not grow, text is not appended
+static bool AppendProfileTrace(char **buffer, size_t *bufferSize, size_t *offset, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(*buffer + *offset, *bufferSize - *offset, format, args);
+    va_end(args);
+
+    if (length < 0) return false;
+
+    if ((*offset + length) >= *bufferSize)
+    {
+        // Buffer size estimation exceeded, buffer grows and text is formatted again
+        size_t size = ((*bufferSize*2) > (*offset + length + 1))? (*bufferSize*2) : (*offset + length + 1);
+        char *data = (char *)RL_REALLOC(*buffer, size);
+
+        if (data == NULL)
+        {
+            TRACELOG(LOG_WARNING, "PROFILER: Failed to grow profile trace buffer");
+            return false;
+        }
+
+        *buffer = data;
+        *bufferSize = size;
+
+        va_start(args, format);
+        vsnprintf(*buffer + *offset, *bufferSize - *offset, format, args);
+        va_end(args);
+    }
+
+    *offset += length;
+
+    return true;
+}
 #endif
 
 #if !defined(SUPPORT_MODULE_RTEXT)
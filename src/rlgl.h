@@ -58,6 +58,8 @@
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
 *       #define RL_CULL_DISTANCE_NEAR              0.01    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             1000.0    // Default projection matrix far cull distance
+*       #define RL_MAX_GPU_TIMER_QUERIES            256    // Maximum number of GPU timer queries in flight
+*       #define RL_MAX_GPU_TIMER_FRAMES              16    // Maximum number of frames with GPU timer results pending
 *
 *       When loading a shader, the following vertex attributes and uniform
 *       location names are tried to be set automatically:
@@ -240,6 +242,14 @@
     #define RL_CULL_DISTANCE_FAR                1000.0      // Default far cull distance
 #endif
 
+// GPU timer queries
+#ifndef RL_MAX_GPU_TIMER_QUERIES
+    #define RL_MAX_GPU_TIMER_QUERIES               256      // Maximum number of GPU timer queries in flight
+#endif
+#ifndef RL_MAX_GPU_TIMER_FRAMES
+    #define RL_MAX_GPU_TIMER_FRAMES                 16      // Maximum number of frames with GPU timer results pending
+#endif
+
 // Texture parameters (equivalent to OpenGL defines)
 #define RL_TEXTURE_WRAP_S                       0x2802      // GL_TEXTURE_WRAP_S
 #define RL_TEXTURE_WRAP_T                       0x2803      // GL_TEXTURE_WRAP_T
@@ -432,6 +442,21 @@ typedef enum {
     RL_OPENGL_ES_30             // OpenGL ES 3.0 (GLSL 300 es)
 } rlGlVersion;
 
+// Render statistics, accumulated until rlResetRenderStats()
+typedef struct rlRenderStats {
+    int drawCalls;                  // Number of draw calls issued (batch draws + vertex array draws)
+    int vertexCount;                // Number of vertex drawn
+    int batchFlushes;               // Number of render batch draws with vertex data
+    int batchOverflows;             // Number of render batch draws forced by rlCheckRenderBatchLimit()
+    int textureBinds;               // Number of texture binds
+    int shaderChanges;              // Number of shader program binds
+    int stateChanges;               // Number of render state changes (blending, depth, culling, scissor, framebuffer)
+    unsigned long long uploadedBytes; // Number of bytes uploaded to GPU (vertex buffers and textures)
+    double gpuTime;                 // GPU time of latest stats frame with all timer results available (seconds)
+    int gpuTimerCount;              // Number of GPU timer scopes measured in gpuTime frame
+    int gpuTimerSkipped;            // Number of GPU timer scopes not measured in gpuTime frame (queries ring full)
+} rlRenderStats;
+
 // Trace log level
 // NOTE: Organized by priority level
 typedef enum {
@@ -715,6 +740,7 @@ RLAPI int rlGetFramebufferHeight(void);                 // Get default framebuff
 RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture id
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
 RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader locations
+RLAPI unsigned int rlGetActiveShader(void);             // Get the currently active shader id (default shader if no custom shader set)
 
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
@@ -726,6 +752,16 @@ RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch); // Set the active rende
 RLAPI void rlDrawRenderBatchActive(void);               // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
 
+// Render statistics and GPU timing
+// NOTE: GPU timer results are read back with latency (no pipeline stall), only the outermost timer scope is measured,
+// timer scopes are tagged by stats frame (ended by rlResetRenderStats()) and GPU time is reported per completed frame
+RLAPI rlRenderStats rlGetRenderStats(void);             // Get render statistics accumulated since last reset
+RLAPI void rlResetRenderStats(void);                    // Reset render statistics and start a new stats frame (pending GPU timers are kept)
+RLAPI bool rlEnableGpuTimers(void);                     // Enable GPU timer queries (returns false if not supported)
+RLAPI void rlDisableGpuTimers(void);                    // Disable GPU timer queries and release them
+RLAPI void rlBeginGpuTimer(void);                       // Begin GPU timer scope (nestable)
+RLAPI void rlEndGpuTimer(void);                         // End GPU timer scope
+
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
 //------------------------------------------------------------------------------------------------------------------------
@@ -757,6 +793,10 @@ RLAPI void rlUnloadTexture(unsigned int id);                              // Unl
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format); // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI unsigned int rlLoadPixelBuffer(int size);                            // Load pixel buffer for async screen readback (returns 0 if not supported)
+RLAPI void rlUnloadPixelBuffer(unsigned int id);                           // Unload pixel buffer
+RLAPI void rlReadScreenPixelsAsync(unsigned int id, int width, int height); // Read screen pixel data into pixel buffer (no wait for GPU)
+RLAPI bool rlGetPixelBufferData(unsigned int id, int width, int height, unsigned char *data); // Get pixel buffer data (RGBA, top-left origin), waits if readback not finished
 
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(void);                               // Load an empty framebuffer
@@ -1105,6 +1145,28 @@ typedef struct rlglData {
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+    struct {
+        bool enabled;                       // GPU timer queries enabled
+        int depth;                          // Current timer scope nesting depth (only outermost scope is measured)
+        unsigned int queries[RL_MAX_GPU_TIMER_QUERIES]; // Timer query objects ring
+        unsigned int queryFrames[RL_MAX_GPU_TIMER_QUERIES]; // Stats frame of every query issued
+        bool active;                        // Outermost timer scope query issued
+        int head;                           // Next query to issue
+        int tail;                           // Oldest query pending result
+
+        unsigned int frame;                 // Current stats frame, issued queries are tagged with it
+        int skipped;                        // Timer scopes not measured in current frame (queries ring full)
+        int frameSkipped[RL_MAX_GPU_TIMER_FRAMES]; // Timer scopes not measured in latest frames, by frame
+
+        unsigned int pendingFrame;          // Frame of the latest results collected, more results could be pending
+        double pendingTime;                 // GPU time collected for pendingFrame
+        int pendingCount;                   // Timer results collected for pendingFrame
+
+        unsigned int resultFrame;           // Latest frame with all timer results collected, 0 if none
+        double resultTime;                  // GPU time of resultFrame
+        int resultCount;                    // Timer scopes measured in resultFrame
+        int resultSkipped;                  // Timer scopes not measured in resultFrame
+    } GpuTimer;         // GPU timer queries
 } rlglData;
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
@@ -1117,6 +1179,8 @@ typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions
 static double rlCullDistanceNear = RL_CULL_DISTANCE_NEAR;
 static double rlCullDistanceFar = RL_CULL_DISTANCE_FAR;
 
+static rlRenderStats rlStats = { 0 };           // Render statistics
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static rlglData RLGL = { 0 };
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -1143,6 +1207,9 @@ static void rlUnloadShaderDefault(void);    // Unload default shader
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
+#if defined(GRAPHICS_API_OPENGL_33)
+static void rlCollectGpuTimers(void);       // Collect available GPU timer queries results
+#endif
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
 
@@ -1691,6 +1758,7 @@ void rlEnableTexture(unsigned int id)
     glEnable(GL_TEXTURE_2D);
 #endif
     glBindTexture(GL_TEXTURE_2D, id);
+    rlStats.textureBinds++;
 }
 
 // Disable texture
@@ -1707,6 +1775,7 @@ void rlEnableTextureCubemap(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlStats.textureBinds++;
 #endif
 }
 
@@ -1815,6 +1884,7 @@ void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
     glUseProgram(id);
+    rlStats.shaderChanges++;
 #endif
 }
 
@@ -1831,6 +1901,7 @@ void rlEnableFramebuffer(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glBindFramebuffer(GL_FRAMEBUFFER, id);
+    rlStats.stateChanges++;
 #endif
 }
 
@@ -1849,6 +1920,7 @@ void rlDisableFramebuffer(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    rlStats.stateChanges++;
 #endif
 }
 
@@ -1927,22 +1999,22 @@ void rlEnableColorBlend(void) { glEnable(GL_BLEND); }
 void rlDisableColorBlend(void) { glDisable(GL_BLEND); }
 
 // Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
+void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); rlStats.stateChanges++; }
 
 // Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
+void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); rlStats.stateChanges++; }
 
 // Enable depth write
-void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); }
+void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); rlStats.stateChanges++; }
 
 // Disable depth write
-void rlDisableDepthMask(void) { glDepthMask(GL_FALSE); }
+void rlDisableDepthMask(void) { glDepthMask(GL_FALSE); rlStats.stateChanges++; }
 
 // Enable backface culling
-void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
+void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); rlStats.stateChanges++; }
 
 // Disable backface culling
-void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
+void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); rlStats.stateChanges++; }
 
 // Set color mask active for screen read/draw
 void rlColorMask(bool r, bool g, bool b, bool a) { glColorMask(r, g, b, a); }
@@ -1959,10 +2031,10 @@ void rlSetCullFace(int mode)
 }
 
 // Enable scissor test
-void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
+void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); rlStats.stateChanges++; }
 
 // Disable scissor test
-void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
+void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); rlStats.stateChanges++; }
 
 // Scissor test
 void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
@@ -2098,6 +2170,7 @@ void rlSetBlendMode(int mode)
     if ((RLGL.State.currentBlendMode != mode) || ((mode == RL_BLEND_CUSTOM || mode == RL_BLEND_CUSTOM_SEPARATE) && RLGL.State.glCustomBlendModeModified))
     {
         rlDrawRenderBatch(RLGL.currentBatch);
+        rlStats.stateChanges++;
 
         switch (mode)
         {
@@ -2328,6 +2401,8 @@ void rlglInit(int width, int height)
 void rlglClose(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDisableGpuTimers();
+
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
     rlUnloadShaderDefault();          // Unload default shader
@@ -2708,6 +2783,16 @@ unsigned int rlGetShaderIdDefault(void)
     return id;
 }
 
+// Get the currently active shader id
+unsigned int rlGetActiveShader(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    id = RLGL.State.currentShaderId;
+#endif
+    return id;
+}
+
 // Get default shader locs
 int *rlGetShaderLocsDefault(void)
 {
@@ -2910,6 +2995,11 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
     if (RLGL.State.vertexCounter > 0)
     {
+        rlBeginGpuTimer();
+
+        rlStats.batchFlushes++;
+        rlStats.uploadedBytes += (unsigned long long)RLGL.State.vertexCounter*(3*sizeof(float) + 2*sizeof(float) + 3*sizeof(float) + 4*sizeof(unsigned char));
+
         // Activate elements VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
@@ -2979,6 +3069,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         {
             // Set current shader and upload current MVP matrix
             glUseProgram(RLGL.State.currentShaderId);
+            rlStats.shaderChanges++;
 
             // Create modelview-projection matrix and upload to shader
             Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
@@ -3057,6 +3148,10 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
                 glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
 
+                rlStats.drawCalls++;
+                rlStats.textureBinds++;
+                rlStats.vertexCount += batch->draws[i].vertexCount;
+
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
                 {
@@ -3090,6 +3185,8 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
     // Restore viewport to default measures
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+    if (RLGL.State.vertexCounter > 0) rlEndGpuTimer();
     //------------------------------------------------------------------------------------------------------------
 
     // Reset batch buffers
@@ -3155,6 +3252,7 @@ bool rlCheckRenderBatchLimit(int vCount)
         (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
     {
         overflow = true;
+        rlStats.batchOverflows++;
 
         // Store current primitive drawing mode and texture id
         int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
@@ -3171,6 +3269,202 @@ bool rlCheckRenderBatchLimit(int vCount)
     return overflow;
 }
 
+#if defined(GRAPHICS_API_OPENGL_33)
+// Collect GPU timer results already available, never waits for pending queries
+// NOTE: Queries are issued in frame order, a frame is complete once the oldest query pending result
+// belongs to a later frame, frames without queries (no draws or all scopes skipped) are reported as 0 time
+static void rlCollectGpuTimers(void)
+{
+    unsigned int previousFrame = 0;     // Frame completed while collecting results, previous to pendingFrame
+    double previousTime = 0.0;
+    int previousCount = 0;
+
+    while (RLGL.GpuTimer.tail != RLGL.GpuTimer.head)
+    {
+        GLint available = 0;
+        glGetQueryObjectiv(RLGL.GpuTimer.queries[RLGL.GpuTimer.tail], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) break;      // Results become available in issue order
+
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(RLGL.GpuTimer.queries[RLGL.GpuTimer.tail], GL_QUERY_RESULT, &elapsed);
+
+        unsigned int frame = RLGL.GpuTimer.queryFrames[RLGL.GpuTimer.tail];
+
+        if (frame != RLGL.GpuTimer.pendingFrame)
+        {
+            previousFrame = RLGL.GpuTimer.pendingFrame;
+            previousTime = RLGL.GpuTimer.pendingTime;
+            previousCount = RLGL.GpuTimer.pendingCount;
+
+            RLGL.GpuTimer.pendingFrame = frame;
+            RLGL.GpuTimer.pendingTime = 0.0;
+            RLGL.GpuTimer.pendingCount = 0;
+        }
+
+        RLGL.GpuTimer.pendingTime += (double)elapsed*1e-9;
+        RLGL.GpuTimer.pendingCount++;
+
+        RLGL.GpuTimer.tail = (RLGL.GpuTimer.tail + 1)%RL_MAX_GPU_TIMER_QUERIES;
+    }
+
+    // Latest complete frame: previous to oldest query pending result, or to current frame if none pending
+    unsigned int completed = ((RLGL.GpuTimer.tail != RLGL.GpuTimer.head)? RLGL.GpuTimer.queryFrames[RLGL.GpuTimer.tail] : RLGL.GpuTimer.frame) - 1;
+
+    if ((completed > 0) && (completed != RLGL.GpuTimer.resultFrame))
+    {
+        RLGL.GpuTimer.resultFrame = completed;
+        RLGL.GpuTimer.resultTime = 0.0;
+        RLGL.GpuTimer.resultCount = 0;
+
+        if (completed == RLGL.GpuTimer.pendingFrame)
+        {
+            RLGL.GpuTimer.resultTime = RLGL.GpuTimer.pendingTime;
+            RLGL.GpuTimer.resultCount = RLGL.GpuTimer.pendingCount;
+        }
+        else if (completed == previousFrame)
+        {
+            RLGL.GpuTimer.resultTime = previousTime;
+            RLGL.GpuTimer.resultCount = previousCount;
+        }
+
+        // Skipped scopes are kept for latest frames only, frames older are not expected to be pending
+        if ((RLGL.GpuTimer.frame - completed) <= RL_MAX_GPU_TIMER_FRAMES) RLGL.GpuTimer.resultSkipped = RLGL.GpuTimer.frameSkipped[completed%RL_MAX_GPU_TIMER_FRAMES];
+        else RLGL.GpuTimer.resultSkipped = 0;
+    }
+}
+#endif
+
+// Get render statistics accumulated since last reset
+// NOTE: GPU time is reported for latest frame with all timer results available, usually with 1-3 frames of latency
+rlRenderStats rlGetRenderStats(void)
+{
+    rlRenderStats stats = rlStats;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.GpuTimer.enabled)
+    {
+        rlCollectGpuTimers();
+
+        stats.gpuTime = RLGL.GpuTimer.resultTime;
+        stats.gpuTimerCount = RLGL.GpuTimer.resultCount;
+        stats.gpuTimerSkipped = RLGL.GpuTimer.resultSkipped;
+    }
+#endif
+
+    return stats;
+}
+
+// Reset render statistics and start a new stats frame
+// NOTE: GPU timer queries pending results are kept, they are reported with the frame they were issued on
+void rlResetRenderStats(void)
+{
+    rlStats = (rlRenderStats){ 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.GpuTimer.enabled)
+    {
+        RLGL.GpuTimer.frameSkipped[RLGL.GpuTimer.frame%RL_MAX_GPU_TIMER_FRAMES] = RLGL.GpuTimer.skipped;
+        RLGL.GpuTimer.skipped = 0;
+        RLGL.GpuTimer.frame++;
+    }
+#endif
+}
+
+// Enable GPU timer queries
+// NOTE: Requires GL_TIME_ELAPSED queries (OpenGL 3.3 or GL_ARB_timer_query)
+bool rlEnableGpuTimers(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.GpuTimer.enabled) return true;
+
+    if ((glGenQueries == NULL) || (glBeginQuery == NULL) || (glGetQueryObjectui64v == NULL))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: GPU timer queries not supported");
+        return false;
+    }
+
+    glGenQueries(RL_MAX_GPU_TIMER_QUERIES, RLGL.GpuTimer.queries);
+    RLGL.GpuTimer.depth = 0;
+    RLGL.GpuTimer.active = false;
+    RLGL.GpuTimer.head = 0;
+    RLGL.GpuTimer.tail = 0;
+    RLGL.GpuTimer.frame = 1;        // Frame 0 is reserved for no results collected
+    RLGL.GpuTimer.skipped = 0;
+    RLGL.GpuTimer.pendingFrame = 0;
+    RLGL.GpuTimer.pendingTime = 0.0;
+    RLGL.GpuTimer.pendingCount = 0;
+    RLGL.GpuTimer.resultFrame = 0;
+    RLGL.GpuTimer.resultTime = 0.0;
+    RLGL.GpuTimer.resultCount = 0;
+    RLGL.GpuTimer.resultSkipped = 0;
+    RLGL.GpuTimer.enabled = true;
+
+    return true;
+#else
+    TRACELOG(RL_LOG_WARNING, "GL: GPU timer queries not supported");
+    return false;
+#endif
+}
+
+// Disable GPU timer queries
+void rlDisableGpuTimers(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!RLGL.GpuTimer.enabled) return;
+
+    if (RLGL.GpuTimer.active) glEndQuery(GL_TIME_ELAPSED);
+    glDeleteQueries(RL_MAX_GPU_TIMER_QUERIES, RLGL.GpuTimer.queries);
+
+    RLGL.GpuTimer.enabled = false;
+    RLGL.GpuTimer.active = false;
+    RLGL.GpuTimer.depth = 0;
+#endif
+}
+
+// Begin GPU timer scope
+// NOTE: Only one GL_TIME_ELAPSED query can be active, nested scopes are included in the outermost one
+void rlBeginGpuTimer(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!RLGL.GpuTimer.enabled) return;
+
+    if (RLGL.GpuTimer.depth == 0)
+    {
+        int next = (RLGL.GpuTimer.head + 1)%RL_MAX_GPU_TIMER_QUERIES;
+
+        // Queries ring full, try to release finished queries, scope is not measured if still full
+        if (next == RLGL.GpuTimer.tail) rlCollectGpuTimers();
+
+        if (next != RLGL.GpuTimer.tail)
+        {
+            glBeginQuery(GL_TIME_ELAPSED, RLGL.GpuTimer.queries[RLGL.GpuTimer.head]);
+            RLGL.GpuTimer.queryFrames[RLGL.GpuTimer.head] = RLGL.GpuTimer.frame;
+            RLGL.GpuTimer.active = true;
+        }
+        else RLGL.GpuTimer.skipped++;
+    }
+
+    RLGL.GpuTimer.depth++;
+#endif
+}
+
+// End GPU timer scope
+void rlEndGpuTimer(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!RLGL.GpuTimer.enabled || (RLGL.GpuTimer.depth == 0)) return;
+
+    RLGL.GpuTimer.depth--;
+
+    if ((RLGL.GpuTimer.depth == 0) && RLGL.GpuTimer.active)
+    {
+        glEndQuery(GL_TIME_ELAPSED);
+        RLGL.GpuTimer.head = (RLGL.GpuTimer.head + 1)%RL_MAX_GPU_TIMER_QUERIES;
+        RLGL.GpuTimer.active = false;
+    }
+#endif
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
@@ -3239,6 +3533,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     for (int i = 0; i < mipmapCount; i++)
     {
         unsigned int mipSize = rlGetPixelDataSize(mipWidth, mipHeight, format);
+        if (dataPtr != NULL) rlStats.uploadedBytes += mipSize;
 
         unsigned int glInternalFormat, glFormat, glType;
         rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -3492,6 +3787,7 @@ void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int h
     if ((glInternalFormat != 0) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
     {
         glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, data);
+        rlStats.uploadedBytes += rlGetPixelDataSize(width, height, format);
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
 }
@@ -3700,6 +3996,69 @@ unsigned char *rlReadScreenPixels(int width, int height)
     return imgData;     // NOTE: image data should be freed
 }
 
+// Load pixel buffer for async screen readback
+// NOTE: Requires GL_PIXEL_PACK_BUFFER and glMapBufferRange() (OpenGL 3.0)
+unsigned int rlLoadPixelBuffer(int size)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (glMapBufferRange == NULL) return id;
+
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return id;
+}
+
+// Unload pixel buffer
+void rlUnloadPixelBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glDeleteBuffers(1, &id);
+#endif
+}
+
+// Read screen pixel data into pixel buffer
+// NOTE: glReadPixels() into a pixel buffer returns immediately, data is copied when GPU is done
+// with current frame, retrieving data a couple of frames later avoids the pipeline stall
+void rlReadScreenPixelsAsync(unsigned int id, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
+// Get pixel buffer data, flipped vertically to top-left origin
+// NOTE: Alpha channel is returned as read from framebuffer
+bool rlGetPixelBufferData(unsigned int id, int width, int height, unsigned char *data)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+
+    const unsigned char *pixels = (const unsigned char *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, width*height*4, GL_MAP_READ_BIT);
+
+    if (pixels != NULL)
+    {
+        for (int y = 0; y < height; y++) memcpy(data + (size_t)y*width*4, pixels + (size_t)(height - 1 - y)*width*4, (size_t)width*4);
+
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        result = true;
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return result;
+}
+
 // Framebuffer management (fbo)
 //-----------------------------------------------------------------------------------------
 // Load a framebuffer to be used for rendering
@@ -3830,6 +4189,7 @@ unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic)
     glGenBuffers(1, &id);
     glBindBuffer(GL_ARRAY_BUFFER, id);
     glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    if (buffer != NULL) rlStats.uploadedBytes += size;
 #endif
 
     return id;
@@ -3844,6 +4204,7 @@ unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynami
     glGenBuffers(1, &id);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    if (buffer != NULL) rlStats.uploadedBytes += size;
 #endif
 
     return id;
@@ -3888,6 +4249,7 @@ void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int o
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ARRAY_BUFFER, id);
     glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+    rlStats.uploadedBytes += dataSize;
 #endif
 }
 
@@ -3898,6 +4260,7 @@ void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSiz
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
     glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+    rlStats.uploadedBytes += dataSize;
 #endif
 }
 
@@ -3943,6 +4306,9 @@ void rlDisableVertexAttribute(unsigned int index)
 void rlDrawVertexArray(int offset, int count)
 {
     glDrawArrays(GL_TRIANGLES, offset, count);
+
+    rlStats.drawCalls++;
+    rlStats.vertexCount += count;
 }
 
 // Draw vertex array elements
@@ -3953,6 +4319,9 @@ void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
     if (offset > 0) bufferPtr += offset;
 
     glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr);
+
+    rlStats.drawCalls++;
+    rlStats.vertexCount += count;
 }
 
 // Draw vertex array instanced
@@ -3960,6 +4329,9 @@ void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+
+    rlStats.drawCalls++;
+    rlStats.vertexCount += count*instances;
 #endif
 }
 
@@ -3972,6 +4344,9 @@ void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffe
     if (offset > 0) bufferPtr += offset;
 
     glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr, instances);
+
+    rlStats.drawCalls++;
+    rlStats.vertexCount += count*instances;
 #endif
 }
 
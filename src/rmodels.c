@@ -1213,6 +1213,31 @@ void UnloadModel(Model model)
     TRACELOG(LOG_INFO, "MODEL: Unloaded model (and meshes) from RAM and VRAM");
 }
 
+// Reload model from file in place, i.e. on watched file changes
+// NOTE: Model transform is kept, on failure previous model is kept
+// WARNING: As on UnloadModel(), previous materials shaders and textures are not unloaded
+bool ReloadModel(Model *model, const char *fileName)
+{
+    bool result = false;
+    Model reloaded = LoadModel(fileName);
+
+    if (IsModelValid(reloaded))
+    {
+        reloaded.transform = model->transform;
+
+        UnloadModel(*model);
+        *model = reloaded;
+        result = true;
+    }
+    else
+    {
+        UnloadModel(reloaded);
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to reload model, previous model kept", fileName);
+    }
+
+    return result;
+}
+
 // Compute model bounding box limits (considers all meshes)
 BoundingBox GetModelBoundingBox(Model model)
 {
@@ -1616,6 +1641,8 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
     int eyeCount = 1;
     if (rlIsStereoRenderEnabled()) eyeCount = 2;
 
+    rlBeginGpuTimer();      // Measure mesh draw GPU time (if GPU timers enabled)
+
     for (int eye = 0; eye < eyeCount; eye++)
     {
         // Calculate model-view-projection matrix (MVP)
@@ -1636,6 +1663,8 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
         else rlDrawVertexArray(0, mesh.vertexCount);
     }
 
+    rlEndGpuTimer();
+
     // Unbind all bound texture maps
     for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
     {
@@ -1861,6 +1890,8 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     int eyeCount = 1;
     if (rlIsStereoRenderEnabled()) eyeCount = 2;
 
+    rlBeginGpuTimer();      // Measure mesh draw GPU time (if GPU timers enabled)
+
     for (int eye = 0; eye < eyeCount; eye++)
     {
         // Calculate model-view-projection matrix (MVP)
@@ -1881,6 +1912,8 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
         else rlDrawVertexArrayInstanced(0, mesh.vertexCount, instances);
     }
 
+    rlEndGpuTimer();
+
     // Unbind all bound texture maps
     for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
     {
@@ -4437,8 +4470,8 @@ static Model LoadIQM(const char *fileName)
     #define MESH_NAME_LENGTH    32          // Mesh name string length
     #define MATERIAL_NAME_LENGTH 32         // Material name string length
 
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    FileView fileView = LoadFileView(fileName);    // Memory-mapped if available
+    unsigned char *fileData = (unsigned char *)fileView.data;
     unsigned char *fileDataPtr = fileData;
 
     // IQM file structs
@@ -4798,7 +4831,7 @@ static Model LoadIQM(const char *fileName)
         }
     }
 
-    UnloadFileData(fileData);
+    UnloadFileView(fileView);
 
     RL_FREE(imesh);
     RL_FREE(tri);
@@ -4820,8 +4853,8 @@ static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animCou
     #define IQM_MAGIC       "INTERQUAKEMODEL"   // IQM file magic number
     #define IQM_VERSION     2                   // only IQM version 2 supported
 
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    FileView fileView = LoadFileView(fileName);    // Memory-mapped if available
+    unsigned char *fileData = (unsigned char *)fileView.data;
     unsigned char *fileDataPtr = fileData;
 
     typedef struct IQMHeader {
@@ -5032,7 +5065,7 @@ static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animCou
         }
     }
 
-    UnloadFileData(fileData);
+    UnloadFileView(fileView);
 
     RL_FREE(joints);
     RL_FREE(framedata);
@@ -5224,9 +5257,9 @@ static Model LoadGLTF(const char *fileName)
 
     Model model = { 0 };
 
-    // glTF file loading
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // glTF file loading, memory-mapped if available
+    FileView fileView = LoadFileView(fileName);
+    const unsigned char *fileData = fileView.data;
 
     if (fileData == NULL) return model;
 
@@ -5235,7 +5268,7 @@ static Model LoadGLTF(const char *fileName)
     options.file.read = LoadFileGLTFCallback;
     options.file.release = ReleaseFileGLTFCallback;
     cgltf_data *data = NULL;
-    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+    cgltf_result result = cgltf_parse(&options, fileData, (cgltf_size)fileView.size, &data);
 
     if (result == cgltf_result_success)
     {
@@ -5903,7 +5936,7 @@ static Model LoadGLTF(const char *fileName)
     else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
 
     // WARNING: cgltf requires the file pointer available while reading data
-    UnloadFileData(fileData);
+    UnloadFileView(fileView);
 
     return model;
 }
@@ -6047,9 +6080,9 @@ static bool GetPoseAtTimeGLTF(cgltf_interpolation_type interpolationType, cgltf_
 
 static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCount)
 {
-    // glTF file loading
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // glTF file loading, memory-mapped if available
+    FileView fileView = LoadFileView(fileName);
+    const unsigned char *fileData = fileView.data;
 
     ModelAnimation *animations = NULL;
 
@@ -6058,7 +6091,7 @@ static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCo
     options.file.read = LoadFileGLTFCallback;
     options.file.release = ReleaseFileGLTFCallback;
     cgltf_data *data = NULL;
-    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+    cgltf_result result = cgltf_parse(&options, fileData, (cgltf_size)fileView.size, &data);
 
     if (result != cgltf_result_success)
     {
@@ -6215,7 +6248,7 @@ static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCo
 
         cgltf_free(data);
     }
-    UnloadFileData(fileData);
+    UnloadFileView(fileView);
     return animations;
 }
 #endif
@@ -6229,9 +6262,9 @@ static Model LoadVOX(const char *fileName)
     int nbvertices = 0;
     int meshescount = 0;
 
-    // Read vox file into buffer
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // Read vox file data view, memory-mapped if available
+    FileView fileView = LoadFileView(fileName);
+    unsigned char *fileData = (unsigned char *)fileView.data;
 
     if (fileData == 0)
     {
@@ -6241,12 +6274,12 @@ static Model LoadVOX(const char *fileName)
 
     // Read and build voxarray description
     VoxArray3D voxarray = { 0 };
-    int ret = Vox_LoadFromMemory(fileData, dataSize, &voxarray);
+    int ret = Vox_LoadFromMemory(fileData, (unsigned int)fileView.size, &voxarray);
 
     if (ret != VOX_SUCCESS)
     {
         // Error
-        UnloadFileData(fileData);
+        UnloadFileView(fileView);
 
         TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load VOX data", fileName);
         return model;
@@ -6324,7 +6357,7 @@ static Model LoadVOX(const char *fileName)
 
     // Free buffers
     Vox_FreeArrays(&voxarray);
-    UnloadFileData(fileData);
+    UnloadFileView(fileView);
 
     return model;
 }
@@ -6344,8 +6377,8 @@ static Model LoadM3D(const char *fileName)
     m3dp_t *prop = NULL;
     int i, j, k, l, n, mi = -2, vcolor = 0;
 
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    FileView fileView = LoadFileView(fileName);    // Memory-mapped if available
+    unsigned char *fileData = (unsigned char *)fileView.data;
 
     if (fileData != NULL)
     {
@@ -6355,7 +6388,7 @@ static Model LoadM3D(const char *fileName)
         {
             TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load M3D data, error code %d", fileName, m3d? m3d->errcode : -2);
             if (m3d) m3d_free(m3d);
-            UnloadFileData(fileData);
+            UnloadFileView(fileView);
             return model;
         }
         else TRACELOG(LOG_INFO, "MODEL: [%s] M3D data loaded successfully: %i faces/%i materials", fileName, m3d->numface, m3d->nummaterial);
@@ -6364,7 +6397,7 @@ static Model LoadM3D(const char *fileName)
         if (!m3d->numface)
         {
             m3d_free(m3d);
-            UnloadFileData(fileData);
+            UnloadFileView(fileView);
             return model;
         }
 
@@ -6674,7 +6707,7 @@ static Model LoadM3D(const char *fileName)
         }
 
         m3d_free(m3d);
-        UnloadFileData(fileData);
+        UnloadFileView(fileView);
     }
 
     return model;
@@ -6691,8 +6724,8 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
     int i = 0, j = 0;
     *animCount = 0;
 
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    FileView fileView = LoadFileView(fileName);    // Memory-mapped if available
+    unsigned char *fileData = (unsigned char *)fileView.data;
 
     if (fileData != NULL)
     {
@@ -6701,7 +6734,7 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
         if (!m3d || M3D_ERR_ISFATAL(m3d->errcode))
         {
             TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load M3D data, error code %d", fileName, m3d? m3d->errcode : -2);
-            UnloadFileData(fileData);
+            UnloadFileView(fileView);
             return NULL;
         }
         else TRACELOG(LOG_INFO, "MODEL: [%s] M3D data loaded successfully: %i animations, %i bones, %i skins", fileName,
@@ -6711,7 +6744,7 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
         if (!m3d->numaction || !m3d->numbone || !m3d->numskin)
         {
             m3d_free(m3d);
-            UnloadFileData(fileData);
+            UnloadFileView(fileView);
             return NULL;
         }
 
@@ -6786,7 +6819,7 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
         }
 
         m3d_free(m3d);
-        UnloadFileData(fileData);
+        UnloadFileView(fileView);
     }
 
     return animations;
@@ -13,8 +13,10 @@
 *       #define SUPPORT_FILEFORMAT_FNT
 *       #define SUPPORT_FILEFORMAT_TTF
 *       #define SUPPORT_FILEFORMAT_BDF
+*       #define SUPPORT_FILEFORMAT_RFNT
 *           Selected desired fileformats to be supported for loading. Some of those formats are
 *           supported by default, to remove support, just comment unrequired #define in this module
+*           FNT supports text and binary BMFont files, RFNT is the raylib precompiled font format
 *
 *       #define SUPPORT_FONT_ATLAS_WHITE_REC
 *           On font atlas image generation [GenImageFontAtlas()], add a 3x3 pixels white rectangle
@@ -65,11 +67,21 @@
 #include "utils.h"          // Required for: LoadFile*()
 #include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> Only DrawTextPro()
 
-#include <stdlib.h>         // Required for: malloc(), free()
+#include <stdlib.h>         // Required for: malloc(), free(), qsort() [Used in kerning pairs loading]
 #include <stdio.h>          // Required for: vsprintf()
-#include <string.h>         // Required for: strcmp(), strstr(), strcpy(), strncpy() [Used in TextReplace()], sscanf() [Used in LoadBMFont()]
+#include <string.h>         // Required for: strlen(), strcmp(), strstr(), strcpy(), strncpy() [Used in TextReplace()], sscanf() [Used in LoadBMFont()]
 #include <stdarg.h>         // Required for: va_list, va_start(), vsprintf(), va_end() [Used in TextFormat()]
 #include <ctype.h>          // Required for: toupper(), tolower() [Used in TextToUpper(), TextToLower()]
+#include <limits.h>         // Required for: INT_MAX [Used in LoadFontEx(), LoadFontSDF()]
+
+// UTF-8 decoding ASCII fast path, SSE2 is baseline on x86_64 and NEON on ARM64
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>  // Required for: SSE2 intrinsics [Used in DecodeUTF8ASCII(), GetUTF8ASCIILength()]
+    #define RTEXT_UTF8_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>   // Required for: NEON intrinsics [Used in DecodeUTF8ASCII(), GetUTF8ASCIILength()]
+    #define RTEXT_UTF8_NEON
+#endif
 
 #if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
     #if defined(__GNUC__) // GCC and Clang
@@ -115,11 +127,91 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef MAX_TEXT_DECODE_CODEPOINTS
+    #define MAX_TEXT_DECODE_CODEPOINTS           256        // Maximum number of codepoints decoded per block: DrawTextEx(), MeasureTextEx()
+#endif
+
+// MSDF edge colors (channels mask), used by GenGlyphMSDF()
+#define MSDF_RED                    1
+#define MSDF_GREEN                  2
+#define MSDF_BLUE                   4
+#define MSDF_YELLOW                 (MSDF_RED | MSDF_GREEN)
+#define MSDF_MAGENTA                (MSDF_RED | MSDF_BLUE)
+#define MSDF_CYAN                   (MSDF_GREEN | MSDF_BLUE)
+#define MSDF_WHITE                  (MSDF_RED | MSDF_GREEN | MSDF_BLUE)
+
+// Simplified bidi classes, used by LoadTextLayout()
+#define BIDI_CLASS_NEUTRAL          0
+#define BIDI_CLASS_LTR              1
+#define BIDI_CLASS_RTL              2
+#define BIDI_CLASS_NUMBER           3
+
+// raylib precompiled font file format version (.rfnt)
+#define RFNT_FILE_VERSION           1
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Font glyphs loading job data, glyphs are loaded in parallel
+typedef struct FontGlyphsJob {
+    const stbtt_fontinfo *fontInfo; // Font info, shared between jobs (read-only)
+    int *codepoints;                // Codepoints to load
+    GlyphInfo *glyphs;              // Glyphs to fill, one per job
+    int fontSize;                   // Font size in pixels
+    int type;                       // Font type (FontType)
+    float scaleFactor;              // Font scale factor for fontSize
+    int ascent;                     // Font ascent (font units)
+} FontGlyphsJob;
+
+// TTF 'GPOS' pair adjustment subtable, class subtables keep loaded glyphs grouped by second glyph class
+typedef struct KerningSubtableGPOS {
+    unsigned char *table;           // Subtable data
+    int *classStart;                // Class first position in classGlyphs, classCount + 1 entries (class subtables)
+    int *classGlyphs;               // Loaded glyphs indices, grouped by class (class subtables)
+} KerningSubtableGPOS;
+
+// MSDF glyph outline edge, line or quadratic curve (font units)
+typedef struct MsdfEdge {
+    double p[3][2];                 // Control points, lines only use first two
+    int degree;                     // Edge degree: 1-Line, 2-Quadratic curve
+    int color;                      // Edge color, channels using the edge for distance
+} MsdfEdge;
+
+// MSDF signed distance from a point to an edge
+typedef struct MsdfDistance {
+    double distance;                // Signed distance
+    double dot;                     // Orthogonality to edge at nearest point, used to solve ties
+} MsdfDistance;
+#endif
+
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+// raylib precompiled font file header (.rfnt)
+// NOTE: File data is laid out to be used in place without parsing: header, glyphs, recs,
+// kernings and atlas pixel data, all sections are 4-bytes aligned, values are little-endian
+typedef struct RFNTHeader {
+    char id[4];                     // File identifier: "rFNT"
+    int version;                    // File format version
+    int baseSize;                   // Font base size
+    int glyphCount;                 // Number of glyphs
+    int glyphPadding;               // Padding around the glyph characters
+    int type;                       // Font type (FontType)
+    int kerningCount;               // Number of kerning pairs
+    int atlasWidth;                 // Atlas image width
+    int atlasHeight;                // Atlas image height
+    int atlasFormat;                // Atlas image pixel format (PixelFormat)
+    int atlasDataSize;              // Atlas image data size in bytes
+} RFNTHeader;
+
+// raylib precompiled font file glyph data (.rfnt)
+typedef struct RFNTGlyph {
+    int value;                      // Character value (Unicode)
+    int offsetX;                    // Character offset X when drawing
+    int offsetY;                    // Character offset Y when drawing
+    int advanceX;                   // Character advance position X
+} RFNTGlyph;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -130,6 +222,7 @@ extern bool isGpuReady;
 // NOTE: Default font is loaded on InitWindow() and disposed on CloseWindow() [module: core]
 static Font defaultFont = { 0 };
 #endif
+static Shader fontShaders[2] = { 0 };   // Built-in fonts shaders: SDF, MSDF (lazy loaded on first use)
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -141,16 +234,42 @@ static Font defaultFont = { 0 };
 //----------------------------------------------------------------------------------
 #if defined(SUPPORT_FILEFORMAT_FNT)
 static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode font file)
+static Font LoadBMFontBinary(const char *fileName, const unsigned char *fileData, int dataSize);    // Load a binary BMFont file data
+static Image LoadBMFontAtlas(const char *fileName, char (*imFileNames)[129], int pageCount, int imWidth, int imHeight);  // Load BMFont pages images into one atlas
+#endif
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+static Font LoadFontRFNT(const unsigned char *fileData, int dataSize);  // Load a raylib precompiled font file data
 #endif
 #if defined(SUPPORT_FILEFORMAT_BDF)
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, int *codepoints, int codepointCount, int *outFontSize);
 #endif
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static GlyphKerning *LoadFontKerningTTF(const unsigned char *fileData, int fontSize, const GlyphInfo *glyphs, int glyphCount, int *kerningCount); // Load kerning pairs for loaded glyphs from TTF data
+static GlyphKerning *LoadFontKerningGPOS(const stbtt_fontinfo *fontInfo, const int *glyphIndices, const GlyphInfo *glyphs, int glyphCount, float scaleFactor, int *kerningCount); // Load kerning pairs from TTF 'GPOS' table
+static GlyphKerning *AddGlyphKerning(GlyphKerning *kernings, int *count, int *capacity, GlyphKerning kerning);  // Add kerning pair to pairs array, growing it as required
+static void LoadFontGlyphJob(void *data, int index);   // Load one font glyph (job), used by LoadFontData()
+static unsigned char *GenGlyphMSDF(const stbtt_fontinfo *fontInfo, int glyphIndex, float scale, int padding, float pixelRange, int *width, int *height, int *offsetX, int *offsetY); // Generate glyph MSDF data
+#endif
+static Font LoadFontFromMemoryType(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font from memory with generation type
+static bool BeginFontShader(Font font);         // Begin built-in shader mode for SDF and MSDF fonts, if no custom shader active
+static void EndFontShader(bool active);         // End built-in font shader mode
+static int CompareGlyphKerning(const void *a, const void *b);  // Compare kerning pairs by first and second codepoints, used by qsort()
+static void DrawGlyph(Font font, int index, Vector2 position, float fontSize, Color tint);  // Draw one glyph by font glyph index
+static Rectangle GetGlyphDrawRec(Font font, int index, Vector2 position, float fontSize);   // Get glyph destination rectangle on screen
+static bool CheckGlyphClip(Font font, int index, Vector2 position, float fontSize, Rectangle clip);    // Check if glyph destination rectangle overlaps clip rectangle
+static int GetCodepointBidiClass(int codepoint);   // Get simplified bidi class of a codepoint, used by LoadTextLayout()
+static int GetUTF8ASCIILength(const unsigned char *text, int size);     // Get length of ASCII run at text start (SIMD blocks)
+static int DecodeUTF8ASCII(const unsigned char *text, int size, int *codepoints);   // Decode ASCII run at text start into codepoints (SIMD blocks)
+static int DecodeUTF8(const char *text, int size, int *codepoints, int maxCount, int *count);   // Decode UTF-8 text into codepoints, returns bytes processed
+static int CountUTF8(const char *text, int size);   // Count codepoints in UTF-8 text
+
 static int textLineSpacing = 2;                 // Text vertical line spacing in pixels (between lines)
 
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
 extern void UnloadFontDefault(void);
 #endif
+extern void UnloadTextResources(void);
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -315,6 +434,16 @@ extern void UnloadFontDefault(void)
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
+// Unload text module internal resources: built-in SDF/MSDF fonts shaders
+extern void UnloadTextResources(void)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        if (fontShaders[i].id > 0) UnloadShader(fontShaders[i]);
+        fontShaders[i] = (Shader){ 0 };
+    }
+}
+
 // Get the default font, useful to be used with extended parameters
 Font GetFontDefault()
 {
@@ -356,6 +485,10 @@ Font LoadFont(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_BDF)
     if (IsFileExtension(fileName, ".bdf")) font = LoadFontEx(fileName, FONT_TTF_DEFAULT_SIZE, NULL, FONT_TTF_DEFAULT_NUMCHARS);
     else
+#endif
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    if (IsFileExtension(fileName, ".rfnt")) font = LoadFontEx(fileName, 0, NULL, 0);
+    else
 #endif
     {
         Image image = LoadImage(fileName);
@@ -368,7 +501,10 @@ Font LoadFont(const char *fileName)
         if (font.texture.id == 0) TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load font texture -> Using default font", fileName);
         else
         {
-            SetTextureFilter(font.texture, TEXTURE_FILTER_POINT);    // By default, we set point filter (the best performance)
+            // By default, we set point filter (the best performance)
+            // NOTE: Distance field fonts (precompiled) require bilinear filter to interpolate distances
+            if ((font.type == FONT_SDF) || (font.type == FONT_MSDF)) SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+            else SetTextureFilter(font.texture, TEXTURE_FILTER_POINT);
             TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", FONT_TTF_DEFAULT_SIZE, FONT_TTF_DEFAULT_NUMCHARS);
         }
     }
@@ -383,16 +519,16 @@ Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepoi
 {
     Font font = { 0 };
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // Loading file data view, memory-mapped if available
+    FileView fileView = LoadFileView(fileName);
 
-    if (fileData != NULL)
+    if (fileView.data != NULL)
     {
-        // Loading font from memory data
-        font = LoadFontFromMemory(GetFileExtension(fileName), fileData, dataSize, fontSize, codepoints, codepointCount);
+        // Loading font from file data
+        if (fileView.size <= INT_MAX) font = LoadFontFromMemory(GetFileExtension(fileName), fileView.data, (int)fileView.size, fontSize, codepoints, codepointCount);
+        else TRACELOG(LOG_WARNING, "FONT: [%s] File is bigger than 2147483647 bytes, not supported", fileName);
 
-        UnloadFileData(fileData);
+        UnloadFileView(fileView);
     }
 
     return font;
@@ -525,6 +661,50 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
 
 // Load font from memory buffer, fileType refers to extension: i.e. ".ttf"
 Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    // Precompiled font, generation parameters are not used
+    if (TextIsEqual(TextToLower(fileType), ".rfnt")) font = LoadFontRFNT(fileData, dataSize);
+    else
+#endif
+    font = LoadFontFromMemoryType(fileType, fileData, dataSize, fontSize, codepoints, codepointCount, FONT_DEFAULT);
+
+    return font;
+}
+
+// Load TTF font as signed distance field (FONT_SDF or FONT_MSDF)
+// NOTE: Font is drawn with a built-in shader by text drawing functions, unless a custom shader is active
+Font LoadFontSDF(const char *fileName, int fontSize, int *codepoints, int codepointCount, int type)
+{
+    Font font = { 0 };
+
+    if ((type != FONT_SDF) && (type != FONT_MSDF))
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Font type not supported for SDF loading", fileName);
+        return font;
+    }
+
+    // Loading file data view, memory-mapped if available
+    FileView fileView = LoadFileView(fileName);
+
+    if ((fileView.data != NULL) && (fileView.size <= INT_MAX))
+    {
+        // Loading font from file data
+        font = LoadFontFromMemoryType(GetFileExtension(fileName), fileView.data, (int)fileView.size, fontSize, codepoints, codepointCount, type);
+
+        // Distance fields require bilinear filtering to interpolate distances
+        if (isGpuReady && (font.type == type)) SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+    }
+
+    UnloadFileView(fileView);
+
+    return font;
+}
+
+// Load font from memory buffer with generation type (FontType)
+static Font LoadFontFromMemoryType(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type)
 {
     Font font = { 0 };
 
@@ -539,7 +719,9 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     if (TextIsEqual(fileExtLower, ".ttf") ||
         TextIsEqual(fileExtLower, ".otf"))
     {
-        font.glyphs = LoadFontData(fileData, dataSize, font.baseSize, codepoints, font.glyphCount, FONT_DEFAULT);
+        font.glyphs = LoadFontData(fileData, dataSize, font.baseSize, codepoints, font.glyphCount, type);
+        font.type = type;
+        if (font.glyphs != NULL) font.kernings = LoadFontKerningTTF(fileData, font.baseSize, font.glyphs, font.glyphCount, &font.kerningCount);
     }
     else
 #endif
@@ -547,6 +729,7 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     if (TextIsEqual(fileExtLower, ".bdf"))
     {
         font.glyphs = LoadFontDataBDF(fileData, dataSize, codepoints, font.glyphCount, &font.baseSize);
+        if ((font.glyphs != NULL) && (type != FONT_DEFAULT)) TRACELOG(LOG_WARNING, "FONT: BDF font type not supported, loaded as default font");
     }
     else
 #endif
@@ -611,6 +794,15 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 #ifndef FONT_BITMAP_ALPHA_THRESHOLD
     #define FONT_BITMAP_ALPHA_THRESHOLD     80      // Bitmap (B&W) font generation alpha threshold
 #endif
+#ifndef FONT_MSDF_CHAR_PADDING
+    #define FONT_MSDF_CHAR_PADDING           4      // MSDF font generation char padding
+#endif
+#ifndef FONT_MSDF_PIXEL_RANGE
+    #define FONT_MSDF_PIXEL_RANGE         4.0f      // MSDF font generation distance range in pixels (full range, inside and outside)
+#endif
+#ifndef FONT_PARALLEL_MIN_GLYPHS
+    #define FONT_PARALLEL_MIN_GLYPHS       256      // Minimum number of glyphs to load in parallel, SDF and MSDF glyphs use 1/8 of it
+#endif
 
     GlyphInfo *chars = NULL;
 
@@ -646,82 +838,17 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 
             chars = (GlyphInfo *)RL_CALLOC(codepointCount, sizeof(GlyphInfo));
 
-            // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < codepointCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = codepoints[i];  // Character value to get info for
-                chars[i].value = ch;
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-                // Check if a glyph is available in the font
-                // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
-                int index = stbtt_FindGlyphIndex(&fontInfo, ch);
-
-                if (index > 0)
-                {
-                    switch (type)
-                    {
-                        case FONT_DEFAULT:
-                        case FONT_BITMAP: chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        case FONT_SDF: if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        default: break;
-                    }
-
-                    if (chars[i].image.data != NULL)    // Glyph data has been found in the font
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        if (chh > fontSize) TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] size is bigger than expected font size", ch);
-
-                        // Load characters images
-                        chars[i].image.width = chw;
-                        chars[i].image.height = chh;
-                        chars[i].image.mipmaps = 1;
-                        chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+            // Load glyphs in parallel, every glyph is loaded independently
+            // NOTE: Font data is only read by stb_truetype, it can be shared between threads,
+            // a few glyphs are loaded serially, threads creation would cost more than loading them
+            FontGlyphsJob job = { &fontInfo, codepoints, chars, fontSize, type, scaleFactor, ascent };
+            int parallelMinGlyphs = ((type == FONT_SDF) || (type == FONT_MSDF))? FONT_PARALLEL_MIN_GLYPHS/8 : FONT_PARALLEL_MIN_GLYPHS;
 
-                        chars[i].offsetY += (int)((float)ascent*scaleFactor);
-                    }
-
-                    // NOTE: We create an empty image for space character,
-                    // it could be further required for atlas packing
-                    if (ch == 32)
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        Image imSpace = {
-                            .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
-                            .width = chars[i].advanceX,
-                            .height = fontSize,
-                            .mipmaps = 1,
-                            .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                        };
-
-                        chars[i].image = imSpace;
-                    }
-
-                    if (type == FONT_BITMAP)
-                    {
-                        // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                        // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                        for (int p = 0; p < chw*chh; p++)
-                        {
-                            if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                            else ((unsigned char *)chars[i].image.data)[p] = 255;
-                        }
-                    }
-                }
-                else
-                {
-                    // TODO: Use some fallback glyph for codepoints not found in the font
-                }
+            if (codepointCount < parallelMinGlyphs)
+            {
+                for (int i = 0; i < codepointCount; i++) LoadFontGlyphJob(&job, i);
             }
+            else RunParallelJobs(LoadFontGlyphJob, &job, codepointCount);
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -796,10 +923,31 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
     }
 #endif
 
-    atlas.data = (unsigned char *)RL_CALLOC(1, atlas.width*atlas.height);   // Create a bitmap to store characters (8 bpp)
-    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    // NOTE: MSDF glyphs use three channels (R8G8B8), other glyphs one channel (GRAYSCALE)
+    int channels = 1;
+    for (int i = 0; i < glyphCount; i++) if (glyphs[i].image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+
+    atlas.data = (unsigned char *)RL_CALLOC(channels, atlas.width*atlas.height);   // Create a bitmap to store characters (8 bpp per channel)
+    atlas.format = (channels == 3)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
     atlas.mipmaps = 1;
 
+    // Glyphs images in atlas format, glyphs in a different format are converted
+    // NOTE: Glyphs with no image data (or empty) are packed but not copied
+    Image *images = (Image *)RL_CALLOC(glyphCount, sizeof(Image));
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if ((glyphs[i].image.data == NULL) || (glyphs[i].image.width <= 0) || (glyphs[i].image.height <= 0)) continue;
+
+        images[i] = glyphs[i].image;
+
+        if (images[i].format != atlas.format)
+        {
+            images[i] = ImageCopy(glyphs[i].image);
+            ImageFormat(&images[i], atlas.format);
+        }
+    }
+
     // DEBUG: We can see padding in the generated image setting a gray background...
     //for (int i = 0; i < atlas.width*atlas.height; i++) ((unsigned char *)atlas.data)[i] = 100;
 
@@ -837,12 +985,10 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
             }
 
             // Copy pixel data from glyph image to atlas
-            for (int y = 0; y < glyphs[i].image.height; y++)
+            for (int y = 0; (images[i].data != NULL) && (y < images[i].height); y++)
             {
-                for (int x = 0; x < glyphs[i].image.width; x++)
-                {
-                    ((unsigned char *)atlas.data)[(offsetY + y)*atlas.width + (offsetX + x)] = ((unsigned char *)glyphs[i].image.data)[y*glyphs[i].image.width + x];
-                }
+                memcpy((unsigned char *)atlas.data + ((offsetY + y)*atlas.width + offsetX)*channels,
+                       (unsigned char *)images[i].data + y*images[i].width*channels, images[i].width*channels);
             }
 
             // Fill chars rectangles in atlas info
@@ -884,13 +1030,11 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
 
             if (rects[i].was_packed)
             {
-                // Copy pixel data from fc.data to atlas
-                for (int y = 0; y < glyphs[i].image.height; y++)
+                // Copy pixel data from glyph image to atlas
+                for (int y = 0; (images[i].data != NULL) && (y < images[i].height); y++)
                 {
-                    for (int x = 0; x < glyphs[i].image.width; x++)
-                    {
-                        ((unsigned char *)atlas.data)[(rects[i].y + padding + y)*atlas.width + (rects[i].x + padding + x)] = ((unsigned char *)glyphs[i].image.data)[y*glyphs[i].image.width + x];
-                    }
+                    memcpy((unsigned char *)atlas.data + ((rects[i].y + padding + y)*atlas.width + rects[i].x + padding)*channels,
+                           (unsigned char *)images[i].data + y*images[i].width*channels, images[i].width*channels);
                 }
             }
             else TRACELOG(LOG_WARNING, "FONT: Failed to package character (%i)", i);
@@ -901,19 +1045,30 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
         RL_FREE(context);
     }
 
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if (images[i].data != glyphs[i].image.data) UnloadImage(images[i]);
+    }
+
+    RL_FREE(images);
+
 #if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
     // Add a 3x3 white rectangle at the bottom-right corner of the generated atlas,
     // useful to use as the white texture to draw shapes with raylib, using this rectangle
     // shapes and text can be backed into a single draw call: SetShapesTexture()
     for (int i = 0, k = atlas.width*atlas.height - 1; i < 3; i++)
     {
-        ((unsigned char *)atlas.data)[k - 0] = 255;
-        ((unsigned char *)atlas.data)[k - 1] = 255;
-        ((unsigned char *)atlas.data)[k - 2] = 255;
+        memset((unsigned char *)atlas.data + (k - 2)*channels, 255, 3*channels);
         k -= atlas.width;
     }
 #endif
 
+    if (channels == 3)
+    {
+        *glyphRecs = recs;
+        return atlas;
+    }
+
     // Convert image data from GRAYSCALE to GRAY_ALPHA
     unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(atlas.width*atlas.height*sizeof(unsigned char)*2); // Two channels
 
@@ -953,11 +1108,114 @@ void UnloadFont(Font font)
         UnloadFontData(font.glyphs, font.glyphCount);
         if (isGpuReady) UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        RL_FREE(font.kernings);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
 }
 
+// Reload font from file in place, i.e. on watched file changes
+// NOTE: Generated fonts (TTF/OTF/BDF) are reloaded with same size, codepoints and type (SDF/MSDF),
+// on failure previous font is kept
+bool ReloadFont(Font *font, const char *fileName)
+{
+    bool result = false;
+    Font reloaded = { 0 };
+
+    if ((IsFileExtension(fileName, ".ttf") || IsFileExtension(fileName, ".otf") || IsFileExtension(fileName, ".bdf")) && (font->glyphCount > 0))
+    {
+        int *codepoints = (int *)RL_MALLOC(font->glyphCount*sizeof(int));
+        for (int i = 0; i < font->glyphCount; i++) codepoints[i] = font->glyphs[i].value;
+
+        // Distance field fonts are generated again as distance fields, keeping font type
+        if (((font->type == FONT_SDF) || (font->type == FONT_MSDF)) && !IsFileExtension(fileName, ".bdf"))
+        {
+            reloaded = LoadFontSDF(fileName, font->baseSize, codepoints, font->glyphCount, font->type);
+        }
+        else reloaded = LoadFontEx(fileName, font->baseSize, codepoints, font->glyphCount);
+
+        RL_FREE(codepoints);
+    }
+    else reloaded = LoadFont(fileName);
+
+    if (IsFontValid(reloaded) && (reloaded.texture.id != GetFontDefault().texture.id))
+    {
+        UnloadFont(*font);
+        *font = reloaded;
+        result = true;
+    }
+    else
+    {
+        UnloadFont(reloaded);
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to reload font, previous font kept", fileName);
+    }
+
+    return result;
+}
+
+// Export font as raylib precompiled font file (.rfnt), returns true on success
+// NOTE: Atlas is read back from GPU, glyphs data, kernings and font type are stored,
+// useful to cache generated fonts (i.e. FONT_MSDF) and load them with no generation cost
+bool ExportFont(Font font, const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    if (IsFileExtension(fileName, ".rfnt"))
+    {
+        Image atlas = LoadImageFromTexture(font.texture);
+
+        if (atlas.data != NULL)
+        {
+            RFNTHeader header = { .id = { 'r', 'F', 'N', 'T' }, .version = RFNT_FILE_VERSION };
+            header.baseSize = font.baseSize;
+            header.glyphCount = font.glyphCount;
+            header.glyphPadding = font.glyphPadding;
+            header.type = font.type;
+            header.kerningCount = font.kerningCount;
+            header.atlasWidth = atlas.width;
+            header.atlasHeight = atlas.height;
+            header.atlasFormat = atlas.format;
+            header.atlasDataSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+
+            int recsOffset = sizeof(RFNTHeader) + font.glyphCount*sizeof(RFNTGlyph);
+            int kerningsOffset = recsOffset + font.glyphCount*sizeof(Rectangle);
+            int atlasOffset = kerningsOffset + font.kerningCount*sizeof(GlyphKerning);
+            int dataSize = atlasOffset + header.atlasDataSize;
+
+            unsigned char *fileData = (unsigned char *)RL_CALLOC(dataSize, 1);
+
+            memcpy(fileData, &header, sizeof(RFNTHeader));
+
+            for (int i = 0; i < font.glyphCount; i++)
+            {
+                RFNTGlyph glyph = { font.glyphs[i].value, font.glyphs[i].offsetX, font.glyphs[i].offsetY, font.glyphs[i].advanceX };
+                memcpy(fileData + sizeof(RFNTHeader) + i*sizeof(RFNTGlyph), &glyph, sizeof(RFNTGlyph));
+            }
+
+            memcpy(fileData + recsOffset, font.recs, font.glyphCount*sizeof(Rectangle));
+            if (font.kerningCount > 0) memcpy(fileData + kerningsOffset, font.kernings, font.kerningCount*sizeof(GlyphKerning));
+            memcpy(fileData + atlasOffset, atlas.data, header.atlasDataSize);
+
+            success = SaveFileData(fileName, fileData, dataSize);
+
+            RL_FREE(fileData);
+            UnloadImage(atlas);
+        }
+    }
+    else
+#endif
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] File format not supported for export", fileName);
+        return false;
+    }
+
+    if (success) TRACELOG(LOG_INFO, "FONT: [%s] Font exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FONT: [%s] Failed to export font", fileName);
+
+    return success;
+}
+
 // Export font as code file, returns true on success
 bool ExportFontAsCode(Font font, const char *fileName)
 {
@@ -1144,44 +1402,121 @@ void DrawText(const char *text, int posX, int posY, int fontSize, Color color)
 }
 
 // Draw text using Font
-// NOTE: chars spacing is NOT proportional to fontSize
+// NOTE: chars spacing is NOT proportional to fontSize, font kerning pairs are applied between glyphs
 void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
 {
     if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
 
     int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
+    int codepoints[MAX_TEXT_DECODE_CODEPOINTS] = { 0 };  // Codepoints decoded per block
 
     float textOffsetY = 0;          // Offset between lines (on linebreak '\n')
     float textOffsetX = 0.0f;       // Offset X to next character to draw
+    int previous = -1;              // Previous codepoint in line, kerned with next one
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    bool fontShader = BeginFontShader(font);
+
     for (int i = 0; i < size;)
     {
-        // Get next codepoint from byte string and glyph index in font
-        int codepointByteCount = 0;
-        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
-        int index = GetGlyphIndex(font, codepoint);
+        // Decode next block of codepoints from byte string
+        int codepointCount = 0;
+        i += DecodeUTF8(&text[i], size - i, codepoints, MAX_TEXT_DECODE_CODEPOINTS, &codepointCount);
 
-        if (codepoint == '\n')
-        {
-            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
-            textOffsetY += (fontSize + textLineSpacing);
-            textOffsetX = 0.0f;
-        }
-        else
+        for (int k = 0; k < codepointCount; k++)
         {
-            if ((codepoint != ' ') && (codepoint != '\t'))
+            int codepoint = codepoints[k];
+            int index = GetGlyphIndex(font, codepoint);
+
+            if (codepoint == '\n')
             {
-                DrawTextCodepoint(font, codepoint, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+                textOffsetY += (fontSize + textLineSpacing);
+                textOffsetX = 0.0f;
+                previous = -1;
             }
+            else
+            {
+                if ((font.kernings != NULL) && (previous >= 0)) textOffsetX += GetGlyphKerning(font, previous, codepoint)*scaleFactor;
+                previous = codepoint;
 
-            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
-            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+                if ((codepoint != ' ') && (codepoint != '\t'))
+                {
+                    DrawGlyph(font, index, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                }
+
+                if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+                else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+            }
         }
+    }
+
+    EndFontShader(fontShader);
+}
+
+// Draw text using Font, only glyphs overlapping clip rectangle are drawn
+// NOTE: Lines offsets must be loaded from the same text with LoadTextLineOffsets(), lines fully outside
+// the clip rectangle are skipped without being decoded, glyphs partially inside are drawn whole,
+// use BeginScissorMode() for pixel clipping
+void DrawTextClipped(Font font, const char *text, TextLineOffsets lines, Vector2 position, Rectangle clip, float fontSize, float spacing, Color tint)
+{
+    if ((text == NULL) || (lines.offsets == NULL) || (lines.count <= 0)) return;
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+
+    int codepoints[MAX_TEXT_DECODE_CODEPOINTS] = { 0 };  // Codepoints decoded per block
+
+    float lineHeight = fontSize + textLineSpacing;      // Offset between lines (on linebreak '\n')
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+
+    // Visible lines range computed from text position, lines above clip rectangle are not processed
+    // NOTE: One extra line on each side, covering float rounding, it is discarded by clip checks
+    float firstLineY = (lineHeight > 0.0f)? floorf((clip.y - position.y)/lineHeight) - 1.0f : 0.0f;
+    float lastLineY = (lineHeight > 0.0f)? ceilf((clip.y + clip.height - position.y)/lineHeight) + 1.0f : (float)lines.count;
+    int firstLine = (firstLineY > 0.0f)? (int)fminf(firstLineY, (float)lines.count) : 0;
+    int lastLine = (lastLineY > 0.0f)? (int)fminf(lastLineY, (float)(lines.count - 1)) : 0;
+
+    bool fontShader = BeginFontShader(font);
+
+    for (int line = firstLine; line <= lastLine; line++)
+    {
+        int lineStart = lines.offsets[line];
+        int lineSize = ((line < (lines.count - 1))? (lines.offsets[line + 1] - 1) : lines.size) - lineStart;
+        float lineY = position.y + line*lineHeight;
+
+        if ((lineY >= (clip.y + clip.height)) || ((lineY + lineHeight) <= clip.y)) continue;
+
+        float textOffsetX = 0.0f;
+        int previous = -1;          // Previous codepoint in line, kerned with next one
+
+        for (int i = 0; i < lineSize;)
+        {
+            int codepointCount = 0;
+            i += DecodeUTF8(&text[lineStart + i], lineSize - i, codepoints, MAX_TEXT_DECODE_CODEPOINTS, &codepointCount);
+
+            for (int k = 0; k < codepointCount; k++)
+            {
+                // Pen moves only to the right, rest of the line is out of clip rectangle
+                if ((position.x + textOffsetX) >= (clip.x + clip.width)) { i = lineSize; break; }
+
+                if ((font.kernings != NULL) && (previous >= 0)) textOffsetX += GetGlyphKerning(font, previous, codepoints[k])*scaleFactor;
+                previous = codepoints[k];
+
+                int index = GetGlyphIndex(font, codepoints[k]);
+                Vector2 glyphPosition = { position.x + textOffsetX, lineY };
+
+                if ((codepoints[k] != ' ') && (codepoints[k] != '\t') && CheckGlyphClip(font, index, glyphPosition, fontSize, clip))
+                {
+                    DrawGlyph(font, index, glyphPosition, fontSize, tint);
+                }
 
-        i += codepointByteCount;   // Move text bytes counter to next codepoint
+                if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+                else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+            }
+        }
     }
+
+    EndFontShader(fontShader);
 }
 
 // Draw text using Font and pro parameters (rotation)
@@ -1204,22 +1539,10 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
     // Character index position in sprite font
     // NOTE: In case a codepoint is not available in the font, index returned points to '?'
     int index = GetGlyphIndex(font, codepoint);
-    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
-
-    // Character destination rectangle on screen
-    // NOTE: We consider glyphPadding on drawing
-    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
-                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
 
-    // Character source rectangle from font texture atlas
-    // NOTE: We consider chars padding when drawing, it could be required for outline/glow shader effects
-    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
-                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
-
-    // Draw the character texture on the screen
-    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    bool fontShader = BeginFontShader(font);
+    DrawGlyph(font, index, position, fontSize, tint);
+    EndFontShader(fontShader);
 }
 
 // Draw multiple character (codepoints)
@@ -1230,6 +1553,8 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    bool fontShader = BeginFontShader(font);
+
     for (int i = 0; i < codepointCount; i++)
     {
         int index = GetGlyphIndex(font, codepoints[i]);
@@ -1242,15 +1567,19 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
         }
         else
         {
+            if ((font.kernings != NULL) && (i > 0) && (codepoints[i - 1] != '\n')) textOffsetX += GetGlyphKerning(font, codepoints[i - 1], codepoints[i])*scaleFactor;
+
             if ((codepoints[i] != ' ') && (codepoints[i] != '\t'))
             {
-                DrawTextCodepoint(font, codepoints[i], (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                DrawGlyph(font, index, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
             }
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
             else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
         }
     }
+
+    EndFontShader(fontShader);
 }
 
 // Set vertical line spacing when drawing with line-breaks
@@ -1278,6 +1607,7 @@ int MeasureText(const char *text, int fontSize)
 }
 
 // Measure string size for Font
+// NOTE: Font kerning pairs are applied between glyphs, same as DrawTextEx()
 Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
 {
     Vector2 textSize = { 0 };
@@ -1286,6 +1616,7 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
         (text == NULL) || (text[0] == '\0')) return textSize; // Security check
 
     int size = TextLength(text);    // Get size in bytes of text
+    int codepoints[MAX_TEXT_DECODE_CODEPOINTS] = { 0 };  // Codepoints decoded per block
     int tempByteCounter = 0;        // Used to count longer text line num chars
     int byteCounter = 0;
 
@@ -1296,34 +1627,43 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
     float scaleFactor = fontSize/(float)font.baseSize;
 
     int letter = 0;                 // Current character
+    int previous = -1;              // Previous character in line, kerned with current one
     int index = 0;                  // Index position in sprite font
 
     for (int i = 0; i < size;)
     {
-        byteCounter++;
+        // Decode next block of codepoints from byte string
+        int codepointCount = 0;
+        i += DecodeUTF8(&text[i], size - i, codepoints, MAX_TEXT_DECODE_CODEPOINTS, &codepointCount);
 
-        int codepointByteCount = 0;
-        letter = GetCodepointNext(&text[i], &codepointByteCount);
-        index = GetGlyphIndex(font, letter);
+        for (int k = 0; k < codepointCount; k++)
+        {
+            byteCounter++;
 
-        i += codepointByteCount;
+            letter = codepoints[k];
+            index = GetGlyphIndex(font, letter);
 
-        if (letter != '\n')
-        {
-            if (font.glyphs[index].advanceX > 0) textWidth += font.glyphs[index].advanceX;
-            else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
-        }
-        else
-        {
-            if (tempTextWidth < textWidth) tempTextWidth = textWidth;
-            byteCounter = 0;
-            textWidth = 0;
+            if (letter != '\n')
+            {
+                if ((font.kernings != NULL) && (previous >= 0)) textWidth += GetGlyphKerning(font, previous, letter);
+                previous = letter;
 
-            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
-            textHeight += (fontSize + textLineSpacing);
-        }
+                if (font.glyphs[index].advanceX > 0) textWidth += font.glyphs[index].advanceX;
+                else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
+            }
+            else
+            {
+                if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+                byteCounter = 0;
+                textWidth = 0;
+                previous = -1;
+
+                // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+                textHeight += (fontSize + textLineSpacing);
+            }
 
-        if (tempByteCounter < byteCounter) tempByteCounter = byteCounter;
+            if (tempByteCounter < byteCounter) tempByteCounter = byteCounter;
+        }
     }
 
     if (tempTextWidth < textWidth) tempTextWidth = textWidth;
@@ -1386,56 +1726,444 @@ Rectangle GetGlyphAtlasRec(Font font, int codepoint)
     return rec;
 }
 
-//----------------------------------------------------------------------------------
-// Text strings management functions
-//----------------------------------------------------------------------------------
-// Get text length in bytes, check for \0 character
-unsigned int TextLength(const char *text)
+// Get kerning advance adjustment between two codepoints (pixels at font base size)
+// NOTE: Kerning pairs are sorted on font loading, so pair is found by binary search
+float GetGlyphKerning(Font font, int codepoint1, int codepoint2)
 {
-    unsigned int length = 0;
+    float advanceX = 0.0f;
 
-    if (text != NULL)
+    int low = 0;
+    int high = font.kerningCount - 1;
+
+    while ((font.kernings != NULL) && (low <= high))
     {
-        // NOTE: Alternative: use strlen(text)
+        int mid = low + (high - low)/2;
+        const GlyphKerning *kerning = &font.kernings[mid];
 
-        while (*text++) length++;
+        if ((kerning->first == codepoint1) && (kerning->second == codepoint2))
+        {
+            advanceX = kerning->advanceX;
+            break;
+        }
+        else if ((kerning->first < codepoint1) || ((kerning->first == codepoint1) && (kerning->second < codepoint2))) low = mid + 1;
+        else high = mid - 1;
     }
 
-    return length;
+    return advanceX;
 }
 
-// Formatting of text with variables to 'embed'
-// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
-const char *TextFormat(const char *text, ...)
+//----------------------------------------------------------------------------------
+// Text layout functions
+//----------------------------------------------------------------------------------
+// Load text lines start offsets, required by DrawTextClipped()
+// NOTE: Text is scanned once, offsets must be loaded again if text changes
+TextLineOffsets LoadTextLineOffsets(const char *text)
 {
-#ifndef MAX_TEXTFORMAT_BUFFERS
-    #define MAX_TEXTFORMAT_BUFFERS 4        // Maximum number of static buffers for text formatting
-#endif
+    TextLineOffsets lines = { 0 };
 
-    // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    if (text == NULL) return lines;
 
-    char *currentBuffer = buffers[index];
-    memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
+    lines.size = TextLength(text);
 
-    va_list args;
-    va_start(args, text);
-    int requiredByteCount = vsnprintf(currentBuffer, MAX_TEXT_BUFFER_LENGTH, text, args);
-    va_end(args);
+    int capacity = 64;
+    lines.offsets = (int *)RL_MALLOC(capacity*sizeof(int));
 
-    // If requiredByteCount is larger than the MAX_TEXT_BUFFER_LENGTH, then overflow occured
-    if (requiredByteCount >= MAX_TEXT_BUFFER_LENGTH)
+    for (int lineStart = 0; lineStart <= lines.size;)
     {
-        // Inserting "..." at the end of the string to mark as truncated
-        char *truncBuffer = buffers[index] + MAX_TEXT_BUFFER_LENGTH - 4; // Adding 4 bytes = "...\0"
-        sprintf(truncBuffer, "...");
-    }
+        if (lines.count == capacity)
+        {
+            capacity *= 2;
+            lines.offsets = (int *)RL_REALLOC(lines.offsets, capacity*sizeof(int));
+        }
 
-    index += 1;     // Move to next buffer for next function call
-    if (index >= MAX_TEXTFORMAT_BUFFERS) index = 0;
+        lines.offsets[lines.count++] = lineStart;
 
-    return currentBuffer;
+        const char *lineEnd = (const char *)memchr(&text[lineStart], '\n', lines.size - lineStart);
+        if (lineEnd == NULL) break;
+
+        lineStart = (int)(lineEnd - text) + 1;
+    }
+
+    lines.offsets = (int *)RL_REALLOC(lines.offsets, lines.count*sizeof(int));
+
+    return lines;
+}
+
+// Unload text lines start offsets
+void UnloadTextLineOffsets(TextLineOffsets lines)
+{
+    RL_FREE(lines.offsets);
+}
+
+// Load text layout: glyphs positioned with font kerning, wrapped to wrapWidth and reordered by bidi runs
+// NOTE: Lines are broken on '\n' and, if wrapWidth > 0, on the last space fitting the width
+// (or before the glyph overflowing it, for words longer than the width)
+// NOTE: Bidi is a simplified version of Unicode UAX #9: paragraph direction is taken from first strong
+// character, neutrals are resolved by surrounding characters, numbers are kept left-to-right and lines are
+// reordered by levels; explicit embeddings, Arabic shaping and brackets mirroring are not supported
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing, float wrapWidth)
+{
+    TextLayout layout = { 0 };
+
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+
+    layout.fontSize = fontSize;
+    layout.spacing = spacing;
+
+    if ((text == NULL) || (text[0] == '\0') || (font.glyphs == NULL)) return layout;
+
+    int size = TextLength(text);
+    int count = CountUTF8(text, size);
+
+    // Temporal codepoints data, in logical order
+    int *codepoints = (int *)RL_MALLOC(count*sizeof(int));
+    int *indices = (int *)RL_MALLOC(count*sizeof(int));
+    int *levels = (int *)RL_MALLOC(count*sizeof(int));
+    float *advances = (float *)RL_MALLOC(count*sizeof(float));
+    float *kernings = (float *)RL_MALLOC(count*sizeof(float));     // Kerning with previous codepoint
+    int *order = (int *)RL_MALLOC(count*sizeof(int));               // Line codepoints in visual order
+
+    DecodeUTF8(text, size, codepoints, count, &count);
+
+    // Layout data, allocated for the worst case and resized at the end
+    layout.glyphs = (TextGlyph *)RL_MALLOC(count*sizeof(TextGlyph));
+    layout.runs = (TextRun *)RL_MALLOC(count*sizeof(TextRun));
+    layout.lines = (TextLine *)RL_MALLOC((count + 1)*sizeof(TextLine));
+
+    float scaleFactor = fontSize/(float)font.baseSize;
+    float lineOffsetY = 0.0f;
+    int *paragraphLevels = (int *)RL_CALLOC(count + 1, sizeof(int)); // Paragraph level of every line
+
+    for (int paragraphStart = 0; paragraphStart <= count;)
+    {
+        int paragraphEnd = paragraphStart;
+        while ((paragraphEnd < count) && (codepoints[paragraphEnd] != '\n')) paragraphEnd++;
+
+        // Resolve paragraph level from first strong character
+        int paragraphLevel = 0;
+        for (int i = paragraphStart; i < paragraphEnd; i++)
+        {
+            int bidiClass = GetCodepointBidiClass(codepoints[i]);
+            if (bidiClass == BIDI_CLASS_LTR) break;
+            if (bidiClass == BIDI_CLASS_RTL) { paragraphLevel = 1; break; }
+        }
+
+        // Resolve characters directions: 0-LTR, 1-RTL, 2-Number after RTL (RTL for neutrals), -1-Neutral
+        // NOTE: order[] is used as temporal directions buffer, it is only required later for lines reordering
+        int lastStrong = paragraphLevel;
+        for (int i = paragraphStart; i < paragraphEnd; i++)
+        {
+            int bidiClass = GetCodepointBidiClass(codepoints[i]);
+
+            if (bidiClass == BIDI_CLASS_LTR) { order[i] = 0; lastStrong = 0; }
+            else if (bidiClass == BIDI_CLASS_RTL) { order[i] = 1; lastStrong = 1; }
+            else if (bidiClass == BIDI_CLASS_NUMBER) order[i] = (lastStrong == 0)? 0 : 2;
+            else order[i] = -1;
+        }
+
+        // Resolve neutrals: surrounded by same direction take that direction, paragraph direction otherwise
+        for (int i = paragraphStart; i < paragraphEnd; i++)
+        {
+            if (order[i] != -1) continue;
+
+            int neutralEnd = i;
+            while ((neutralEnd < paragraphEnd) && (order[neutralEnd] == -1)) neutralEnd++;
+
+            bool prevRTL = (i > paragraphStart)? (order[i - 1] != 0) : (paragraphLevel == 1);
+            bool nextRTL = (neutralEnd < paragraphEnd)? (order[neutralEnd] != 0) : (paragraphLevel == 1);
+            int direction = (prevRTL == nextRTL)? (prevRTL? 1 : 0) : paragraphLevel;
+
+            for (; i < neutralEnd; i++) order[i] = direction;
+        }
+
+        // Resolve levels: RTL on odd level, LTR and numbers on even level (over paragraph level)
+        for (int i = paragraphStart; i < paragraphEnd; i++)
+        {
+            if (order[i] == 1) levels[i] = 1;
+            else if (order[i] == 2) levels[i] = 2;
+            else levels[i] = (paragraphLevel == 0)? 0 : 2;
+        }
+
+        // Get glyphs advances and kerning between glyphs of the same direction
+        for (int i = paragraphStart; i < paragraphEnd; i++)
+        {
+            indices[i] = GetGlyphIndex(font, codepoints[i]);
+
+            if (font.glyphs[indices[i]].advanceX == 0) advances[i] = (float)font.recs[indices[i]].width*scaleFactor + spacing;
+            else advances[i] = (float)font.glyphs[indices[i]].advanceX*scaleFactor + spacing;
+
+            kernings[i] = 0.0f;
+            if ((i > paragraphStart) && ((levels[i - 1]%2) == (levels[i]%2)))
+            {
+                // NOTE: Kerning pairs are defined in logical order, also for right-to-left glyphs
+                kernings[i] = GetGlyphKerning(font, codepoints[i - 1], codepoints[i])*scaleFactor;
+            }
+        }
+
+        // Break paragraph into lines
+        int lineStart = paragraphStart;
+        int lastSpace = -1;
+        float lineWidth = 0.0f;
+
+        for (int i = paragraphStart; i <= paragraphEnd; i++)
+        {
+            bool isSpace = (i < paragraphEnd) && ((codepoints[i] == ' ') || (codepoints[i] == '\t'));
+            int lineEnd = -1;
+
+            if (i == paragraphEnd) lineEnd = paragraphEnd;
+            else if ((wrapWidth > 0.0f) && !isSpace && (i > lineStart) &&
+                     ((lineWidth + kernings[i] + advances[i] - spacing) > wrapWidth))
+            {
+                lineEnd = (lastSpace >= lineStart)? (lastSpace + 1) : i;
+            }
+
+            if (lineEnd != -1)
+            {
+                TextLine *line = &layout.lines[layout.lineCount];
+
+                // Trailing whitespace is not placed, it does not affect line width and alignment
+                int lineGlyphsEnd = lineEnd;
+                while ((lineGlyphsEnd > lineStart) && ((codepoints[lineGlyphsEnd - 1] == ' ') || (codepoints[lineGlyphsEnd - 1] == '\t'))) lineGlyphsEnd--;
+
+                // Reorder line codepoints in visual order: reverse sequences from highest level to lowest odd level
+                int maxLevel = 0;
+                for (int k = lineStart; k < lineGlyphsEnd; k++)
+                {
+                    order[k - lineStart] = k;
+                    if (levels[k] > maxLevel) maxLevel = levels[k];
+                }
+
+                for (int level = maxLevel; level >= 1; level--)
+                {
+                    for (int k = 0; k < (lineGlyphsEnd - lineStart);)
+                    {
+                        if (levels[order[k]] < level) { k++; continue; }
+
+                        int sequenceEnd = k;
+                        while ((sequenceEnd < (lineGlyphsEnd - lineStart)) && (levels[order[sequenceEnd]] >= level)) sequenceEnd++;
+
+                        for (int a = k, b = sequenceEnd - 1; a < b; a++, b--)
+                        {
+                            int temp = order[a];
+                            order[a] = order[b];
+                            order[b] = temp;
+                        }
+
+                        k = sequenceEnd;
+                    }
+                }
+
+                // Place glyphs in visual order and split them into runs
+                line->glyphStart = layout.glyphCount;
+                line->runStart = layout.runCount;
+
+                float offsetX = 0.0f;
+
+                for (int k = 0; k < (lineGlyphsEnd - lineStart); k++)
+                {
+                    int c = order[k];
+                    TextGlyph *glyph = &layout.glyphs[layout.glyphCount];
+
+                    glyph->value = codepoints[c];
+                    glyph->index = indices[c];
+                    glyph->position = (Vector2){ offsetX, lineOffsetY };
+
+                    if ((k == 0) || (levels[order[k - 1]] != levels[c]))
+                    {
+                        layout.runs[layout.runCount] = (TextRun){ layout.glyphCount, 0, levels[c] };
+                        layout.runCount++;
+                    }
+
+                    layout.runs[layout.runCount - 1].glyphCount++;
+                    layout.glyphCount++;
+
+                    // Kerning with next glyph in visual order: next logical glyph on left-to-right levels, previous one on right-to-left levels
+                    offsetX += advances[c];
+                    if (((levels[c]%2) == 0) && ((c + 1) < lineGlyphsEnd)) offsetX += kernings[c + 1];
+                    else if (((levels[c]%2) == 1) && (c > lineStart)) offsetX += kernings[c];
+                }
+
+                line->glyphCount = layout.glyphCount - line->glyphStart;
+                line->runCount = layout.runCount - line->runStart;
+                line->bounds = (Rectangle){ 0.0f, lineOffsetY, (line->glyphCount > 0)? (offsetX - spacing) : 0.0f, fontSize };
+
+                if (line->bounds.width > layout.size.x) layout.size.x = line->bounds.width;
+                layout.size.y = lineOffsetY + fontSize;
+
+                paragraphLevels[layout.lineCount] = paragraphLevel;
+                layout.lineCount++;
+
+                // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+                lineOffsetY += (fontSize + textLineSpacing);
+
+                // Start next line, measuring glyphs already passed
+                lineStart = lineEnd;
+                lastSpace = -1;
+                lineWidth = 0.0f;
+                for (int k = lineStart; k < i; k++) lineWidth += ((k > lineStart)? kernings[k] : 0.0f) + advances[k];
+            }
+
+            if (i < paragraphEnd)
+            {
+                lineWidth += ((i > lineStart)? kernings[i] : 0.0f) + advances[i];
+                if (isSpace) lastSpace = i;
+            }
+        }
+
+        paragraphStart = paragraphEnd + 1;
+    }
+
+    // Right-to-left paragraphs lines are aligned to the right
+    float alignWidth = (wrapWidth > 0.0f)? wrapWidth : layout.size.x;
+    if (wrapWidth > layout.size.x) layout.size.x = wrapWidth;
+
+    for (int i = 0; i < layout.lineCount; i++)
+    {
+        if (paragraphLevels[i] == 0) continue;
+
+        TextLine *line = &layout.lines[i];
+        line->bounds.x = alignWidth - line->bounds.width;
+        for (int k = 0; k < line->glyphCount; k++) layout.glyphs[line->glyphStart + k].position.x += line->bounds.x;
+    }
+
+    RL_FREE(paragraphLevels);
+    RL_FREE(codepoints);
+    RL_FREE(indices);
+    RL_FREE(levels);
+    RL_FREE(advances);
+    RL_FREE(kernings);
+    RL_FREE(order);
+
+    // Resize layout data to the actual number of elements
+    if (layout.glyphCount > 0) layout.glyphs = (TextGlyph *)RL_REALLOC(layout.glyphs, layout.glyphCount*sizeof(TextGlyph));
+    if (layout.runCount > 0) layout.runs = (TextRun *)RL_REALLOC(layout.runs, layout.runCount*sizeof(TextRun));
+    layout.lines = (TextLine *)RL_REALLOC(layout.lines, layout.lineCount*sizeof(TextLine));
+
+    return layout;
+}
+
+// Unload text layout data
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.glyphs);
+    RL_FREE(layout.runs);
+    RL_FREE(layout.lines);
+}
+
+// Draw text layout
+// NOTE: Font must be the same used to load the layout, glyphs indices are not validated
+void DrawTextLayout(Font font, TextLayout layout, Vector2 position, Color tint)
+{
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+
+    bool fontShader = BeginFontShader(font);
+
+    for (int i = 0; i < layout.glyphCount; i++)
+    {
+        const TextGlyph *glyph = &layout.glyphs[i];
+
+        if ((glyph->value != ' ') && (glyph->value != '\t'))
+        {
+            DrawGlyph(font, glyph->index, (Vector2){ position.x + glyph->position.x, position.y + glyph->position.y }, layout.fontSize, tint);
+        }
+    }
+
+    EndFontShader(fontShader);
+}
+
+// Draw text layout, only lines and glyphs overlapping clip rectangle are drawn
+// NOTE: First visible line is found by binary search on lines bounds, cost depends
+// on visible lines only, glyphs partially inside are drawn whole
+void DrawTextLayoutClipped(Font font, TextLayout layout, Vector2 position, Rectangle clip, Color tint)
+{
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+
+    // Clip rectangle relative to layout origin
+    Rectangle localClip = { clip.x - position.x, clip.y - position.y, clip.width, clip.height };
+
+    // Find first line with bottom below clip top, lines are sorted top to bottom
+    int first = 0;
+    int last = layout.lineCount;
+
+    while (first < last)
+    {
+        int middle = first + (last - first)/2;
+
+        if ((layout.lines[middle].bounds.y + layout.lines[middle].bounds.height) <= localClip.y) first = middle + 1;
+        else last = middle;
+    }
+
+    bool fontShader = BeginFontShader(font);
+
+    for (int l = first; l < layout.lineCount; l++)
+    {
+        const TextLine *line = &layout.lines[l];
+
+        if (line->bounds.y >= (localClip.y + localClip.height)) break;
+
+        // Skip lines horizontally outside clip rectangle
+        if ((line->bounds.x >= (localClip.x + localClip.width)) || ((line->bounds.x + line->bounds.width) <= localClip.x)) continue;
+
+        for (int i = line->glyphStart; i < (line->glyphStart + line->glyphCount); i++)
+        {
+            const TextGlyph *glyph = &layout.glyphs[i];
+
+            if ((glyph->value != ' ') && (glyph->value != '\t') && CheckGlyphClip(font, glyph->index, glyph->position, layout.fontSize, localClip))
+            {
+                DrawGlyph(font, glyph->index, (Vector2){ position.x + glyph->position.x, position.y + glyph->position.y }, layout.fontSize, tint);
+            }
+        }
+    }
+
+    EndFontShader(fontShader);
+}
+
+//----------------------------------------------------------------------------------
+// Text strings management functions
+//----------------------------------------------------------------------------------
+// Get text length in bytes, check for \0 character
+unsigned int TextLength(const char *text)
+{
+    unsigned int length = 0;
+
+    // NOTE: strlen() is vectorized by the C library, it scans text in word/SIMD blocks
+    if (text != NULL) length = (unsigned int)strlen(text);
+
+    return length;
+}
+
+// Formatting of text with variables to 'embed'
+// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
+const char *TextFormat(const char *text, ...)
+{
+#ifndef MAX_TEXTFORMAT_BUFFERS
+    #define MAX_TEXTFORMAT_BUFFERS 4        // Maximum number of static buffers for text formatting
+#endif
+
+    // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
+    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static int index = 0;
+
+    char *currentBuffer = buffers[index];
+    memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
+
+    va_list args;
+    va_start(args, text);
+    int requiredByteCount = vsnprintf(currentBuffer, MAX_TEXT_BUFFER_LENGTH, text, args);
+    va_end(args);
+
+    // If requiredByteCount is larger than the MAX_TEXT_BUFFER_LENGTH, then overflow occured
+    if (requiredByteCount >= MAX_TEXT_BUFFER_LENGTH)
+    {
+        // Inserting "..." at the end of the string to mark as truncated
+        char *truncBuffer = buffers[index] + MAX_TEXT_BUFFER_LENGTH - 4; // Adding 4 bytes = "...\0"
+        sprintf(truncBuffer, "...");
+    }
+
+    index += 1;     // Move to next buffer for next function call
+    if (index >= MAX_TEXTFORMAT_BUFFERS) index = 0;
+
+    return currentBuffer;
 }
 
 // Get integer value from text
@@ -1879,20 +2607,11 @@ int *LoadCodepoints(const char *text, int *count)
 {
     int textLength = TextLength(text);
 
-    int codepointSize = 0;
-    int codepointCount = 0;
-
-    // Allocate a big enough buffer to store as many codepoints as text bytes
-    int *codepoints = (int *)RL_CALLOC(textLength, sizeof(int));
-
-    for (int i = 0; i < textLength; codepointCount++)
-    {
-        codepoints[codepointCount] = GetCodepointNext(text + i, &codepointSize);
-        i += codepointSize;
-    }
+    // Count codepoints first to allocate the exact buffer size required
+    int codepointCount = CountUTF8(text, textLength);
+    int *codepoints = (int *)RL_CALLOC((codepointCount > 0)? codepointCount : 1, sizeof(int));
 
-    // Re-allocate buffer to the actual number of codepoints loaded
-    codepoints = (int *)RL_REALLOC(codepoints, codepointCount*sizeof(int));
+    DecodeUTF8(text, textLength, codepoints, codepointCount, &codepointCount);
 
     *count = codepointCount;
 
@@ -1909,20 +2628,7 @@ void UnloadCodepoints(int *codepoints)
 // NOTE: If an invalid UTF-8 sequence is encountered a '?'(0x3f) codepoint is counted instead
 int GetCodepointCount(const char *text)
 {
-    unsigned int length = 0;
-    char *ptr = (char *)&text[0];
-
-    while (*ptr != '\0')
-    {
-        int next = 0;
-        GetCodepointNext(ptr, &next);
-
-        ptr += next;
-
-        length++;
-    }
-
-    return length;
+    return CountUTF8(text, TextLength(text));
 }
 
 // Encode codepoint into utf8 text (char array length returned as parameter)
@@ -2135,71 +2841,1228 @@ int GetCodepointPrevious(const char *text, int *codepointSize)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
-// Read a line from memory
-// REQUIRES: memcpy()
-// NOTE: Returns the number of bytes read
-static int GetLine(const char *origin, char *buffer, int maxLength)
-{
-    int count = 0;
-    for (; count < maxLength - 1; count++) if (origin[count] == '\n') break;
-    memcpy(buffer, origin, count);
-    buffer[count] = '\0';
-    return count;
-}
-#endif
-
-#if defined(SUPPORT_FILEFORMAT_FNT)
-// Load a BMFont file (AngelCode font file)
-// REQUIRES: strstr(), sscanf(), strrchr(), memcpy()
-static Font LoadBMFont(const char *fileName)
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load one font glyph (job), image data generated depending on font type
+static void LoadFontGlyphJob(void *data, int i)
 {
-    #define MAX_BUFFER_SIZE       256
-    #define MAX_FONT_IMAGE_PAGES    8
+    FontGlyphsJob *job = (FontGlyphsJob *)data;
 
-    Font font = { 0 };
+    int chw = 0, chh = 0;   // Character width and height (on generation)
+    int ch = job->codepoints[i];  // Character value to get info for
+    job->glyphs[i].value = ch;
 
-    char buffer[MAX_BUFFER_SIZE] = { 0 };
-    char *searchPoint = NULL;
+    //  Render a unicode codepoint to a bitmap
+    //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+    //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+    //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
 
-    int fontSize = 0;
-    int glyphCount = 0;
+    // Check if a glyph is available in the font
+    // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
+    int index = stbtt_FindGlyphIndex(job->fontInfo, ch);
 
-    int imWidth = 0;
-    int imHeight = 0;
-    int pageCount = 1;
-    char imFileName[MAX_FONT_IMAGE_PAGES][129] = { 0 };
+    if (index > 0)
+    {
+        switch (job->type)
+        {
+            case FONT_DEFAULT:
+            case FONT_BITMAP: job->glyphs[i].image.data = stbtt_GetCodepointBitmap(job->fontInfo, job->scaleFactor, job->scaleFactor, ch, &chw, &chh, &job->glyphs[i].offsetX, &job->glyphs[i].offsetY); break;
+            case FONT_SDF: if (ch != 32) job->glyphs[i].image.data = stbtt_GetCodepointSDF(job->fontInfo, job->scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &job->glyphs[i].offsetX, &job->glyphs[i].offsetY); break;
+            case FONT_MSDF: if (ch != 32) job->glyphs[i].image.data = GenGlyphMSDF(job->fontInfo, index, job->scaleFactor, FONT_MSDF_CHAR_PADDING, FONT_MSDF_PIXEL_RANGE, &chw, &chh, &job->glyphs[i].offsetX, &job->glyphs[i].offsetY); break;
+            default: break;
+        }
 
-    int base = 0;       // Useless data
-    int readBytes = 0;  // Data bytes read
-    int readVars = 0;   // Variables filled by sscanf()
+        if (job->glyphs[i].image.data != NULL)    // Glyph data has been found in the font
+        {
+            stbtt_GetCodepointHMetrics(job->fontInfo, ch, &job->glyphs[i].advanceX, NULL);
+            job->glyphs[i].advanceX = (int)((float)job->glyphs[i].advanceX*job->scaleFactor);
 
-    char *fileText = LoadFileText(fileName);
+            if (chh > job->fontSize) TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] size is bigger than expected font size", ch);
 
-    if (fileText == NULL) return font;
+            // Load characters images
+            job->glyphs[i].image.width = chw;
+            job->glyphs[i].image.height = chh;
+            job->glyphs[i].image.mipmaps = 1;
+            job->glyphs[i].image.format = (job->type == FONT_MSDF)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
 
-    char *fileTextPtr = fileText;
+            job->glyphs[i].offsetY += (int)((float)job->ascent*job->scaleFactor);
+        }
 
-    // NOTE: We skip first line, it contains no useful information
-    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-    fileTextPtr += (readBytes + 1);
+        // NOTE: We create an empty image for space character,
+        // it could be further required for atlas packing
+        if (ch == 32)
+        {
+            stbtt_GetCodepointHMetrics(job->fontInfo, ch, &job->glyphs[i].advanceX, NULL);
+            job->glyphs[i].advanceX = (int)((float)job->glyphs[i].advanceX*job->scaleFactor);
 
-    // Read line data
-    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-    searchPoint = strstr(buffer, "lineHeight");
-    readVars = sscanf(searchPoint, "lineHeight=%i base=%i scaleW=%i scaleH=%i pages=%i", &fontSize, &base, &imWidth, &imHeight, &pageCount);
-    fileTextPtr += (readBytes + 1);
+            Image imSpace = {
+                .data = RL_CALLOC(job->glyphs[i].advanceX*job->fontSize, (job->type == FONT_MSDF)? 3 : 2),
+                .width = job->glyphs[i].advanceX,
+                .height = job->fontSize,
+                .mipmaps = 1,
+                .format = (job->type == FONT_MSDF)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+            };
 
-    if (readVars < 4) { UnloadFileText(fileText); return font; } // Some data not available, file malformed
+            job->glyphs[i].image = imSpace;
+        }
 
-    if (pageCount > MAX_FONT_IMAGE_PAGES)
-    {
-        TRACELOG(LOG_WARNING, "FONT: [%s] Font defines more pages than supported: %i/%i", fileName, pageCount, MAX_FONT_IMAGE_PAGES);
-        pageCount = MAX_FONT_IMAGE_PAGES;
+        if (job->type == FONT_BITMAP)
+        {
+            // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+            // NOTE: For optimum results, bitmap font should be generated at base pixel size
+            for (int p = 0; p < chw*chh; p++)
+            {
+                if (((unsigned char *)job->glyphs[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)job->glyphs[i].image.data)[p] = 0;
+                else ((unsigned char *)job->glyphs[i].image.data)[p] = 255;
+            }
+        }
     }
 
-    for (int i = 0; i < pageCount; i++)
-    {
+}
+
+// Solve quadratic equation: a*x^2 + b*x + c = 0, returns number of solutions (-1: infinite)
+static int SolveQuadraticMSDF(double x[2], double a, double b, double c)
+{
+    if ((a == 0.0) || (fabs(b) > 1e12*fabs(a)))
+    {
+        if (b == 0.0) return (c == 0.0)? -1 : 0;
+
+        x[0] = -c/b;
+        return 1;
+    }
+
+    double discriminant = b*b - 4.0*a*c;
+
+    if (discriminant > 0.0)
+    {
+        discriminant = sqrt(discriminant);
+        x[0] = (-b + discriminant)/(2.0*a);
+        x[1] = (-b - discriminant)/(2.0*a);
+        return 2;
+    }
+    else if (discriminant == 0.0)
+    {
+        x[0] = -b/(2.0*a);
+        return 1;
+    }
+
+    return 0;
+}
+
+// Solve cubic equation: a*x^3 + b*x^2 + c*x + d = 0, returns number of solutions (-1: infinite)
+static int SolveCubicMSDF(double x[3], double a, double b, double c, double d)
+{
+    if (a != 0.0)
+    {
+        double bn = b/a;
+
+        if (fabs(bn) < 1e6)
+        {
+            // Normalized cubic: x^3 + a*x^2 + b*x + c = 0
+            double an = bn;
+            double cn = c/a;
+            double dn = d/a;
+            double a2 = an*an;
+            double q = (a2 - 3.0*cn)/9.0;
+            double r = (an*(2.0*a2 - 9.0*cn) + 27.0*dn)/54.0;
+            double r2 = r*r;
+            double q3 = q*q*q;
+
+            an /= 3.0;
+
+            if (r2 < q3)
+            {
+                double t = r/sqrt(q3);
+                if (t < -1.0) t = -1.0;
+                if (t > 1.0) t = 1.0;
+                t = acos(t);
+                q = -2.0*sqrt(q);
+                x[0] = q*cos(t/3.0) - an;
+                x[1] = q*cos((t + 2.0*PI)/3.0) - an;
+                x[2] = q*cos((t - 2.0*PI)/3.0) - an;
+                return 3;
+            }
+            else
+            {
+                double u = ((r < 0.0)? 1.0 : -1.0)*pow(fabs(r) + sqrt(r2 - q3), 1.0/3.0);
+                double v = (u == 0.0)? 0.0 : q/u;
+
+                x[0] = (u + v) - an;
+
+                if ((u == v) || (fabs(u - v) < 1e-12*fabs(u + v)))
+                {
+                    x[1] = -0.5*(u + v) - an;
+                    return 2;
+                }
+
+                return 1;
+            }
+        }
+    }
+
+    return SolveQuadraticMSDF(x, b, c, d);
+}
+
+// Get edge point at parameter t
+static void GetEdgePointMSDF(const MsdfEdge *edge, double t, double point[2])
+{
+    for (int k = 0; k < 2; k++)
+    {
+        if (edge->degree == 1) point[k] = edge->p[0][k] + t*(edge->p[1][k] - edge->p[0][k]);
+        else point[k] = (1.0 - t)*(1.0 - t)*edge->p[0][k] + 2.0*(1.0 - t)*t*edge->p[1][k] + t*t*edge->p[2][k];
+    }
+}
+
+// Get edge direction (tangent) at parameter t
+static void GetEdgeDirectionMSDF(const MsdfEdge *edge, double t, double direction[2])
+{
+    for (int k = 0; k < 2; k++)
+    {
+        if (edge->degree == 1) direction[k] = edge->p[1][k] - edge->p[0][k];
+        else direction[k] = (1.0 - t)*(edge->p[1][k] - edge->p[0][k]) + t*(edge->p[2][k] - edge->p[1][k]);
+    }
+
+    // Degenerated quadratic control point, use chord direction
+    if ((direction[0] == 0.0) && (direction[1] == 0.0) && (edge->degree == 2))
+    {
+        direction[0] = edge->p[2][0] - edge->p[0][0];
+        direction[1] = edge->p[2][1] - edge->p[0][1];
+    }
+}
+
+// Get signed distance from point to edge, nearest point parameter returned (out of [0..1] if nearest is an endpoint)
+// NOTE: Distances are compared by absolute value first and, if equal, by dot value (edge orthogonality)
+static MsdfDistance GetEdgeDistanceMSDF(const MsdfEdge *edge, const double origin[2], double *param)
+{
+    MsdfDistance result = { 0 };
+
+    if (edge->degree == 1)
+    {
+        double aq[2] = { origin[0] - edge->p[0][0], origin[1] - edge->p[0][1] };
+        double ab[2] = { edge->p[1][0] - edge->p[0][0], edge->p[1][1] - edge->p[0][1] };
+        double abLength = sqrt(ab[0]*ab[0] + ab[1]*ab[1]);
+        double t = (aq[0]*ab[0] + aq[1]*ab[1])/(ab[0]*ab[0] + ab[1]*ab[1]);
+        const double *end = (t > 0.5)? edge->p[1] : edge->p[0];
+        double eq[2] = { end[0] - origin[0], end[1] - origin[1] };
+        double endpointDistance = sqrt(eq[0]*eq[0] + eq[1]*eq[1]);
+
+        *param = t;
+
+        if ((t > 0.0) && (t < 1.0))
+        {
+            double orthoDistance = (ab[1]*aq[0] - ab[0]*aq[1])/abLength;
+
+            if (fabs(orthoDistance) < endpointDistance)
+            {
+                result.distance = orthoDistance;
+                result.dot = 0.0;
+                return result;
+            }
+        }
+
+        double cross = aq[0]*ab[1] - aq[1]*ab[0];
+        result.distance = ((cross >= 0.0)? 1.0 : -1.0)*endpointDistance;
+        result.dot = (endpointDistance > 0.0)? fabs((ab[0]*eq[0] + ab[1]*eq[1])/(abLength*endpointDistance)) : 0.0;
+    }
+    else
+    {
+        double qa[2] = { edge->p[0][0] - origin[0], edge->p[0][1] - origin[1] };
+        double ab[2] = { edge->p[1][0] - edge->p[0][0], edge->p[1][1] - edge->p[0][1] };
+        double br[2] = { edge->p[2][0] - edge->p[1][0] - ab[0], edge->p[2][1] - edge->p[1][1] - ab[1] };
+
+        double a = br[0]*br[0] + br[1]*br[1];
+        double b = 3.0*(ab[0]*br[0] + ab[1]*br[1]);
+        double c = 2.0*(ab[0]*ab[0] + ab[1]*ab[1]) + (qa[0]*br[0] + qa[1]*br[1]);
+        double d = qa[0]*ab[0] + qa[1]*ab[1];
+        double t[3] = { 0 };
+        int solutions = SolveCubicMSDF(t, a, b, c, d);
+
+        // Distance to start point
+        double direction[2] = { 0 };
+        GetEdgeDirectionMSDF(edge, 0.0, direction);
+        double distanceA = sqrt(qa[0]*qa[0] + qa[1]*qa[1]);
+        double minDistance = (((direction[0]*qa[1] - direction[1]*qa[0]) >= 0.0)? 1.0 : -1.0)*distanceA;
+        *param = -(qa[0]*direction[0] + qa[1]*direction[1])/(direction[0]*direction[0] + direction[1]*direction[1]);
+
+        // Distance to end point
+        GetEdgeDirectionMSDF(edge, 1.0, direction);
+        double qc[2] = { edge->p[2][0] - origin[0], edge->p[2][1] - origin[1] };
+        double distanceC = sqrt(qc[0]*qc[0] + qc[1]*qc[1]);
+
+        if (distanceC < fabs(minDistance))
+        {
+            minDistance = (((direction[0]*qc[1] - direction[1]*qc[0]) >= 0.0)? 1.0 : -1.0)*distanceC;
+            *param = ((origin[0] - edge->p[1][0])*direction[0] + (origin[1] - edge->p[1][1])*direction[1])/(direction[0]*direction[0] + direction[1]*direction[1]);
+        }
+
+        // Distance to curve inner points
+        for (int i = 0; i < solutions; i++)
+        {
+            if ((t[i] > 0.0) && (t[i] < 1.0))
+            {
+                double qe[2] = { qa[0] + 2.0*t[i]*ab[0] + t[i]*t[i]*br[0], qa[1] + 2.0*t[i]*ab[1] + t[i]*t[i]*br[1] };
+                double distance = sqrt(qe[0]*qe[0] + qe[1]*qe[1]);
+
+                if (distance <= fabs(minDistance))
+                {
+                    double tangent[2] = { ab[0] + t[i]*br[0], ab[1] + t[i]*br[1] };
+                    minDistance = (((tangent[0]*qe[1] - tangent[1]*qe[0]) >= 0.0)? 1.0 : -1.0)*distance;
+                    *param = t[i];
+                }
+            }
+        }
+
+        result.distance = minDistance;
+
+        if ((*param >= 0.0) && (*param <= 1.0)) result.dot = 0.0;
+        else
+        {
+            double endpointVector[2] = { 0 };
+            double endpoint[2] = { 0 };
+            GetEdgeDirectionMSDF(edge, (*param < 0.5)? 0.0 : 1.0, direction);
+            GetEdgePointMSDF(edge, (*param < 0.5)? 0.0 : 1.0, endpoint);
+            endpointVector[0] = endpoint[0] - origin[0];
+            endpointVector[1] = endpoint[1] - origin[1];
+
+            double lengths = sqrt(direction[0]*direction[0] + direction[1]*direction[1])*sqrt(endpointVector[0]*endpointVector[0] + endpointVector[1]*endpointVector[1]);
+            result.dot = (lengths > 0.0)? fabs((direction[0]*endpointVector[0] + direction[1]*endpointVector[1])/lengths) : 0.0;
+        }
+    }
+
+    return result;
+}
+
+// Convert edge distance to pseudo-distance: distance to the edge extended by its endpoints tangents
+// NOTE: It keeps corners sharp when channels are combined by median
+static void ApplyPseudoDistanceMSDF(const MsdfEdge *edge, MsdfDistance *distance, const double origin[2], double param)
+{
+    if ((param >= 0.0) && (param <= 1.0)) return;
+
+    double direction[2] = { 0 };
+    double endpoint[2] = { 0 };
+
+    GetEdgeDirectionMSDF(edge, (param < 0.0)? 0.0 : 1.0, direction);
+    GetEdgePointMSDF(edge, (param < 0.0)? 0.0 : 1.0, endpoint);
+
+    double length = sqrt(direction[0]*direction[0] + direction[1]*direction[1]);
+    if (length == 0.0) return;
+
+    direction[0] /= length;
+    direction[1] /= length;
+
+    double q[2] = { origin[0] - endpoint[0], origin[1] - endpoint[1] };
+    double ts = q[0]*direction[0] + q[1]*direction[1];
+
+    if (((param < 0.0) && (ts < 0.0)) || ((param > 1.0) && (ts > 0.0)))
+    {
+        double pseudoDistance = q[0]*direction[1] - q[1]*direction[0];
+
+        if (fabs(pseudoDistance) <= fabs(distance->distance))
+        {
+            distance->distance = pseudoDistance;
+            distance->dot = 0.0;
+        }
+    }
+}
+
+// Switch edge color, avoiding banned channel (msdfgen edge coloring)
+static void SwitchColorMSDF(int *color, unsigned int *seed, int banned)
+{
+    int combined = *color & banned;
+
+    if ((combined == MSDF_RED) || (combined == MSDF_GREEN) || (combined == MSDF_BLUE)) *color = combined ^ MSDF_WHITE;
+    else if ((*color == 0) || (*color == MSDF_WHITE))
+    {
+        static const int colors[3] = { MSDF_CYAN, MSDF_MAGENTA, MSDF_YELLOW };
+        *color = colors[*seed%3];
+        *seed /= 3;
+    }
+    else
+    {
+        int shifted = *color << (1 + (*seed & 1));
+        *color = (shifted | (shifted >> 3)) & MSDF_WHITE;
+        *seed >>= 1;
+    }
+}
+
+// Assign edges colors: contour splines between corners get different two-channel colors,
+// every channel distance is computed only with its colored edges so corners are preserved
+static void ColorEdgesMSDF(MsdfEdge *edges, const int *contourEnds, int contourCount)
+{
+    #define MSDF_CORNER_ANGLE_THRESHOLD     3.0     // Angle threshold (radians) to consider a corner between edges
+
+    double crossThreshold = sin(MSDF_CORNER_ANGLE_THRESHOLD);
+    unsigned int seed = 0;
+
+    for (int c = 0, start = 0; c < contourCount; start = contourEnds[c], c++)
+    {
+        int count = contourEnds[c] - start;
+        if (count <= 0) continue;
+
+        MsdfEdge *contour = &edges[start];
+
+        // Find contour corners
+        int cornerCount = 0;
+        int firstCorner = -1;
+        int *corners = (int *)RL_MALLOC(count*sizeof(int));
+        double prevDirection[2] = { 0 };
+        GetEdgeDirectionMSDF(&contour[count - 1], 1.0, prevDirection);
+
+        for (int i = 0; i < count; i++)
+        {
+            double direction[2] = { 0 };
+            GetEdgeDirectionMSDF(&contour[i], 0.0, direction);
+
+            double lengths = sqrt(prevDirection[0]*prevDirection[0] + prevDirection[1]*prevDirection[1])*sqrt(direction[0]*direction[0] + direction[1]*direction[1]);
+
+            if (lengths > 0.0)
+            {
+                double dot = (prevDirection[0]*direction[0] + prevDirection[1]*direction[1])/lengths;
+                double cross = (prevDirection[0]*direction[1] - prevDirection[1]*direction[0])/lengths;
+
+                if ((dot <= 0.0) || (fabs(cross) > crossThreshold))
+                {
+                    if (firstCorner == -1) firstCorner = i;
+                    corners[cornerCount++] = i;
+                }
+            }
+
+            GetEdgeDirectionMSDF(&contour[i], 1.0, prevDirection);
+        }
+
+        if (cornerCount == 0)
+        {
+            // Smooth contour, all channels share the edges
+            for (int i = 0; i < count; i++) contour[i].color = MSDF_WHITE;
+        }
+        else if (cornerCount == 1)
+        {
+            // Teardrop contour, split in three parts with different colors
+            int colors[3] = { MSDF_WHITE, MSDF_WHITE, MSDF_WHITE };
+            int color = MSDF_WHITE;
+            SwitchColorMSDF(&color, &seed, 0);
+            colors[0] = color;
+            SwitchColorMSDF(&color, &seed, 0);
+            colors[2] = color;
+
+            for (int i = 0; i < count; i++)
+            {
+                int part = (count > 1)? (int)(3.0 + 2.875*i/(count - 1) - 1.4375 + 0.5) - 3 : 0;
+                contour[(firstCorner + i)%count].color = colors[1 + part];
+            }
+        }
+        else
+        {
+            // Multiple corners, switch color on every corner
+            int spline = 0;
+            int color = MSDF_WHITE;
+            SwitchColorMSDF(&color, &seed, 0);
+            int initialColor = color;
+
+            for (int i = 0; i < count; i++)
+            {
+                int index = (firstCorner + i)%count;
+
+                if (((spline + 1) < cornerCount) && (corners[spline + 1] == index))
+                {
+                    spline++;
+                    SwitchColorMSDF(&color, &seed, (spline == (cornerCount - 1))? initialColor : 0);
+                }
+
+                contour[index].color = color;
+            }
+        }
+
+        RL_FREE(corners);
+    }
+}
+
+// Generate multi-channel signed distance field (MSDF) for a glyph, returns R8G8B8 pixel data
+// NOTE: Glyph outline is read from font, cubic curves (CFF fonts) are approximated by lines,
+// channels not matching true distance sign (edge coloring clashes) are replaced by true distance
+static unsigned char *GenGlyphMSDF(const stbtt_fontinfo *fontInfo, int glyphIndex, float scale, int padding, float pixelRange, int *width, int *height, int *offsetX, int *offsetY)
+{
+    #define MSDF_CUBIC_SEGMENTS     8       // Number of lines to approximate cubic curves
+
+    unsigned char *pixels = NULL;
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+
+    stbtt_GetGlyphBitmapBox(fontInfo, glyphIndex, scale, scale, &x0, &y0, &x1, &y1);
+
+    stbtt_vertex *vertices = NULL;
+    int vertexCount = stbtt_GetGlyphShape(fontInfo, glyphIndex, &vertices);
+
+    if ((vertexCount <= 0) || (x1 <= x0) || (y1 <= y0))
+    {
+        if (vertices != NULL) stbtt_FreeShape(fontInfo, vertices);
+        return NULL;
+    }
+
+    // Load glyph outline edges, in font units
+    MsdfEdge *edges = (MsdfEdge *)RL_CALLOC(vertexCount*MSDF_CUBIC_SEGMENTS + vertexCount, sizeof(MsdfEdge));
+    int *contourEnds = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    int edgeCount = 0;
+    int contourCount = 0;
+    double start[2] = { 0 };
+    double current[2] = { 0 };
+
+    for (int i = 0; i < vertexCount; i++)
+    {
+        const stbtt_vertex *v = &vertices[i];
+        double next[2] = { v->x, v->y };
+
+        if (v->type == STBTT_vmove)
+        {
+            // Close previous contour if required
+            if ((edgeCount > 0) && ((current[0] != start[0]) || (current[1] != start[1])))
+            {
+                edges[edgeCount++] = (MsdfEdge){ { { current[0], current[1] }, { start[0], start[1] } }, 1, MSDF_WHITE };
+            }
+
+            if ((edgeCount > 0) && ((contourCount == 0) || (contourEnds[contourCount - 1] != edgeCount))) contourEnds[contourCount++] = edgeCount;
+
+            start[0] = next[0];
+            start[1] = next[1];
+        }
+        else if ((current[0] != next[0]) || (current[1] != next[1]) || (v->type != STBTT_vline))
+        {
+            if (v->type == STBTT_vline) edges[edgeCount++] = (MsdfEdge){ { { current[0], current[1] }, { next[0], next[1] } }, 1, MSDF_WHITE };
+            else if (v->type == STBTT_vcurve) edges[edgeCount++] = (MsdfEdge){ { { current[0], current[1] }, { v->cx, v->cy }, { next[0], next[1] } }, 2, MSDF_WHITE };
+            else if (v->type == STBTT_vcubic)
+            {
+                double prev[2] = { current[0], current[1] };
+
+                for (int s = 1; s <= MSDF_CUBIC_SEGMENTS; s++)
+                {
+                    double t = (double)s/MSDF_CUBIC_SEGMENTS;
+                    double it = 1.0 - t;
+                    double point[2] = {
+                        it*it*it*current[0] + 3.0*it*it*t*v->cx + 3.0*it*t*t*v->cx1 + t*t*t*next[0],
+                        it*it*it*current[1] + 3.0*it*it*t*v->cy + 3.0*it*t*t*v->cy1 + t*t*t*next[1]
+                    };
+
+                    edges[edgeCount++] = (MsdfEdge){ { { prev[0], prev[1] }, { point[0], point[1] } }, 1, MSDF_WHITE };
+                    prev[0] = point[0];
+                    prev[1] = point[1];
+                }
+            }
+        }
+
+        current[0] = next[0];
+        current[1] = next[1];
+    }
+
+    if ((edgeCount > 0) && ((current[0] != start[0]) || (current[1] != start[1])))
+    {
+        edges[edgeCount++] = (MsdfEdge){ { { current[0], current[1] }, { start[0], start[1] } }, 1, MSDF_WHITE };
+    }
+    if ((edgeCount > 0) && ((contourCount == 0) || (contourEnds[contourCount - 1] != edgeCount))) contourEnds[contourCount++] = edgeCount;
+
+    stbtt_FreeShape(fontInfo, vertices);
+
+    ColorEdgesMSDF(edges, contourEnds, contourCount);
+
+    *width = x1 - x0 + 2*padding;
+    *height = y1 - y0 + 2*padding;
+    *offsetX = x0 - padding;
+    *offsetY = y0 - padding;
+
+    pixels = (unsigned char *)RL_MALLOC((*width)*(*height)*3);
+
+    for (int y = 0; y < *height; y++)
+    {
+        for (int x = 0; x < *width; x++)
+        {
+            // Pixel center in font units (font Y axis points up)
+            double origin[2] = { (x0 - padding + x + 0.5)/scale, -(y0 - padding + y + 0.5)/scale };
+
+            MsdfDistance minDistance[3] = { { -1e240, 1.0 }, { -1e240, 1.0 }, { -1e240, 1.0 } };
+            int nearEdge[3] = { -1, -1, -1 };
+            double nearParam[3] = { 0 };
+            MsdfDistance trueDistance = { -1e240, 1.0 };
+
+            for (int e = 0; e < edgeCount; e++)
+            {
+                double param = 0.0;
+                MsdfDistance distance = GetEdgeDistanceMSDF(&edges[e], origin, &param);
+
+                for (int c = 0; c < 3; c++)
+                {
+                    if ((edges[e].color & (1 << c)) &&
+                        ((fabs(distance.distance) < fabs(minDistance[c].distance)) ||
+                         ((fabs(distance.distance) == fabs(minDistance[c].distance)) && (distance.dot < minDistance[c].dot))))
+                    {
+                        minDistance[c] = distance;
+                        nearEdge[c] = e;
+                        nearParam[c] = param;
+                    }
+                }
+
+                if ((fabs(distance.distance) < fabs(trueDistance.distance)) ||
+                    ((fabs(distance.distance) == fabs(trueDistance.distance)) && (distance.dot < trueDistance.dot))) trueDistance = distance;
+            }
+
+            double channels[3] = { 0 };
+            for (int c = 0; c < 3; c++)
+            {
+                if (nearEdge[c] >= 0) ApplyPseudoDistanceMSDF(&edges[nearEdge[c]], &minDistance[c], origin, nearParam[c]);
+                channels[c] = minDistance[c].distance;
+            }
+
+            // Check median sign against true distance sign, fix channels clashes
+            double median = fmax(fmin(channels[0], channels[1]), fmin(fmax(channels[0], channels[1]), channels[2]));
+            if ((median < 0.0) != (trueDistance.distance < 0.0)) channels[0] = channels[1] = channels[2] = trueDistance.distance;
+
+            for (int c = 0; c < 3; c++)
+            {
+                // NOTE: Distance is positive inside the glyph (TrueType outer contours are clockwise), value > 0.5 inside
+                double value = 0.5 + channels[c]*scale/pixelRange;
+                if (value < 0.0) value = 0.0;
+                if (value > 1.0) value = 1.0;
+
+                pixels[(y*(*width) + x)*3 + c] = (unsigned char)(value*255.0 + 0.5);
+            }
+        }
+    }
+
+    RL_FREE(contourEnds);
+    RL_FREE(edges);
+
+    return pixels;
+}
+
+// Load kerning pairs for loaded glyphs from TTF data, pairs sorted by first and second codepoints
+// NOTE: Pairs are read from the 'GPOS' table pair adjustment lookups if available, otherwise from the 'kern' table,
+// same tables priority than stbtt_GetGlyphKernAdvance(), pairs are not checked one by one
+static GlyphKerning *LoadFontKerningTTF(const unsigned char *fileData, int fontSize, const GlyphInfo *glyphs, int glyphCount, int *kerningCount)
+{
+    GlyphKerning *kernings = NULL;
+    stbtt_fontinfo fontInfo = { 0 };
+
+    *kerningCount = 0;
+
+    if (!stbtt_InitFont(&fontInfo, (unsigned char *)fileData, 0)) return NULL;
+
+    float scaleFactor = stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize);
+
+    // Get font glyph index for every loaded glyph
+    int *glyphIndices = (int *)RL_MALLOC(glyphCount*sizeof(int));
+    for (int i = 0; i < glyphCount; i++) glyphIndices[i] = stbtt_FindGlyphIndex(&fontInfo, glyphs[i].value);
+
+    if (fontInfo.gpos) kernings = LoadFontKerningGPOS(&fontInfo, glyphIndices, glyphs, glyphCount, scaleFactor, kerningCount);
+    else
+    {
+        int tableLength = stbtt_GetKerningTableLength(&fontInfo);
+
+        if (tableLength > 0)
+        {
+            stbtt_kerningentry *table = (stbtt_kerningentry *)RL_MALLOC(tableLength*sizeof(stbtt_kerningentry));
+            tableLength = stbtt_GetKerningTable(&fontInfo, table, tableLength);
+
+            // Map font glyph indices to loaded codepoints
+            int maxGlyphIndex = 0;
+            for (int i = 0; i < glyphCount; i++) if (glyphIndices[i] > maxGlyphIndex) maxGlyphIndex = glyphIndices[i];
+
+            int *glyphCodepoints = (int *)RL_MALLOC((maxGlyphIndex + 1)*sizeof(int));
+            for (int i = 0; i <= maxGlyphIndex; i++) glyphCodepoints[i] = -1;
+            for (int i = 0; i < glyphCount; i++) if (glyphIndices[i] > 0) glyphCodepoints[glyphIndices[i]] = glyphs[i].value;
+
+            kernings = (GlyphKerning *)RL_MALLOC(tableLength*sizeof(GlyphKerning));
+
+            for (int i = 0; i < tableLength; i++)
+            {
+                if ((table[i].glyph1 > maxGlyphIndex) || (table[i].glyph2 > maxGlyphIndex) || (table[i].advance == 0)) continue;
+
+                int first = glyphCodepoints[table[i].glyph1];
+                int second = glyphCodepoints[table[i].glyph2];
+
+                if ((first >= 0) && (second >= 0))
+                {
+                    kernings[*kerningCount] = (GlyphKerning){ first, second, (float)table[i].advance*scaleFactor };
+                    (*kerningCount)++;
+                }
+            }
+
+            RL_FREE(glyphCodepoints);
+            RL_FREE(table);
+        }
+    }
+
+    RL_FREE(glyphIndices);
+
+    if (*kerningCount > 0)
+    {
+        kernings = (GlyphKerning *)RL_REALLOC(kernings, (*kerningCount)*sizeof(GlyphKerning));
+        qsort(kernings, *kerningCount, sizeof(GlyphKerning), CompareGlyphKerning);
+    }
+    else
+    {
+        RL_FREE(kernings);
+        kernings = NULL;
+    }
+
+    return kernings;
+}
+
+// Load kerning pairs for loaded glyphs from TTF 'GPOS' table, pair adjustment lookups (x advance only)
+// NOTE: Pairs of a first glyph are set by the lookups subtables covering it, in order, as stbtt_GetGlyphKernAdvance() does:
+// pairs listed by a pairs subtable are set, a class subtable sets all remaining pairs (most of them 0, not stored)
+static GlyphKerning *LoadFontKerningGPOS(const stbtt_fontinfo *fontInfo, const int *glyphIndices, const GlyphInfo *glyphs, int glyphCount, float scaleFactor, int *kerningCount)
+{
+    unsigned char *data = fontInfo->data + fontInfo->gpos;
+
+    *kerningCount = 0;
+
+    if ((ttUSHORT(data) != 1) || (ttUSHORT(data + 2) != 0)) return NULL;   // GPOS version 1.0 supported
+
+    unsigned char *lookupList = data + ttUSHORT(data + 8);
+    int lookupCount = ttUSHORT(lookupList);
+
+    // Get pair adjustment subtables, class subtables get loaded glyphs grouped by second glyph class
+    int subtableCount = 0;
+    for (int l = 0; l < lookupCount; l++)
+    {
+        unsigned char *lookup = lookupList + ttUSHORT(lookupList + 2 + 2*l);
+        if (ttUSHORT(lookup) == 2) subtableCount += ttUSHORT(lookup + 4);
+    }
+
+    if (subtableCount == 0) return NULL;
+
+    KerningSubtableGPOS *subtables = (KerningSubtableGPOS *)RL_CALLOC(subtableCount, sizeof(KerningSubtableGPOS));
+    int *glyphClasses = (int *)RL_MALLOC(glyphCount*sizeof(int));
+
+    for (int l = 0, s = 0; l < lookupCount; l++)
+    {
+        unsigned char *lookup = lookupList + ttUSHORT(lookupList + 2 + 2*l);
+        if (ttUSHORT(lookup) != 2) continue;
+
+        for (int t = 0; t < ttUSHORT(lookup + 4); t++, s++)
+        {
+            unsigned char *table = lookup + ttUSHORT(lookup + 6 + 2*t);
+            subtables[s].table = table;
+
+            if ((ttUSHORT(table) != 2) || (ttUSHORT(table + 4) != 4) || (ttUSHORT(table + 6) != 0)) continue;
+
+            // Group loaded glyphs by class (counting sort), glyphs out of classes range are not kerned
+            int classCount = ttUSHORT(table + 14);
+            subtables[s].classStart = (int *)RL_CALLOC(classCount + 1, sizeof(int));
+            subtables[s].classGlyphs = (int *)RL_MALLOC(glyphCount*sizeof(int));
+
+            for (int j = 0; j < glyphCount; j++)
+            {
+                glyphClasses[j] = (glyphIndices[j] > 0)? stbtt__GetGlyphClass(table + ttUSHORT(table + 10), glyphIndices[j]) : -1;
+                if ((glyphClasses[j] >= 0) && (glyphClasses[j] < classCount)) subtables[s].classStart[glyphClasses[j] + 1]++;
+            }
+
+            for (int c = 0; c < classCount; c++) subtables[s].classStart[c + 1] += subtables[s].classStart[c];
+
+            int *classFill = (int *)RL_MALLOC(classCount*sizeof(int));
+            memcpy(classFill, subtables[s].classStart, classCount*sizeof(int));
+
+            for (int j = 0; j < glyphCount; j++)
+            {
+                if ((glyphClasses[j] >= 0) && (glyphClasses[j] < classCount)) subtables[s].classGlyphs[classFill[glyphClasses[j]]++] = j;
+            }
+
+            RL_FREE(classFill);
+        }
+    }
+
+    // Map font glyph indices to loaded glyphs, several codepoints could share a glyph
+    int maxGlyphIndex = 0;
+    for (int j = 0; j < glyphCount; j++) if (glyphIndices[j] > maxGlyphIndex) maxGlyphIndex = glyphIndices[j];
+
+    int *firstLoaded = (int *)RL_MALLOC((maxGlyphIndex + 1)*sizeof(int));
+    int *nextLoaded = (int *)RL_MALLOC(glyphCount*sizeof(int));
+    for (int g = 0; g <= maxGlyphIndex; g++) firstLoaded[g] = -1;
+    for (int j = glyphCount - 1; j >= 0; j--)
+    {
+        nextLoaded[j] = -1;
+
+        if (glyphIndices[j] > 0)
+        {
+            nextLoaded[j] = firstLoaded[glyphIndices[j]];
+            firstLoaded[glyphIndices[j]] = j;
+        }
+    }
+
+    // Pairs set for current first glyph, marked with first glyph number (no reset required)
+    int *pairSet = (int *)RL_CALLOC(glyphCount, sizeof(int));
+    int capacity = 0;
+    GlyphKerning *kernings = NULL;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if (glyphIndices[i] <= 0) continue;
+
+        bool done = false;
+
+        for (int s = 0; (s < subtableCount) && !done; s++)
+        {
+            unsigned char *table = subtables[s].table;
+            int coverageIndex = stbtt__GetCoverageIndex(table + ttUSHORT(table + 2), glyphIndices[i]);
+
+            if (coverageIndex < 0) continue;
+
+            // Subtable covering first glyph with unsupported values sets all remaining pairs to 0
+            done = true;
+
+            if ((ttUSHORT(table + 4) != 4) || (ttUSHORT(table + 6) != 0)) break;
+
+            if ((ttUSHORT(table) == 1) && (coverageIndex < ttUSHORT(table + 8)))
+            {
+                unsigned char *pairValues = table + ttUSHORT(table + 10 + 2*coverageIndex);
+                int pairValueCount = ttUSHORT(pairValues);
+
+                for (int p = 0; p < pairValueCount; p++)
+                {
+                    int secondGlyph = ttUSHORT(pairValues + 2 + 4*p);
+                    int advance = ttSHORT(pairValues + 2 + 4*p + 2);
+
+                    if (secondGlyph > maxGlyphIndex) continue;
+
+                    for (int j = firstLoaded[secondGlyph]; j >= 0; j = nextLoaded[j])
+                    {
+                        if (pairSet[j] == (i + 1)) continue;
+                        pairSet[j] = i + 1;
+
+                        if (advance != 0) kernings = AddGlyphKerning(kernings, kerningCount, &capacity, (GlyphKerning){ glyphs[i].value, glyphs[j].value, (float)advance*scaleFactor });
+                    }
+                }
+
+                done = false;   // Pairs not listed are set by following subtables
+            }
+            else if ((ttUSHORT(table) == 2) && (subtables[s].classStart != NULL))
+            {
+                int class1 = stbtt__GetGlyphClass(table + ttUSHORT(table + 8), glyphIndices[i]);
+                int class1Count = ttUSHORT(table + 12);
+                int class2Count = ttUSHORT(table + 14);
+
+                if ((class1 < 0) || (class1 >= class1Count)) break;
+
+                unsigned char *class2Records = table + 16 + 2*class1*class2Count;
+
+                for (int c = 0; c < class2Count; c++)
+                {
+                    int advance = ttSHORT(class2Records + 2*c);
+                    if (advance == 0) continue;
+
+                    for (int k = subtables[s].classStart[c]; k < subtables[s].classStart[c + 1]; k++)
+                    {
+                        int j = subtables[s].classGlyphs[k];
+                        if (pairSet[j] == (i + 1)) continue;
+
+                        kernings = AddGlyphKerning(kernings, kerningCount, &capacity, (GlyphKerning){ glyphs[i].value, glyphs[j].value, (float)advance*scaleFactor });
+                    }
+                }
+            }
+        }
+    }
+
+    for (int s = 0; s < subtableCount; s++)
+    {
+        RL_FREE(subtables[s].classStart);
+        RL_FREE(subtables[s].classGlyphs);
+    }
+
+    RL_FREE(pairSet);
+    RL_FREE(nextLoaded);
+    RL_FREE(firstLoaded);
+    RL_FREE(glyphClasses);
+    RL_FREE(subtables);
+
+    return kernings;
+}
+
+// Add kerning pair to pairs array, growing it as required
+static GlyphKerning *AddGlyphKerning(GlyphKerning *kernings, int *count, int *capacity, GlyphKerning kerning)
+{
+    if (*count == *capacity)
+    {
+        int newCapacity = (*capacity > 0)? *capacity*2 : 256;
+        GlyphKerning *newKernings = (GlyphKerning *)RL_REALLOC(kernings, newCapacity*sizeof(GlyphKerning));
+        if (newKernings == NULL) return kernings;
+
+        kernings = newKernings;
+        *capacity = newCapacity;
+    }
+
+    kernings[*count] = kerning;
+    (*count)++;
+
+    return kernings;
+}
+#endif
+
+// Compare kerning pairs by first and second codepoints, used by qsort()
+static int CompareGlyphKerning(const void *a, const void *b)
+{
+    const GlyphKerning *kerningA = (const GlyphKerning *)a;
+    const GlyphKerning *kerningB = (const GlyphKerning *)b;
+
+    if (kerningA->first != kerningB->first) return (kerningA->first < kerningB->first)? -1 : 1;
+    if (kerningA->second != kerningB->second) return (kerningA->second < kerningB->second)? -1 : 1;
+
+    return 0;
+}
+
+// Get simplified bidi class of a codepoint: neutral, left-to-right, right-to-left or number
+// NOTE: Right-to-left ranges: Hebrew, Arabic, Syriac, Thaana, NKo, Samaritan, Mandaic and their
+// presentation forms, neutrals: ASCII and general punctuation, symbols and spaces
+static int GetCodepointBidiClass(int codepoint)
+{
+    int bidiClass = BIDI_CLASS_LTR;
+
+    if (((codepoint >= '0') && (codepoint <= '9')) ||
+        ((codepoint >= 0x0660) && (codepoint <= 0x0669)) ||     // Arabic-Indic digits
+        ((codepoint >= 0x06f0) && (codepoint <= 0x06f9))) bidiClass = BIDI_CLASS_NUMBER;
+    else if (((codepoint >= 0x0590) && (codepoint <= 0x08ff)) ||
+             ((codepoint >= 0xfb1d) && (codepoint <= 0xfdff)) ||
+             ((codepoint >= 0xfe70) && (codepoint <= 0xfeff)) ||
+             ((codepoint >= 0x10800) && (codepoint <= 0x10fff)) ||
+             ((codepoint >= 0x1e800) && (codepoint <= 0x1efff))) bidiClass = BIDI_CLASS_RTL;
+    else if (((codepoint < 0x80) && !(((codepoint >= 'a') && (codepoint <= 'z')) || ((codepoint >= 'A') && (codepoint <= 'Z')))) ||
+             ((codepoint >= 0x80) && (codepoint <= 0xbf) && (codepoint != 0xaa) && (codepoint != 0xb5) && (codepoint != 0xba)) ||
+             (codepoint == 0xd7) || (codepoint == 0xf7) ||
+             ((codepoint >= 0x2000) && (codepoint <= 0x2bff)) ||     // General punctuation, symbols, arrows, shapes
+             ((codepoint >= 0x3000) && (codepoint <= 0x303f))) bidiClass = BIDI_CLASS_NEUTRAL;
+
+    return bidiClass;
+}
+
+// Begin built-in shader mode for SDF and MSDF fonts, returns true if shader mode was started
+// NOTE: Shaders are lazy loaded on first use, custom shader modes (BeginShaderMode()) are respected
+static bool BeginFontShader(Font font)
+{
+    bool active = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (((font.type == FONT_SDF) || (font.type == FONT_MSDF)) && (rlGetActiveShader() == rlGetShaderIdDefault()))
+    {
+    #if defined(GRAPHICS_API_OPENGL_21)
+        #define FONT_SHADER_HEADER  "#version 120\nvarying vec2 fragTexCoord;\nvarying vec4 fragColor;\n"
+        #define FONT_SHADER_TEXTURE "texture2D"
+        #define FONT_SHADER_OUTPUT  "gl_FragColor"
+    #elif defined(GRAPHICS_API_OPENGL_33)
+        #define FONT_SHADER_HEADER  "#version 330\nin vec2 fragTexCoord;\nin vec4 fragColor;\nout vec4 finalColor;\n"
+        #define FONT_SHADER_TEXTURE "texture"
+        #define FONT_SHADER_OUTPUT  "finalColor"
+    #elif defined(GRAPHICS_API_OPENGL_ES3)
+        #define FONT_SHADER_HEADER  "#version 300 es\nprecision mediump float;\nin vec2 fragTexCoord;\nin vec4 fragColor;\nout vec4 finalColor;\n"
+        #define FONT_SHADER_TEXTURE "texture"
+        #define FONT_SHADER_OUTPUT  "finalColor"
+    #else   // GRAPHICS_API_OPENGL_ES2
+        #define FONT_SHADER_HEADER  "#version 100\n#extension GL_OES_standard_derivatives : enable\nprecision mediump float;\nvarying vec2 fragTexCoord;\nvarying vec4 fragColor;\n"
+        #define FONT_SHADER_TEXTURE "texture2D"
+        #define FONT_SHADER_OUTPUT  "gl_FragColor"
+    #endif
+
+        // Alpha is computed from distance (0.5 on edge) and its screen-space change per fragment,
+        // so edges are anti-aliased at any scale without range or texture size uniforms
+        static const char *fontShaderCode[2] = {
+            // SDF: distance stored in alpha channel
+            FONT_SHADER_HEADER
+            "uniform sampler2D texture0;\n"
+            "uniform vec4 colDiffuse;\n"
+            "void main()\n"
+            "{\n"
+            "    float dist = " FONT_SHADER_TEXTURE "(texture0, fragTexCoord).a - 0.5;\n"
+            "    float width = length(vec2(dFdx(dist), dFdy(dist)));\n"
+            "    float alpha = smoothstep(-width, width, dist);\n"
+            "    " FONT_SHADER_OUTPUT " = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;\n"
+            "}\n",
+            // MSDF: distance is the median of RGB channels
+            FONT_SHADER_HEADER
+            "uniform sampler2D texture0;\n"
+            "uniform vec4 colDiffuse;\n"
+            "void main()\n"
+            "{\n"
+            "    vec3 msd = " FONT_SHADER_TEXTURE "(texture0, fragTexCoord).rgb;\n"
+            "    float dist = max(min(msd.r, msd.g), min(max(msd.r, msd.g), msd.b)) - 0.5;\n"
+            "    float width = length(vec2(dFdx(dist), dFdy(dist)));\n"
+            "    float alpha = smoothstep(-width, width, dist);\n"
+            "    " FONT_SHADER_OUTPUT " = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;\n"
+            "}\n"
+        };
+
+        int index = (font.type == FONT_SDF)? 0 : 1;
+
+        if (fontShaders[index].id == 0) fontShaders[index] = LoadShaderFromMemory(NULL, fontShaderCode[index]);
+
+        if (fontShaders[index].id != rlGetShaderIdDefault())
+        {
+            BeginShaderMode(fontShaders[index]);
+            active = true;
+        }
+    }
+#endif
+
+    return active;
+}
+
+// End built-in font shader mode, if it was started
+static void EndFontShader(bool active)
+{
+    if (active) EndShaderMode();
+}
+
+// Draw one glyph by font glyph index
+static void DrawGlyph(Font font, int index, Vector2 position, float fontSize, Color tint)
+{
+    // Character destination rectangle on screen
+    Rectangle dstRec = GetGlyphDrawRec(font, index, position, fontSize);
+
+    // Character source rectangle from font texture atlas
+    // NOTE: We consider chars padding when drawing, it could be required for outline/glow shader effects
+    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
+                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+
+    // Draw the character texture on the screen
+    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+}
+
+// Get glyph destination rectangle on screen
+// NOTE: We consider glyphPadding on drawing
+static Rectangle GetGlyphDrawRec(Font font, int index, Vector2 position, float fontSize)
+{
+    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
+
+    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
+                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
+
+    return dstRec;
+}
+
+// Check if glyph destination rectangle overlaps clip rectangle
+static bool CheckGlyphClip(Font font, int index, Vector2 position, float fontSize, Rectangle clip)
+{
+    Rectangle dstRec = GetGlyphDrawRec(font, index, position, fontSize);
+
+    return ((dstRec.x < (clip.x + clip.width)) && ((dstRec.x + dstRec.width) > clip.x) &&
+            (dstRec.y < (clip.y + clip.height)) && ((dstRec.y + dstRec.height) > clip.y));
+}
+
+// Get length in bytes of the ASCII run at the start of text (up to size)
+// NOTE: Text is checked in 32/16 bytes blocks, the remaining tail is checked byte by byte
+static int GetUTF8ASCIILength(const unsigned char *text, int size)
+{
+    int length = 0;
+
+#if defined(RTEXT_UTF8_SSE2)
+    for (; (length + 32) <= size; length += 32)
+    {
+        __m128i block0 = _mm_loadu_si128((const __m128i *)(text + length));
+        __m128i block1 = _mm_loadu_si128((const __m128i *)(text + length + 16));
+        if (_mm_movemask_epi8(_mm_or_si128(block0, block1)) != 0) break;    // Some byte >= 0x80
+    }
+
+    for (; (length + 16) <= size; length += 16)
+    {
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(text + length))) != 0) break;
+    }
+#elif defined(RTEXT_UTF8_NEON)
+    for (; (length + 16) <= size; length += 16)
+    {
+        uint64x2_t high = vreinterpretq_u64_u8(vandq_u8(vld1q_u8(text + length), vdupq_n_u8(0x80)));
+        if ((vgetq_lane_u64(high, 0) | vgetq_lane_u64(high, 1)) != 0) break;
+    }
+#endif
+
+    while ((length < size) && (text[length] < 0x80)) length++;
+
+    return length;
+}
+
+// Decode the ASCII run at the start of text into codepoints (up to size), returns codepoints decoded
+// NOTE: Every block of 16 ASCII bytes is widened to 16 codepoints (UTF-32) at once
+static int DecodeUTF8ASCII(const unsigned char *text, int size, int *codepoints)
+{
+    int length = 0;
+
+#if defined(RTEXT_UTF8_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; (length + 16) <= size; length += 16)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)(text + length));
+        if (_mm_movemask_epi8(block) != 0) break;   // Some byte >= 0x80
+
+        __m128i low = _mm_unpacklo_epi8(block, zero);
+        __m128i high = _mm_unpackhi_epi8(block, zero);
+
+        _mm_storeu_si128((__m128i *)(codepoints + length), _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128((__m128i *)(codepoints + length + 4), _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128((__m128i *)(codepoints + length + 8), _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128((__m128i *)(codepoints + length + 12), _mm_unpackhi_epi16(high, zero));
+    }
+#elif defined(RTEXT_UTF8_NEON)
+    for (; (length + 16) <= size; length += 16)
+    {
+        uint8x16_t block = vld1q_u8(text + length);
+        uint64x2_t high = vreinterpretq_u64_u8(vandq_u8(block, vdupq_n_u8(0x80)));
+        if ((vgetq_lane_u64(high, 0) | vgetq_lane_u64(high, 1)) != 0) break;
+
+        uint16x8_t low16 = vmovl_u8(vget_low_u8(block));
+        uint16x8_t high16 = vmovl_u8(vget_high_u8(block));
+
+        vst1q_s32(codepoints + length, vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(low16))));
+        vst1q_s32(codepoints + length + 4, vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(low16))));
+        vst1q_s32(codepoints + length + 8, vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(high16))));
+        vst1q_s32(codepoints + length + 12, vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(high16))));
+    }
+#endif
+
+    for (; (length < size) && (text[length] < 0x80); length++) codepoints[length] = text[length];
+
+    return length;
+}
+
+// Decode UTF-8 text into codepoints (UTF-32), up to size bytes or maxCount codepoints
+// NOTE: ASCII runs are decoded in SIMD blocks, multi-byte sequences are decoded (and validated)
+// by GetCodepointNext(), so invalid sequences are decoded as '?'(0x3f) the same way
+// Returns the number of bytes processed, number of codepoints decoded returned as parameter
+static int DecodeUTF8(const char *text, int size, int *codepoints, int maxCount, int *count)
+{
+    const unsigned char *ptr = (const unsigned char *)text;
+    int byteCount = 0;
+    int codepointCount = 0;
+
+    while ((byteCount < size) && (codepointCount < maxCount))
+    {
+        if (ptr[byteCount] < 0x80)
+        {
+            int limit = ((size - byteCount) < (maxCount - codepointCount))? (size - byteCount) : (maxCount - codepointCount);
+            int length = DecodeUTF8ASCII(ptr + byteCount, limit, codepoints + codepointCount);
+
+            byteCount += length;
+            codepointCount += length;
+        }
+        else
+        {
+            int codepointSize = 0;
+            codepoints[codepointCount] = GetCodepointNext(text + byteCount, &codepointSize);
+
+            byteCount += codepointSize;
+            codepointCount++;
+        }
+    }
+
+    *count = codepointCount;
+
+    return byteCount;
+}
+
+// Count codepoints in UTF-8 text (up to size bytes)
+// NOTE: ASCII runs are skipped in SIMD blocks, the count matches decoding with GetCodepointNext()
+static int CountUTF8(const char *text, int size)
+{
+    const unsigned char *ptr = (const unsigned char *)text;
+    int byteCount = 0;
+    int codepointCount = 0;
+
+    while (byteCount < size)
+    {
+        if (ptr[byteCount] < 0x80)
+        {
+            int length = GetUTF8ASCIILength(ptr + byteCount, size - byteCount);
+
+            byteCount += length;
+            codepointCount += length;
+        }
+        else
+        {
+            int codepointSize = 0;
+            GetCodepointNext(text + byteCount, &codepointSize);
+
+            byteCount += codepointSize;
+            codepointCount++;
+        }
+    }
+
+    return codepointCount;
+}
+
+#if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
+// Read a line from memory
+// REQUIRES: memcpy()
+// NOTE: Returns the number of bytes read
+static int GetLine(const char *origin, char *buffer, int maxLength)
+{
+    int count = 0;
+    for (; count < maxLength - 1; count++) if (origin[count] == '\n') break;
+    memcpy(buffer, origin, count);
+    buffer[count] = '\0';
+    return count;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_FNT)
+// Load a BMFont file (AngelCode font file)
+// REQUIRES: strstr(), sscanf(), strrchr(), memcpy()
+static Font LoadBMFont(const char *fileName)
+{
+    #define MAX_BUFFER_SIZE       256
+    #define MAX_FONT_IMAGE_PAGES    8
+
+    Font font = { 0 };
+
+    char buffer[MAX_BUFFER_SIZE] = { 0 };
+    char *searchPoint = NULL;
+
+    int fontSize = 0;
+    int glyphCount = 0;
+
+    int imWidth = 0;
+    int imHeight = 0;
+    int pageCount = 1;
+    char imFileName[MAX_FONT_IMAGE_PAGES][129] = { 0 };
+
+    int base = 0;       // Useless data
+    int readBytes = 0;  // Data bytes read
+    int readVars = 0;   // Variables filled by sscanf()
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData == NULL) return font;
+
+    // Binary BMFont files start with "BMF" identifier followed by format version
+    if ((dataSize > 4) && (memcmp(fileData, "BMF", 3) == 0))
+    {
+        font = LoadBMFontBinary(fileName, fileData, dataSize);
+        UnloadFileData(fileData);
+
+        return font;
+    }
+
+    // Text BMFont file, reuse file data as null-terminated text
+    char *fileText = (char *)RL_REALLOC(fileData, dataSize + 1);
+    fileText[dataSize] = '\0';
+
+    char *fileTextPtr = fileText;
+    char *fileTextEnd = fileText + TextLength(fileText);
+
+    // NOTE: We skip first line, it contains no useful information
+    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+    fileTextPtr += (readBytes + 1);
+
+    // Read line data
+    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+    searchPoint = strstr(buffer, "lineHeight");
+    readVars = sscanf(searchPoint, "lineHeight=%i base=%i scaleW=%i scaleH=%i pages=%i", &fontSize, &base, &imWidth, &imHeight, &pageCount);
+    fileTextPtr += (readBytes + 1);
+
+    if (readVars < 4) { UnloadFileText(fileText); return font; } // Some data not available, file malformed
+
+    if (pageCount > MAX_FONT_IMAGE_PAGES)
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Font defines more pages than supported: %i/%i", fileName, pageCount, MAX_FONT_IMAGE_PAGES);
+        pageCount = MAX_FONT_IMAGE_PAGES;
+    }
+
+    for (int i = 0; i < pageCount; i++)
+    {
         readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
         searchPoint = strstr(buffer, "file");
         readVars = sscanf(searchPoint, "file=\"%128[^\"]\"", imFileName[i]);
@@ -2215,12 +4078,258 @@ static Font LoadBMFont(const char *fileName)
 
     if (readVars < 1) { UnloadFileText(fileText); return font; } // No glyphCount read
 
-    // Load all required images for further compose
+    // Load all required images and compose them into one atlas
+    Image fullFont = LoadBMFontAtlas(fileName, imFileName, pageCount, imWidth, imHeight);
+
+    if (isGpuReady) font.texture = LoadTextureFromImage(fullFont);
+
+    // Fill font characters info data
+    font.baseSize = fontSize;
+    font.glyphCount = glyphCount;
+    font.glyphPadding = 0;
+    font.glyphs = (GlyphInfo *)RL_MALLOC(glyphCount*sizeof(GlyphInfo));
+    font.recs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
+
+    int charId, charX, charY, charWidth, charHeight, charOffsetX, charOffsetY, charAdvanceX, pageID;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+        readVars = sscanf(buffer, "char id=%i x=%i y=%i width=%i height=%i xoffset=%i yoffset=%i xadvance=%i page=%i",
+                       &charId, &charX, &charY, &charWidth, &charHeight, &charOffsetX, &charOffsetY, &charAdvanceX, &pageID);
+        fileTextPtr += (readBytes + 1);
+
+        if (readVars == 9)  // Make sure all char data has been properly read
+        {
+            // Get character rectangle in the font atlas texture
+            font.recs[i] = (Rectangle){ (float)charX, (float)charY + (float)imHeight*pageID, (float)charWidth, (float)charHeight };
+
+            // Save data properly in sprite font
+            font.glyphs[i].value = charId;
+            font.glyphs[i].offsetX = charOffsetX;
+            font.glyphs[i].offsetY = charOffsetY;
+            font.glyphs[i].advanceX = charAdvanceX;
+
+            // Fill character image data from full font data
+            font.glyphs[i].image = ImageFromImage(fullFont, font.recs[i]);
+        }
+        else
+        {
+            font.glyphs[i].image = GenImageColor((int)font.recs[i].width, (int)font.recs[i].height, BLACK);
+            TRACELOG(LOG_WARNING, "FONT: [%s] Some characters data not correctly provided", fileName);
+        }
+    }
+
+    // Read kerning pairs, optional after characters data
+    int kerningCount = 0;
+
+    if (fileTextPtr < fileTextEnd)
+    {
+        readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+        searchPoint = strstr(buffer, "kernings");
+        if (searchPoint != NULL) readVars = sscanf(searchPoint, "kernings count=%i", &kerningCount);
+        fileTextPtr += (readBytes + 1);
+
+        if ((searchPoint == NULL) || (readVars < 1)) kerningCount = 0;
+    }
+
+    if (kerningCount > 0)
+    {
+        font.kernings = (GlyphKerning *)RL_MALLOC(kerningCount*sizeof(GlyphKerning));
+
+        int kerningFirst, kerningSecond, kerningAmount;
+
+        for (int i = 0; (i < kerningCount) && (fileTextPtr < fileTextEnd); i++)
+        {
+            readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+            readVars = sscanf(buffer, "kerning first=%i second=%i amount=%i", &kerningFirst, &kerningSecond, &kerningAmount);
+            fileTextPtr += (readBytes + 1);
+
+            if ((readVars == 3) && (kerningAmount != 0))
+            {
+                font.kernings[font.kerningCount] = (GlyphKerning){ kerningFirst, kerningSecond, (float)kerningAmount };
+                font.kerningCount++;
+            }
+        }
+
+        if (font.kerningCount > 0) qsort(font.kernings, font.kerningCount, sizeof(GlyphKerning), CompareGlyphKerning);
+        else
+        {
+            RL_FREE(font.kernings);
+            font.kernings = NULL;
+        }
+    }
+
+    UnloadImage(fullFont);
+    UnloadFileText(fileText);
+
+    if (isGpuReady && (font.texture.id == 0))
+    {
+        UnloadFont(font);
+        font = GetFontDefault();
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load texture, reverted to default font", fileName);
+    }
+    else TRACELOG(LOG_INFO, "FONT: [%s] Font loaded successfully (%i glyphs)", fileName, font.glyphCount);
+
+    return font;
+}
+
+// Load a binary BMFont file data (format version 3)
+// NOTE: File is composed of blocks: [type (1 byte)][size (4 bytes)][block data], values are little-endian
+static Font LoadBMFontBinary(const char *fileName, const unsigned char *fileData, int dataSize)
+{
+    #define BMF_READ_U16(ptr) ((int)(ptr)[0] | ((int)(ptr)[1] << 8))
+    #define BMF_READ_I16(ptr) ((int)(short)BMF_READ_U16(ptr))
+    #define BMF_READ_I32(ptr) ((int)((unsigned int)(ptr)[0] | ((unsigned int)(ptr)[1] << 8) | ((unsigned int)(ptr)[2] << 16) | ((unsigned int)(ptr)[3] << 24)))
+
+    #define BMF_CHAR_DATA_SIZE     20   // Char data size: id, x, y, width, height, xoffset, yoffset, xadvance, page, channel
+    #define BMF_KERNING_DATA_SIZE  10   // Kerning data size: first, second, amount
+
+    Font font = { 0 };
+
+    int fontSize = 0;
+    int imWidth = 0;
+    int imHeight = 0;
+    int pageCount = 0;
+    char imFileName[MAX_FONT_IMAGE_PAGES][129] = { 0 };
+
+    const unsigned char *charsData = NULL;
+    int glyphCount = 0;
+    const unsigned char *kerningsData = NULL;
+    int kerningCount = 0;
+
+    if (fileData[3] != 3)
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Binary BMFont version not supported: %i", fileName, fileData[3]);
+        return font;
+    }
+
+    for (int offset = 4; (offset + 5) <= dataSize;)
+    {
+        int blockType = fileData[offset];
+        int blockSize = BMF_READ_I32(&fileData[offset + 1]);
+        const unsigned char *block = &fileData[offset + 5];
+        offset += 5;
+
+        if ((blockSize < 0) || (blockSize > (dataSize - offset))) break;  // Block out of file bounds, file malformed
+
+        switch (blockType)
+        {
+            case 2:     // Common: lineHeight, base, scaleW, scaleH, pages, ...
+            {
+                if (blockSize >= 10)
+                {
+                    fontSize = BMF_READ_U16(block);
+                    imWidth = BMF_READ_U16(block + 4);
+                    imHeight = BMF_READ_U16(block + 6);
+                    pageCount = BMF_READ_U16(block + 8);
+                }
+            } break;
+            case 3:     // Pages: null-terminated file names
+            {
+                for (int i = 0, page = 0; (i < blockSize) && (page < MAX_FONT_IMAGE_PAGES); page++)
+                {
+                    int length = 0;
+                    while (((i + length) < blockSize) && (block[i + length] != '\0')) length++;
+
+                    memcpy(imFileName[page], block + i, (length < 128)? length : 128);
+                    i += (length + 1);
+                }
+            } break;
+            case 4: charsData = block; glyphCount = blockSize/BMF_CHAR_DATA_SIZE; break;
+            case 5: kerningsData = block; kerningCount = blockSize/BMF_KERNING_DATA_SIZE; break;
+            default: break;     // Info block not required
+        }
+
+        offset += blockSize;
+    }
+
+    if ((fontSize == 0) || (pageCount == 0) || (glyphCount == 0) || (imFileName[0][0] == '\0'))
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Binary BMFont data not valid", fileName);
+        return font;
+    }
+
+    if (pageCount > MAX_FONT_IMAGE_PAGES)
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Font defines more pages than supported: %i/%i", fileName, pageCount, MAX_FONT_IMAGE_PAGES);
+        pageCount = MAX_FONT_IMAGE_PAGES;
+    }
+
+    Image fullFont = LoadBMFontAtlas(fileName, imFileName, pageCount, imWidth, imHeight);
+
+    if (isGpuReady) font.texture = LoadTextureFromImage(fullFont);
+
+    // Fill font characters info data
+    font.baseSize = fontSize;
+    font.glyphCount = glyphCount;
+    font.glyphPadding = 0;
+    font.glyphs = (GlyphInfo *)RL_MALLOC(glyphCount*sizeof(GlyphInfo));
+    font.recs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        const unsigned char *charData = charsData + i*BMF_CHAR_DATA_SIZE;
+
+        // Get character rectangle in the font atlas texture
+        font.recs[i] = (Rectangle){ (float)BMF_READ_U16(charData + 4), (float)BMF_READ_U16(charData + 6) + (float)imHeight*charData[18],
+                                    (float)BMF_READ_U16(charData + 8), (float)BMF_READ_U16(charData + 10) };
+
+        font.glyphs[i].value = BMF_READ_I32(charData);
+        font.glyphs[i].offsetX = BMF_READ_I16(charData + 12);
+        font.glyphs[i].offsetY = BMF_READ_I16(charData + 14);
+        font.glyphs[i].advanceX = BMF_READ_I16(charData + 16);
+
+        // Fill character image data from full font data
+        font.glyphs[i].image = ImageFromImage(fullFont, font.recs[i]);
+    }
+
+    if (kerningCount > 0)
+    {
+        font.kernings = (GlyphKerning *)RL_MALLOC(kerningCount*sizeof(GlyphKerning));
+
+        for (int i = 0; i < kerningCount; i++)
+        {
+            const unsigned char *kerningData = kerningsData + i*BMF_KERNING_DATA_SIZE;
+            int amount = BMF_READ_I16(kerningData + 8);
+
+            if (amount != 0)
+            {
+                font.kernings[font.kerningCount] = (GlyphKerning){ BMF_READ_I32(kerningData), BMF_READ_I32(kerningData + 4), (float)amount };
+                font.kerningCount++;
+            }
+        }
+
+        if (font.kerningCount > 0) qsort(font.kernings, font.kerningCount, sizeof(GlyphKerning), CompareGlyphKerning);
+        else
+        {
+            RL_FREE(font.kernings);
+            font.kernings = NULL;
+        }
+    }
+
+    UnloadImage(fullFont);
+
+    if (isGpuReady && (font.texture.id == 0))
+    {
+        UnloadFont(font);
+        font = GetFontDefault();
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load texture, reverted to default font", fileName);
+    }
+    else TRACELOG(LOG_INFO, "FONT: [%s] Font loaded successfully (%i glyphs)", fileName, font.glyphCount);
+
+    return font;
+}
+
+// Load BMFont pages images into one atlas, pages are stacked vertically
+// NOTE: Page images paths are relative to font file directory
+static Image LoadBMFontAtlas(const char *fileName, char (*imFileNames)[129], int pageCount, int imWidth, int imHeight)
+{
     Image *imFonts = (Image *)RL_CALLOC(pageCount, sizeof(Image)); // Font atlases, multiple images
 
     for (int i = 0; i < pageCount; i++)
     {
-        imFonts[i] = LoadImage(TextFormat("%s/%s", GetDirectoryPath(fileName), imFileName[i]));
+        imFonts[i] = LoadImage(TextFormat("%s/%s", GetDirectoryPath(fileName), imFileNames[i]));
 
         if (imFonts[i].format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
         {
@@ -2245,7 +4354,6 @@ static Font LoadBMFont(const char *fileName)
     }
 
     Image fullFont = imFonts[0];
-    for (int i = 1; i < pageCount; i++) UnloadImage(imFonts[i]);
 
     // If multiple atlas, then merge atlas
     // NOTE: WARNING: This process could be really slow!
@@ -2262,61 +4370,117 @@ static Font LoadBMFont(const char *fileName)
         }
     }
 
+    for (int i = 1; i < pageCount; i++) UnloadImage(imFonts[i]);
+
     RL_FREE(imFonts);
 
-    if (isGpuReady) font.texture = LoadTextureFromImage(fullFont);
+    return fullFont;
+}
 
-    // Fill font characters info data
-    font.baseSize = fontSize;
-    font.glyphCount = glyphCount;
-    font.glyphPadding = 0;
-    font.glyphs = (GlyphInfo *)RL_MALLOC(glyphCount*sizeof(GlyphInfo));
-    font.recs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
+#endif
 
-    int charId, charX, charY, charWidth, charHeight, charOffsetX, charOffsetY, charAdvanceX, pageID;
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+// Load a raylib precompiled font file data
+// NOTE: Glyphs, recs and kernings are copied directly from file data, atlas image data is used in place
+static Font LoadFontRFNT(const unsigned char *fileData, int dataSize)
+{
+    Font font = { 0 };
+    RFNTHeader header = { 0 };
 
-    for (int i = 0; i < glyphCount; i++)
+    if (dataSize >= (int)sizeof(RFNTHeader)) memcpy(&header, fileData, sizeof(RFNTHeader));
+
+    if ((memcmp(header.id, "rFNT", 4) != 0) || (header.version != RFNT_FILE_VERSION))
     {
-        readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-        readVars = sscanf(buffer, "char id=%i x=%i y=%i width=%i height=%i xoffset=%i yoffset=%i xadvance=%i page=%i",
-                       &charId, &charX, &charY, &charWidth, &charHeight, &charOffsetX, &charOffsetY, &charAdvanceX, &pageID);
-        fileTextPtr += (readBytes + 1);
+        TRACELOG(LOG_WARNING, "FONT: Precompiled font file not valid or version not supported");
+        return font;
+    }
 
-        if (readVars == 9)  // Make sure all char data has been properly read
-        {
-            // Get character rectangle in the font atlas texture
-            font.recs[i] = (Rectangle){ (float)charX, (float)charY + (float)imHeight*pageID, (float)charWidth, (float)charHeight };
+    // Check sections sizes before computing offsets, avoiding overflows
+    if ((header.glyphCount <= 0) || (header.glyphCount > dataSize/(int)(sizeof(RFNTGlyph) + sizeof(Rectangle))) ||
+        (header.kerningCount < 0) || (header.kerningCount > dataSize/(int)sizeof(GlyphKerning)) ||
+        (header.atlasDataSize <= 0) || (header.atlasDataSize != GetPixelDataSize(header.atlasWidth, header.atlasHeight, header.atlasFormat)))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Precompiled font file data not valid");
+        return font;
+    }
 
-            // Save data properly in sprite font
-            font.glyphs[i].value = charId;
-            font.glyphs[i].offsetX = charOffsetX;
-            font.glyphs[i].offsetY = charOffsetY;
-            font.glyphs[i].advanceX = charAdvanceX;
+    int recsOffset = sizeof(RFNTHeader) + header.glyphCount*sizeof(RFNTGlyph);
+    int kerningsOffset = recsOffset + header.glyphCount*sizeof(Rectangle);
+    int atlasOffset = kerningsOffset + header.kerningCount*sizeof(GlyphKerning);
 
-            // Fill character image data from full font data
-            font.glyphs[i].image = ImageFromImage(fullFont, font.recs[i]);
-        }
-        else
+    if ((atlasOffset > dataSize) || (header.atlasDataSize > (dataSize - atlasOffset)))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Precompiled font file data truncated");
+        return font;
+    }
+
+    Image atlas = { 0 };
+    atlas.data = (void *)(fileData + atlasOffset);
+    atlas.width = header.atlasWidth;
+    atlas.height = header.atlasHeight;
+    atlas.mipmaps = 1;
+    atlas.format = header.atlasFormat;
+
+    font.baseSize = header.baseSize;
+    font.glyphCount = header.glyphCount;
+    font.glyphPadding = header.glyphPadding;
+    font.type = header.type;
+    font.glyphs = (GlyphInfo *)RL_MALLOC(font.glyphCount*sizeof(GlyphInfo));
+    font.recs = (Rectangle *)RL_MALLOC(font.glyphCount*sizeof(Rectangle));
+
+    memcpy(font.recs, fileData + recsOffset, font.glyphCount*sizeof(Rectangle));
+
+    // Check glyphs rectangles lay inside the atlas before extracting glyphs images
+    // NOTE: Negated comparisons also reject NaN values
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        Rectangle rec = font.recs[i];
+
+        if (!(rec.x >= 0.0f) || !(rec.y >= 0.0f) || !(rec.width >= 0.0f) || !(rec.height >= 0.0f) ||
+            !((rec.x + rec.width) <= (float)atlas.width) || !((rec.y + rec.height) <= (float)atlas.height))
         {
-            font.glyphs[i].image = GenImageColor((int)font.recs[i].width, (int)font.recs[i].height, BLACK);
-            TRACELOG(LOG_WARNING, "FONT: [%s] Some characters data not correctly provided", fileName);
+            TRACELOG(LOG_WARNING, "FONT: Precompiled font file glyph rectangle out of atlas bounds");
+            RL_FREE(font.glyphs);
+            RL_FREE(font.recs);
+            return (Font){ 0 };
         }
     }
 
-    UnloadImage(fullFont);
-    UnloadFileText(fileText);
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        RFNTGlyph glyph = { 0 };
+        memcpy(&glyph, fileData + sizeof(RFNTHeader) + i*sizeof(RFNTGlyph), sizeof(RFNTGlyph));
 
-    if (isGpuReady && (font.texture.id == 0))
+        font.glyphs[i].value = glyph.value;
+        font.glyphs[i].offsetX = glyph.offsetX;
+        font.glyphs[i].offsetY = glyph.offsetY;
+        font.glyphs[i].advanceX = glyph.advanceX;
+
+        // Glyph image required by ImageDrawText()
+        font.glyphs[i].image = ImageFromImage(atlas, font.recs[i]);
+    }
+
+    if (header.kerningCount > 0)
     {
-        UnloadFont(font);
-        font = GetFontDefault();
-        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load texture, reverted to default font", fileName);
+        font.kerningCount = header.kerningCount;
+        font.kernings = (GlyphKerning *)RL_MALLOC(font.kerningCount*sizeof(GlyphKerning));
+        memcpy(font.kernings, fileData + kerningsOffset, font.kerningCount*sizeof(GlyphKerning));
+    }
+
+    if (isGpuReady)
+    {
+        font.texture = LoadTextureFromImage(atlas);
+
+        if (font.texture.id == 0)
+        {
+            UnloadFont(font);
+            font = GetFontDefault();
+            TRACELOG(LOG_WARNING, "FONT: Failed to load precompiled font texture, reverted to default font");
+        }
     }
-    else TRACELOG(LOG_INFO, "FONT: [%s] Font loaded successfully (%i glyphs)", fileName, font.glyphCount);
 
     return font;
 }
-
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_BDF)
@@ -77,6 +77,7 @@
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()/LoadImageAnimFromMemory()/ExportImageToMemory()]
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
+#include <limits.h>             // Required for: INT_MAX [Used in LoadImage(), LoadImageAnim()]
 
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
@@ -280,16 +281,16 @@ Image LoadImage(const char *fileName)
     #define STBI_REQUIRED
 #endif
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // Loading file data view, memory-mapped if available
+    FileView fileView = LoadFileView(fileName);
 
-    // Loading image from memory data
-    if (fileData != NULL)
+    // Loading image from file data
+    if (fileView.data != NULL)
     {
-        image = LoadImageFromMemory(GetFileExtension(fileName), fileData, dataSize);
+        if (fileView.size <= INT_MAX) image = LoadImageFromMemory(GetFileExtension(fileName), fileView.data, (int)fileView.size);
+        else TRACELOG(LOG_WARNING, "IMAGE: [%s] File is bigger than 2147483647 bytes, not supported", fileName);
 
-        UnloadFileData(fileData);
+        UnloadFileView(fileView);
     }
 
     return image;
@@ -300,18 +301,17 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
 {
     Image image = { 0 };
 
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    FileView fileView = LoadFileView(fileName);
 
-    if (fileData != NULL)
+    if (fileView.data != NULL)
     {
-        unsigned char *dataPtr = fileData;
+        const unsigned char *dataPtr = fileView.data;
         int size = GetPixelDataSize(width, height, format);
 
-        if (size <= dataSize)   // Security check
+        if ((unsigned long long)size <= fileView.size)   // Security check
         {
             // Offset file data to expected raw image by header size
-            if ((headerSize > 0) && ((headerSize + size) <= dataSize)) dataPtr += headerSize;
+            if ((headerSize > 0) && ((unsigned long long)(headerSize + size) <= fileView.size)) dataPtr += headerSize;
 
             image.data = RL_MALLOC(size);      // Allocate required memory in bytes
             memcpy(image.data, dataPtr, size); // Copy required data to image
@@ -321,7 +321,7 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
             image.format = format;
         }
 
-        UnloadFileData(fileData);
+        UnloadFileView(fileView);
     }
 
     return image;
@@ -340,21 +340,21 @@ Image LoadImageAnim(const char *fileName, int *frames)
 #if defined(SUPPORT_FILEFORMAT_GIF)
     if (IsFileExtension(fileName, ".gif"))
     {
-        int dataSize = 0;
-        unsigned char *fileData = LoadFileData(fileName, &dataSize);
+        FileView fileView = LoadFileView(fileName);
 
-        if (fileData != NULL)
+        if ((fileView.data != NULL) && (fileView.size <= INT_MAX))
         {
             int comp = 0;
             int *delays = NULL;
-            image.data = stbi_load_gif_from_memory(fileData, dataSize, &delays, &image.width, &image.height, &frameCount, &comp, 4);
+            image.data = stbi_load_gif_from_memory(fileView.data, (int)fileView.size, &delays, &image.width, &image.height, &frameCount, &comp, 4);
 
             image.mipmaps = 1;
             image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-            UnloadFileData(fileData);
             RL_FREE(delays);        // NOTE: Frames delays are discarded
         }
+
+        UnloadFileView(fileView);
     }
 #else
     if (false) { }
@@ -4301,6 +4301,24 @@ void UnloadTexture(Texture2D texture)
     }
 }
 
+// Reload texture from file in place, i.e. on watched file changes
+// NOTE: On failure previous texture is kept, texture parameters (filter, wrap) must be set again
+bool ReloadTexture(Texture2D *texture, const char *fileName)
+{
+    bool result = false;
+    Texture2D reloaded = LoadTexture(fileName);
+
+    if (IsTextureValid(reloaded))
+    {
+        UnloadTexture(*texture);
+        *texture = reloaded;
+        result = true;
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to reload texture, previous texture kept", fileName);
+
+    return result;
+}
+
 // Check if a render texture is valid (loaded in GPU)
 bool IsRenderTextureValid(RenderTexture2D target)
 {
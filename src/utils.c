@@ -7,6 +7,17 @@
 *           Show TraceLog() output messages
 *           NOTE: By default LOG_DEBUG traces not shown
 *
+*       #define SUPPORT_FILE_MAPPING
+*           Map files read-only into memory (mmap) on MapFileData(), instead of reading them
+*
+*       #define SUPPORT_FILE_ARCHIVES
+*           Mount packed file archives (.rpak) with MountArchive(), file loading functions resolve
+*           paths through mounted archives before accessing the file system
+*
+*       #define SUPPORT_FILE_WATCHER
+*           Watch files for changes on a background thread with WatchFile(), changed files are
+*           reported in batches by LoadChangedFiles(), inotify is used on Linux, files are polled otherwise
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -49,12 +60,223 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(SUPPORT_FILE_ARCHIVES)
+    #include <stdint.h>                 // Required for: uintptr_t
+    #if defined(SUPPORT_COMPRESSION_API)
+        #include "external/sinfl.h"     // Deflate (RFC 1951) decompressor [Implementation in rcore.c]
+        #include "external/sdefl.h"     // Deflate (RFC 1951) compressor [Implementation in rcore.c]
+    #endif
+#endif
+
+#if defined(_WIN32)
+    // NOTE: Declaring required Win32 functions to avoid including windows.h (conflicts with raylib names)
+    __declspec(dllimport) void *__stdcall CreateThread(void *threadAttributes, size_t stackSize, unsigned long (__stdcall *startAddress)(void *), void *parameter, unsigned long creationFlags, unsigned long *threadId);
+    __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+    __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+    __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+    __declspec(dllimport) void *__stdcall CreateFileA(const char *fileName, unsigned long access, unsigned long shareMode, void *securityAttributes, unsigned long creationDisposition, unsigned long flags, void *templateFile);
+    __declspec(dllimport) int __stdcall GetFileSizeEx(void *file, long long *fileSize);
+    __declspec(dllimport) void *__stdcall CreateFileMappingA(void *file, void *attributes, unsigned long protect, unsigned long maxSizeHigh, unsigned long maxSizeLow, const char *name);
+    __declspec(dllimport) void *__stdcall MapViewOfFile(void *mapping, unsigned long access, unsigned long offsetHigh, unsigned long offsetLow, size_t size);
+    __declspec(dllimport) int __stdcall UnmapViewOfFile(const void *address);
+    __declspec(dllimport) void *__stdcall CreateEventA(void *eventAttributes, int manualReset, int initialState, const char *name);
+    __declspec(dllimport) int __stdcall SetEvent(void *event);
+    __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void **lock);
+    __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void **lock);
+    __declspec(dllimport) int __stdcall SleepConditionVariableSRW(void **conditionVariable, void **lock, unsigned long milliseconds, unsigned long flags);
+    __declspec(dllimport) void __stdcall WakeAllConditionVariable(void **conditionVariable);
+#elif !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__)
+    #include <pthread.h>                // Required for: pthread_create(), pthread_join() [Used in RunParallelJobs()]
+    #include <unistd.h>                 // Required for: sysconf() [Used in GetWorkerThreadCount()]
+    #define UTILS_PTHREADS
+#endif
+
+// Memory-mapped files, Android assets and Emscripten virtual file system are not mapped
+#if defined(SUPPORT_FILE_MAPPING) && defined(SUPPORT_STANDARD_FILEIO) && !defined(PLATFORM_ANDROID) && !defined(__EMSCRIPTEN__)
+    #if defined(_WIN32)
+        #define UTILS_FILE_MAPPING
+    #elif defined(__unix__) || defined(__APPLE__)
+        #include <fcntl.h>              // Required for: open() [Used in MapFileData()]
+        #include <sys/mman.h>           // Required for: mmap(), munmap()
+        #include <sys/stat.h>           // Required for: fstat()
+        #include <unistd.h>             // Required for: close()
+        #define UTILS_FILE_MAPPING
+    #endif
+#endif
+
+// File watcher requires a background thread, Android assets are not watched
+#if defined(SUPPORT_FILE_WATCHER) && (defined(_WIN32) || defined(UTILS_PTHREADS)) && !defined(PLATFORM_ANDROID)
+    #include <sys/stat.h>               // Required for: stat() [Used in PollWatchedFiles()]
+    #if !defined(_WIN32)
+        #include <poll.h>               // Required for: poll()
+        #include <unistd.h>             // Required for: pipe(), read(), write(), close()
+        #include <time.h>               // Required for: clock_gettime() [Used in FileWatcherThread()]
+    #endif
+    #if defined(__linux__)
+        #include <sys/inotify.h>        // Required for: inotify_init1(), inotify_add_watch(), inotify_rm_watch()
+        #define UTILS_INOTIFY
+    #endif
+    #define UTILS_FILE_WATCHER
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_WORKER_THREADS
+    #define MAX_WORKER_THREADS           16         // Max number of worker threads for parallel jobs
+#endif
+#ifndef MAX_FILEPATH_LENGTH
+    #define MAX_FILEPATH_LENGTH        4096         // Maximum length for filepaths
+#endif
+#ifndef MAX_MOUNTED_ARCHIVES
+    #define MAX_MOUNTED_ARCHIVES          8         // Max number of file archives mounted at the same time
+#endif
+#ifndef ARCHIVE_DATA_ALIGNMENT
+    #define ARCHIVE_DATA_ALIGNMENT       64         // Archive entries data alignment in bytes (zero-copy mapped access)
+#endif
+#ifndef ARCHIVE_COMPRESSION_QUALITY
+    #define ARCHIVE_COMPRESSION_QUALITY   8         // Archive entries deflate compression level [0..8]
+#endif
+
+#ifndef FILE_WATCHER_POLL_INTERVAL
+    #define FILE_WATCHER_POLL_INTERVAL  250         // Watched files polling interval in milliseconds (files not watched by inotify)
+#endif
+
+#define ARCHIVE_FORMAT_VERSION            1         // Archive file format version
+
+#if defined(_WIN32)
+    #define LOCK_BACKGROUND_WORKER(w)       AcquireSRWLockExclusive(&(w)->lock)
+    #define UNLOCK_BACKGROUND_WORKER(w)     ReleaseSRWLockExclusive(&(w)->lock)
+    #define WAIT_BACKGROUND_WORKER(w)       SleepConditionVariableSRW(&(w)->signal, &(w)->lock, 0xffffffff, 0)
+    #define SIGNAL_BACKGROUND_WORKER(w)     WakeAllConditionVariable(&(w)->signal)
+#elif defined(UTILS_PTHREADS)
+    #define LOCK_BACKGROUND_WORKER(w)       pthread_mutex_lock(&(w)->lock)
+    #define UNLOCK_BACKGROUND_WORKER(w)     pthread_mutex_unlock(&(w)->lock)
+    #define WAIT_BACKGROUND_WORKER(w)       pthread_cond_wait(&(w)->signal, &(w)->lock)
+    #define SIGNAL_BACKGROUND_WORKER(w)     pthread_cond_broadcast(&(w)->signal)
+#endif
+
+#if defined(UTILS_FILE_WATCHER)
+    #if defined(_WIN32)
+        #define LOCK_FILE_WATCHER()     AcquireSRWLockExclusive(&watcher.lock)
+        #define UNLOCK_FILE_WATCHER()   ReleaseSRWLockExclusive(&watcher.lock)
+    #else
+        #define LOCK_FILE_WATCHER()     pthread_mutex_lock(&watcher.lock)
+        #define UNLOCK_FILE_WATCHER()   pthread_mutex_unlock(&watcher.lock)
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Worker thread data for parallel jobs
+typedef struct WorkerData {
+    ParallelJobFunc func;           // Job function
+    void *data;                     // Job user data
+    int jobStart;                   // First job index processed by worker
+    int jobCount;                   // Total number of jobs
+    int jobStride;                  // Job index stride (number of workers)
+} WorkerData;
+
+// Background job
+typedef struct BackgroundJob {
+    BackgroundJobFunc func;         // Job function
+    void *data;                     // Job user data
+} BackgroundJob;
+
+// Background worker data
+// NOTE: Jobs queue is shared with worker thread, access must be locked
+struct BackgroundWorker {
+    BackgroundJob *jobs;            // Jobs queue (ring)
+    int capacity;                   // Jobs queue capacity
+    int head;                       // Next job to run
+    int count;                      // Jobs queued, including job running
+    bool stop;                      // Worker thread stop requested
+#if defined(_WIN32)
+    void *thread;                   // Worker thread handle
+    void *lock;                     // Jobs queue lock (SRWLOCK)
+    void *signal;                   // Jobs queue changed (CONDITION_VARIABLE)
+#elif defined(UTILS_PTHREADS)
+    pthread_t thread;               // Worker thread
+    pthread_mutex_t lock;           // Jobs queue lock
+    pthread_cond_t signal;          // Jobs queue changed
+#endif
+};
+
+// Archive file header (32 bytes)
+// NOTE: Archive layout: [header][entries data (aligned)][entries table (sorted by hash)][names]
+// All values are stored little-endian, entries table is sorted by name hash and name
+typedef struct ArchiveHeader {
+    char id[4];                     // Archive file identifier: "rPAK"
+    unsigned int version;           // Archive format version
+    unsigned int entryCount;        // Number of entries
+    unsigned int alignment;         // Entries data alignment in bytes
+    unsigned long long tocOffset;   // Entries table offset in bytes
+    unsigned long long namesOffset; // Entries names offset in bytes, names are '\0' terminated
+} ArchiveHeader;
+
+// Archive file entry (40 bytes)
+typedef struct ArchiveEntry {
+    unsigned long long hash;        // Entry name hash (FNV-1a 64bit)
+    unsigned long long offset;      // Entry data offset in bytes
+    unsigned long long size;        // Entry data size in bytes
+    unsigned long long compSize;    // Entry compressed data size in bytes (DEFLATE), 0 if stored
+    unsigned int nameOffset;        // Entry name offset in names block
+    unsigned int reserved;          // Reserved for future use
+} ArchiveEntry;
+
+// Mounted archive data
+typedef struct FileArchive {
+    char *fileName;                 // Archive file name
+    char *mountPath;                // Archive mount path prefix, empty or ending with '/'
+    const unsigned char *data;      // Archive mapped data, NULL if not mapped (entries read from file)
+    size_t dataSize;                // Archive mapped data size
+    const ArchiveEntry *entries;    // Archive entries (pointing to mapped data or allocated)
+    const char *names;              // Archive entries names (pointing to mapped data or allocated)
+    unsigned int entryCount;        // Archive entries count
+} FileArchive;
+
+// Archive entry data for export
+typedef struct ArchiveExportEntry {
+    ArchiveEntry entry;             // Archive entry
+    char *name;                     // Archive entry name
+} ArchiveExportEntry;
+
+#if defined(UTILS_FILE_WATCHER)
+// Watched file data
+typedef struct WatchedFile {
+    char *fileName;                 // File name
+    const char *name;               // File name without directory path (pointing to fileName)
+    int watchDescriptor;            // Directory watch descriptor (inotify), -1 if file is polled
+    long long modTime;              // File modification time (polled files)
+    long long size;                 // File size (polled files)
+    bool changed;                   // File changed, pending to be reported by LoadChangedFiles()
+} WatchedFile;
+
+// File watcher data
+// NOTE: Watched files data is shared with watcher thread, access must be locked
+typedef struct FileWatcher {
+    WatchedFile *files;             // Watched files
+    int count;                      // Watched files count
+    int capacity;                   // Watched files capacity
+    int changedCount;               // Changed files count, pending to be reported
+    int polledCount;                // Polled files count
+    bool running;                   // Watcher thread running
+#if defined(_WIN32)
+    void *thread;                   // Watcher thread handle
+    void *wakeEvent;                // Watcher thread stop event
+    void *lock;                     // Watcher data lock (SRWLOCK)
+#else
+    pthread_t thread;               // Watcher thread
+    pthread_mutex_t lock;           // Watcher data lock
+    int wakePipe[2];                // Watcher thread wake up pipe
+    int notifyFd;                   // inotify file descriptor, -1 if not available
+#endif
+} FileWatcher;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -67,6 +289,15 @@ static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback fun
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+#if defined(SUPPORT_FILE_ARCHIVES)
+static FileArchive archives[MAX_MOUNTED_ARCHIVES] = { 0 };  // Mounted archives, searched from last to first
+static int archiveCount = 0;                        // Mounted archives count
+#endif
+
+#if defined(UTILS_FILE_WATCHER)
+static FileWatcher watcher = { 0 };                 // File watcher, started with first watched file
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -94,6 +325,38 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+static const unsigned char *MapFileSystemData(const char *fileName, size_t *dataSize);  // Map file data from file system
+
+#if defined(SUPPORT_FILE_ARCHIVES)
+static void GetArchivePath(const char *fileName, char *path);                          // Get normalized archive path ('/' separators, no leading "./")
+static unsigned long long GetArchiveNameHash(const char *name);                         // Get archive entry name hash (FNV-1a 64bit)
+static int CompareArchiveEntries(const void *a, const void *b);                         // Compare archive entries by hash and name, used by qsort()
+static const FileArchive *FindArchiveEntry(const char *fileName, const ArchiveEntry **entry);  // Find file entry in mounted archives
+static unsigned char *LoadArchiveEntryData(const FileArchive *archive, const ArchiveEntry *entry, int extraSize, int *dataSize);   // Load archive entry data
+#endif
+
+#if defined(UTILS_FILE_WATCHER)
+static bool StartFileWatcher(void);                         // Start file watcher thread
+static void StopFileWatcher(void);                          // Stop file watcher thread
+static void PollWatchedFiles(void);                         // Poll watched files modification time and size
+#if defined(UTILS_INOTIFY)
+static void ReadFileWatcherEvents(void);                    // Read inotify events and flag changed files
+#endif
+#if defined(_WIN32)
+static unsigned long __stdcall FileWatcherThread(void *arg);    // File watcher thread
+#else
+static void *FileWatcherThread(void *arg);                  // File watcher thread
+#endif
+#endif
+
+#if defined(_WIN32)
+static unsigned long __stdcall WorkerThread(void *arg);    // Worker thread for parallel jobs
+static unsigned long __stdcall BackgroundWorkerThread(void *arg);  // Background worker thread, runs queued jobs
+#elif defined(UTILS_PTHREADS)
+static void *WorkerThread(void *arg);                       // Worker thread for parallel jobs
+static void *BackgroundWorkerThread(void *arg);             // Background worker thread, runs queued jobs
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -191,6 +454,17 @@ unsigned char *LoadFileData(const char *fileName, int *dataSize)
             data = loadFileData(fileName, dataSize);
             return data;
         }
+#if defined(SUPPORT_FILE_ARCHIVES)
+        const ArchiveEntry *entry = NULL;
+        const FileArchive *archive = FindArchiveEntry(fileName, &entry);
+
+        if (archive != NULL)
+        {
+            data = LoadArchiveEntryData(archive, entry, 0, dataSize);
+            if (data != NULL) TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully from archive [%s]", fileName, archive->fileName);
+            return data;
+        }
+#endif
 #if defined(SUPPORT_STANDARD_FILEIO)
         FILE *file = fopen(fileName, "rb");
 
@@ -250,6 +524,433 @@ void UnloadFileData(unsigned char *data)
     RL_FREE(data);
 }
 
+// Map file data read-only into memory
+// NOTE: Pages are loaded on access and can be evicted by the OS, returns NULL if file mapping is not
+// available (platform, custom file data loader, empty file) and callers should fall back to LoadFileData()
+// NOTE: Stored entries of mounted archives are returned without copy, compressed entries return NULL
+const unsigned char *MapFileData(const char *fileName, size_t *dataSize)
+{
+    const unsigned char *data = NULL;
+    *dataSize = 0;
+
+    if ((fileName == NULL) || (loadFileData != NULL)) return NULL;
+
+#if defined(SUPPORT_FILE_ARCHIVES)
+    const ArchiveEntry *entry = NULL;
+    const FileArchive *archive = FindArchiveEntry(fileName, &entry);
+
+    if (archive != NULL)
+    {
+        if ((archive->data != NULL) && (entry->compSize == 0) && (entry->size > 0))
+        {
+            data = archive->data + entry->offset;
+            *dataSize = (size_t)entry->size;
+
+            TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully from archive [%s]", fileName, archive->fileName);
+        }
+
+        return data;
+    }
+#endif
+
+    data = MapFileSystemData(fileName, dataSize);
+
+    if (data != NULL) TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+
+    return data;
+}
+
+// Unmap file data mapped by MapFileData()
+void UnmapFileData(const unsigned char *data, size_t dataSize)
+{
+    if (data == NULL) return;
+
+#if defined(SUPPORT_FILE_ARCHIVES)
+    // Archived file data is owned by the mounted archive
+    for (int i = 0; i < archiveCount; i++)
+    {
+        if ((archives[i].data != NULL) && ((uintptr_t)data >= (uintptr_t)archives[i].data) &&
+            ((uintptr_t)data < ((uintptr_t)archives[i].data + archives[i].dataSize))) return;
+    }
+#endif
+
+#if defined(UTILS_FILE_MAPPING)
+#if defined(_WIN32)
+    UnmapViewOfFile(data);
+#else
+    munmap((void *)data, dataSize);
+#endif
+#else
+    (void)dataSize;
+#endif
+}
+
+// Load file data view (read-only)
+// NOTE: File is memory-mapped if available, no file data copy is done and files bigger than
+// INT_MAX bytes can be viewed, otherwise file data is loaded with LoadFileData() (custom callback)
+FileView LoadFileView(const char *fileName)
+{
+    FileView view = { 0 };
+    size_t mappedSize = 0;
+
+    view.data = MapFileData(fileName, &mappedSize);
+
+    if (view.data != NULL)
+    {
+        view.size = mappedSize;
+        view.mapped = true;
+    }
+    else
+    {
+        int dataSize = 0;
+        view.data = LoadFileData(fileName, &dataSize);
+        view.size = dataSize;
+    }
+
+    return view;
+}
+
+// Unload file data view loaded with LoadFileView()
+void UnloadFileView(FileView view)
+{
+    if (view.mapped) UnmapFileData(view.data, (size_t)view.size);
+    else UnloadFileData((unsigned char *)view.data);
+}
+
+// Mount archive, archived files are accessed by their archive path prefixed with mountPath
+// NOTE: Archive is memory-mapped if available, otherwise only the entries table is loaded and
+// entries data is read from archive file on request, archives mounted later take precedence
+bool MountArchive(const char *fileName, const char *mountPath)
+{
+    bool result = false;
+
+#if defined(SUPPORT_FILE_ARCHIVES)
+    if (fileName == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+        return false;
+    }
+
+    if (archiveCount >= MAX_MOUNTED_ARCHIVES)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to mount archive, maximum mounted archives reached (%i)", fileName, MAX_MOUNTED_ARCHIVES);
+        return false;
+    }
+
+    FileArchive archive = { 0 };
+    ArchiveHeader header = { 0 };
+    unsigned long long fileSize = 0;
+    unsigned char *table = NULL;
+
+    archive.data = MapFileSystemData(fileName, &archive.dataSize);
+
+    if (archive.data != NULL)
+    {
+        fileSize = archive.dataSize;
+        if (fileSize >= sizeof(ArchiveHeader)) memcpy(&header, archive.data, sizeof(ArchiveHeader));
+    }
+#if defined(SUPPORT_STANDARD_FILEIO)
+    else
+    {
+        FILE *file = fopen(fileName, "rb");
+
+        if (file != NULL)
+        {
+            fseek(file, 0, SEEK_END);
+            long int size = ftell(file);
+            fseek(file, 0, SEEK_SET);
+
+            if ((size >= (long int)sizeof(ArchiveHeader)) && (fread(&header, sizeof(ArchiveHeader), 1, file) == 1))
+            {
+                fileSize = (unsigned long long)size;
+
+                // Load entries table and names, entries data is read on request
+                if ((header.tocOffset >= sizeof(ArchiveHeader)) && (header.tocOffset < fileSize))
+                {
+                    table = (unsigned char *)RL_MALLOC((size_t)(fileSize - header.tocOffset));
+
+                    if ((table != NULL) && ((fseek(file, (long int)header.tocOffset, SEEK_SET) != 0) ||
+                        (fread(table, 1, (size_t)(fileSize - header.tocOffset), file) != (size_t)(fileSize - header.tocOffset))))
+                    {
+                        RL_FREE(table);
+                        table = NULL;
+                    }
+                }
+            }
+
+            fclose(file);
+        }
+    }
+#endif
+
+    // Validate archive header, entries and names
+    bool valid = (memcmp(header.id, "rPAK", 4) == 0) && (header.version == ARCHIVE_FORMAT_VERSION) &&
+        ((header.tocOffset%8) == 0) && (header.tocOffset >= sizeof(ArchiveHeader)) &&
+        (header.namesOffset >= header.tocOffset) && (header.namesOffset <= fileSize) &&
+        ((unsigned long long)header.entryCount*sizeof(ArchiveEntry) <= (header.namesOffset - header.tocOffset)) &&
+        ((archive.data != NULL) || (table != NULL));
+
+    if (valid)
+    {
+        unsigned long long namesSize = fileSize - header.namesOffset;
+
+        if (archive.data != NULL)
+        {
+            archive.entries = (const ArchiveEntry *)(archive.data + header.tocOffset);
+            archive.names = (const char *)(archive.data + header.namesOffset);
+        }
+        else
+        {
+            archive.entries = (const ArchiveEntry *)table;
+            archive.names = (const char *)(table + (header.namesOffset - header.tocOffset));
+        }
+
+        archive.entryCount = header.entryCount;
+
+        if ((header.entryCount > 0) && ((namesSize == 0) || (archive.names[namesSize - 1] != '\0'))) valid = false;
+
+        for (unsigned int i = 0; valid && (i < header.entryCount); i++)
+        {
+            const ArchiveEntry *entry = &archive.entries[i];
+            unsigned long long storedSize = (entry->compSize > 0)? entry->compSize : entry->size;
+
+            if ((entry->nameOffset >= namesSize) || (entry->offset > header.tocOffset) ||
+                (storedSize > (header.tocOffset - entry->offset)) || ((i > 0) && (entry->hash < archive.entries[i - 1].hash))) valid = false;
+        }
+    }
+
+    if (valid)
+    {
+        char path[MAX_FILEPATH_LENGTH] = { 0 };
+        GetArchivePath((mountPath != NULL)? mountPath : "", path);
+
+        int pathLength = (int)strlen(path);
+        if ((pathLength > 0) && (path[pathLength - 1] != '/')) path[pathLength++] = '/';
+
+        archive.fileName = (char *)RL_CALLOC(strlen(fileName) + 1, 1);
+        archive.mountPath = (char *)RL_CALLOC(pathLength + 1, 1);
+        strcpy(archive.fileName, fileName);
+        memcpy(archive.mountPath, path, pathLength);
+
+        archives[archiveCount] = archive;
+        archiveCount++;
+        result = true;
+
+        TRACELOG(LOG_INFO, "FILEIO: [%s] Archive mounted successfully (%i entries)", fileName, header.entryCount);
+    }
+    else
+    {
+        if (archive.data != NULL) UnmapFileData(archive.data, archive.dataSize);
+        RL_FREE(table);
+
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to mount archive, file not found or not valid", fileName);
+    }
+#else
+    (void)mountPath;
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] File archives not supported", fileName);
+#endif
+
+    return result;
+}
+
+// Unmount archive mounted with MountArchive()
+// WARNING: Archived data returned by MapFileData() or LoadFileView() must be released before unmounting
+void UnmountArchive(const char *fileName)
+{
+#if defined(SUPPORT_FILE_ARCHIVES)
+    for (int i = archiveCount - 1; i >= 0; i--)
+    {
+        if ((fileName != NULL) && (strcmp(archives[i].fileName, fileName) == 0))
+        {
+            FileArchive archive = archives[i];
+
+            // Keep mounting order of remaining archives
+            for (int k = i; k < archiveCount - 1; k++) archives[k] = archives[k + 1];
+            archiveCount--;
+            archives[archiveCount] = (FileArchive){ 0 };
+
+            if (archive.data != NULL) UnmapFileData(archive.data, archive.dataSize);
+            else RL_FREE((void *)archive.entries);
+
+            RL_FREE(archive.fileName);
+            RL_FREE(archive.mountPath);
+
+            TRACELOG(LOG_INFO, "FILEIO: [%s] Archive unmounted successfully", fileName);
+            return;
+        }
+    }
+
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] Archive not mounted", fileName);
+#else
+    (void)fileName;
+#endif
+}
+
+// Export files into archive, entries are named by file path relative to basePath (NULL for full path)
+// NOTE: Entries are compressed (DEFLATE) when it saves at least 1/8 of the data size, stored otherwise,
+// stored entries data is aligned to ARCHIVE_DATA_ALIGNMENT and can be accessed without copy when mapped
+bool ExportArchive(const char *fileName, FilePathList files, const char *basePath)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILE_ARCHIVES) && defined(SUPPORT_STANDARD_FILEIO)
+    if (fileName == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+        return false;
+    }
+
+    FILE *file = fopen(fileName, "wb");
+
+    if (file == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open archive file", fileName);
+        return false;
+    }
+
+    static const unsigned char padding[ARCHIVE_DATA_ALIGNMENT] = { 0 };
+
+    ArchiveHeader header = { .id = { 'r', 'P', 'A', 'K' }, .version = ARCHIVE_FORMAT_VERSION, .alignment = ARCHIVE_DATA_ALIGNMENT };
+    ArchiveExportEntry *entries = (ArchiveExportEntry *)RL_CALLOC((files.count > 0)? files.count : 1, sizeof(ArchiveExportEntry));
+    unsigned long long offset = sizeof(ArchiveHeader);
+    unsigned int entryCount = 0;
+    bool ok = (entries != NULL) && (fwrite(&header, sizeof(ArchiveHeader), 1, file) == 1);
+
+#if defined(SUPPORT_COMPRESSION_API)
+    struct sdefl *sdefl = (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl));   // WARNING: struct sdefl is almost 1MB
+    ok = ok && (sdefl != NULL);
+#endif
+
+    char path[MAX_FILEPATH_LENGTH] = { 0 };
+    char base[MAX_FILEPATH_LENGTH] = { 0 };
+    GetArchivePath((basePath != NULL)? basePath : "", base);
+
+    int baseLength = (int)strlen(base);
+    if ((baseLength > 0) && (base[baseLength - 1] == '/')) base[--baseLength] = '\0';
+
+    for (unsigned int i = 0; ok && (i < files.count); i++)
+    {
+        int dataSize = 0;
+        unsigned char *data = LoadFileData(files.paths[i], &dataSize);
+
+        if (data == NULL)
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] File skipped from archive", files.paths[i]);
+            continue;
+        }
+
+        // Get entry name relative to base path
+        GetArchivePath(files.paths[i], path);
+        const char *name = path;
+        if ((baseLength > 0) && (strncmp(path, base, baseLength) == 0) && (path[baseLength] == '/')) name = path + baseLength + 1;
+
+        ArchiveExportEntry *entry = &entries[entryCount];
+        entry->name = (char *)RL_CALLOC(strlen(name) + 1, 1);
+        strcpy(entry->name, name);
+        entry->entry.hash = GetArchiveNameHash(name);
+        entry->entry.size = (unsigned long long)dataSize;
+
+        // Align entry data
+        unsigned int paddingSize = (unsigned int)((ARCHIVE_DATA_ALIGNMENT - offset%ARCHIVE_DATA_ALIGNMENT)%ARCHIVE_DATA_ALIGNMENT);
+        ok = (fwrite(padding, 1, paddingSize, file) == paddingSize);
+        offset += paddingSize;
+        entry->entry.offset = offset;
+
+        const unsigned char *storedData = data;
+        int storedSize = dataSize;
+        unsigned char *compData = NULL;
+
+#if defined(SUPPORT_COMPRESSION_API)
+        compData = (unsigned char *)RL_MALLOC(sdefl_bound(dataSize));
+
+        if (compData != NULL)
+        {
+            int compSize = sdeflate(sdefl, compData, data, dataSize, ARCHIVE_COMPRESSION_QUALITY);
+
+            if ((compSize > 0) && (compSize <= (dataSize - dataSize/8)))
+            {
+                storedData = compData;
+                storedSize = compSize;
+                entry->entry.compSize = (unsigned long long)compSize;
+            }
+        }
+#endif
+
+        ok = ok && (fwrite(storedData, 1, storedSize, file) == (size_t)storedSize);
+        offset += (unsigned long long)storedSize;
+        entryCount++;
+
+        RL_FREE(compData);
+        UnloadFileData(data);
+    }
+
+#if defined(SUPPORT_COMPRESSION_API)
+    RL_FREE(sdefl);
+#endif
+
+    if (ok)
+    {
+        // Write entries table sorted by name hash, followed by entries names
+        qsort(entries, entryCount, sizeof(ArchiveExportEntry), CompareArchiveEntries);
+
+        unsigned int nameOffset = 0;
+        for (unsigned int i = 0; i < entryCount; i++)
+        {
+            entries[i].entry.nameOffset = nameOffset;
+            nameOffset += (unsigned int)strlen(entries[i].name) + 1;
+        }
+
+        unsigned int paddingSize = (unsigned int)((8 - offset%8)%8);
+        ok = (fwrite(padding, 1, paddingSize, file) == paddingSize);
+        header.tocOffset = offset + paddingSize;
+        header.namesOffset = header.tocOffset + (unsigned long long)entryCount*sizeof(ArchiveEntry);
+        header.entryCount = entryCount;
+
+        for (unsigned int i = 0; ok && (i < entryCount); i++) ok = (fwrite(&entries[i].entry, sizeof(ArchiveEntry), 1, file) == 1);
+        for (unsigned int i = 0; ok && (i < entryCount); i++) ok = (fwrite(entries[i].name, 1, strlen(entries[i].name) + 1, file) == (strlen(entries[i].name) + 1));
+
+        ok = ok && (fseek(file, 0, SEEK_SET) == 0) && (fwrite(&header, sizeof(ArchiveHeader), 1, file) == 1);
+    }
+
+    if (fclose(file) != 0) ok = false;
+
+    if (entries != NULL) for (unsigned int i = 0; i < entryCount; i++) RL_FREE(entries[i].name);
+    RL_FREE(entries);
+
+    success = ok;
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Archive exported successfully (%i entries)", fileName, entryCount);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export archive", fileName);
+#else
+    (void)files;
+    (void)basePath;
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] File archives not supported", fileName);
+#endif
+
+    return success;
+}
+
+// Check if file is available in mounted archives, returns archived file size
+bool IsFileArchived(const char *fileName, size_t *dataSize)
+{
+    bool result = false;
+    *dataSize = 0;
+
+#if defined(SUPPORT_FILE_ARCHIVES)
+    const ArchiveEntry *entry = NULL;
+
+    if ((loadFileData == NULL) && (FindArchiveEntry(fileName, &entry) != NULL))
+    {
+        *dataSize = (size_t)entry->size;
+        result = true;
+    }
+#else
+    (void)fileName;
+#endif
+
+    return result;
+}
+
 // Save data to file from buffer
 bool SaveFileData(const char *fileName, void *data, int dataSize)
 {
@@ -353,6 +1054,25 @@ char *LoadFileText(const char *fileName)
             text = loadFileText(fileName);
             return text;
         }
+#if defined(SUPPORT_FILE_ARCHIVES)
+        const ArchiveEntry *entry = NULL;
+        const FileArchive *archive = FindArchiveEntry(fileName, &entry);
+
+        if (archive != NULL)
+        {
+            // NOTE: Archived text is loaded as stored, no carriage return-linefeed translation is done
+            int size = 0;
+            text = (char *)LoadArchiveEntryData(archive, entry, 1, &size);
+
+            if (text != NULL)
+            {
+                text[size] = '\0';
+                TRACELOG(LOG_INFO, "FILEIO: [%s] Text file loaded successfully from archive [%s]", fileName, archive->fileName);
+            }
+
+            return text;
+        }
+#endif
 #if defined(SUPPORT_STANDARD_FILEIO)
         FILE *file = fopen(fileName, "rt");
 
@@ -438,15 +1158,406 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
-#if defined(PLATFORM_ANDROID)
-// Initialize asset manager from android app
-void InitAssetManager(AAssetManager *manager, const char *dataPath)
+// Start watching file for changes
+// NOTE: Changes are detected on a background thread and reported in batches by LoadChangedFiles(),
+// on Linux the file directory is watched with inotify (editors saving by rename are detected),
+// on other platforms or if inotify is not available, file modification time and size are polled
+bool WatchFile(const char *fileName)
 {
-    assetManager = manager;
-    internalDataPath = dataPath;
-}
+    bool result = false;
 
-// Replacement for fopen()
+#if defined(UTILS_FILE_WATCHER)
+    if ((fileName == NULL) || (fileName[0] == '\0') || (strlen(fileName) >= MAX_FILEPATH_LENGTH))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+        return false;
+    }
+
+    if (!watcher.running && !StartFileWatcher()) return false;
+
+    bool wakeWatcher = false;
+
+    LOCK_FILE_WATCHER();
+
+    for (int i = 0; i < watcher.count; i++)
+    {
+        if (strcmp(watcher.files[i].fileName, fileName) == 0)
+        {
+            result = true;  // File already watched
+            break;
+        }
+    }
+
+    if (!result && (watcher.count >= watcher.capacity))
+    {
+        int capacity = (watcher.capacity > 0)? watcher.capacity*2 : 64;
+        WatchedFile *files = (WatchedFile *)RL_REALLOC(watcher.files, capacity*sizeof(WatchedFile));
+
+        if (files != NULL)
+        {
+            watcher.files = files;
+            watcher.capacity = capacity;
+        }
+    }
+
+    if (!result && (watcher.count < watcher.capacity))
+    {
+        WatchedFile file = { 0 };
+        int length = (int)strlen(fileName);
+
+        file.fileName = (char *)RL_MALLOC(length + 1);
+        if (file.fileName != NULL)
+        {
+            memcpy(file.fileName, fileName, length + 1);
+
+            // Get file name without directory path
+            file.name = file.fileName;
+            for (int i = 0; i < length; i++) if ((fileName[i] == '/') || (fileName[i] == '\\')) file.name = file.fileName + i + 1;
+            file.watchDescriptor = -1;
+
+        #if defined(UTILS_INOTIFY)
+            if (watcher.notifyFd >= 0)
+            {
+                // Watch file directory, watch descriptor is shared by all files in the same directory
+                char dirPath[MAX_FILEPATH_LENGTH] = { 0 };
+                int dirLength = (int)(file.name - file.fileName);
+
+                if (dirLength == 0) dirPath[0] = '.';
+                else if (dirLength == 1) dirPath[0] = '/';
+                else memcpy(dirPath, fileName, dirLength - 1);
+
+                file.watchDescriptor = inotify_add_watch(watcher.notifyFd, dirPath, IN_CLOSE_WRITE | IN_MOVED_TO);
+                if (file.watchDescriptor < 0) TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to watch directory, file is polled", dirPath);
+            }
+        #endif
+            if (file.watchDescriptor < 0)
+            {
+                struct stat info = { 0 };
+                if (stat(fileName, &info) == 0)
+                {
+                    file.modTime = (long long)info.st_mtime;
+                    file.size = (long long)info.st_size;
+                }
+
+                watcher.polledCount++;
+                wakeWatcher = true;
+            }
+
+            watcher.files[watcher.count] = file;
+            watcher.count++;
+            result = true;
+        }
+    }
+
+    UNLOCK_FILE_WATCHER();
+
+#if !defined(_WIN32)
+    // Wake up watcher thread to start polling files
+    if (wakeWatcher && (write(watcher.wakePipe[1], "w", 1) < 0)) TRACELOG(LOG_WARNING, "FILEIO: Failed to wake up file watcher");
+#endif
+
+    if (result) TRACELOGD("FILEIO: [%s] File watched for changes", fileName);
+    else
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to watch file", fileName);
+        if (watcher.count == 0) StopFileWatcher();
+    }
+#else
+    (void)fileName;
+    TRACELOG(LOG_WARNING, "FILEIO: File watcher not supported");
+#endif
+
+    return result;
+}
+
+// Stop watching file for changes
+// NOTE: Watcher thread is stopped when no files are watched
+void UnwatchFile(const char *fileName)
+{
+#if defined(UTILS_FILE_WATCHER)
+    if (!watcher.running || (fileName == NULL)) return;
+
+    LOCK_FILE_WATCHER();
+
+    for (int i = 0; i < watcher.count; i++)
+    {
+        WatchedFile *file = &watcher.files[i];
+
+        if (strcmp(file->fileName, fileName) == 0)
+        {
+        #if defined(UTILS_INOTIFY)
+            if (file->watchDescriptor >= 0)
+            {
+                // Remove directory watch if not used by other watched files
+                bool shared = false;
+                for (int k = 0; k < watcher.count; k++)
+                {
+                    if ((k != i) && (watcher.files[k].watchDescriptor == file->watchDescriptor))
+                    {
+                        shared = true;
+                        break;
+                    }
+                }
+
+                if (!shared) inotify_rm_watch(watcher.notifyFd, file->watchDescriptor);
+            }
+        #endif
+            if (file->watchDescriptor < 0) watcher.polledCount--;
+            if (file->changed) watcher.changedCount--;
+
+            RL_FREE(file->fileName);
+            memmove(file, file + 1, (watcher.count - i - 1)*sizeof(WatchedFile));
+            watcher.count--;
+            break;
+        }
+    }
+
+    int count = watcher.count;
+
+    UNLOCK_FILE_WATCHER();
+
+    if (count == 0) StopFileWatcher();
+#else
+    (void)fileName;
+#endif
+}
+
+// Load changed watched files paths, changes detected since previous call
+// NOTE: Paths pointers and strings are allocated in a single memory block
+FilePathList LoadChangedFiles(void)
+{
+    FilePathList files = { 0 };
+
+#if defined(UTILS_FILE_WATCHER)
+    if (!watcher.running) return files;
+
+    LOCK_FILE_WATCHER();
+
+    if (watcher.changedCount > 0)
+    {
+        size_t size = 0;
+        for (int i = 0; i < watcher.count; i++) if (watcher.files[i].changed) size += strlen(watcher.files[i].fileName) + 1;
+
+        char **paths = (char **)RL_MALLOC(watcher.changedCount*sizeof(char *) + size);
+
+        if (paths != NULL)
+        {
+            char *data = (char *)(paths + watcher.changedCount);
+
+            for (int i = 0; i < watcher.count; i++)
+            {
+                WatchedFile *file = &watcher.files[i];
+
+                if (file->changed)
+                {
+                    size_t length = strlen(file->fileName) + 1;
+                    memcpy(data, file->fileName, length);
+                    paths[files.count] = data;
+                    data += length;
+
+                    files.count++;
+                    file->changed = false;
+                }
+            }
+
+            files.capacity = files.count;
+            files.paths = paths;
+            watcher.changedCount = 0;
+        }
+    }
+
+    UNLOCK_FILE_WATCHER();
+#endif
+
+    return files;
+}
+
+// Unload changed files paths
+void UnloadChangedFiles(FilePathList files)
+{
+    RL_FREE(files.paths);
+}
+
+// Get number of worker threads used for parallel jobs (CPU cores available)
+int GetWorkerThreadCount(void)
+{
+    int count = 1;
+
+#if defined(_WIN32)
+    count = (int)GetActiveProcessorCount(0xffff);   // ALL_PROCESSOR_GROUPS
+#elif defined(UTILS_PTHREADS)
+    count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    if (count < 1) count = 1;
+    if (count > MAX_WORKER_THREADS) count = MAX_WORKER_THREADS;
+
+    return count;
+}
+
+// Run jobs [0..jobCount) in parallel, returns when all jobs are done
+// NOTE: Jobs are distributed interleaved between workers, calling thread also works as a worker,
+// jobs are run serially if threads are not available or can not be created
+void RunParallelJobs(ParallelJobFunc func, void *data, int jobCount)
+{
+    int workerCount = GetWorkerThreadCount();
+    if (workerCount > jobCount) workerCount = jobCount;
+    if (workerCount < 1) return;
+
+    WorkerData workers[MAX_WORKER_THREADS] = { 0 };
+    for (int i = 0; i < workerCount; i++) workers[i] = (WorkerData){ func, data, i, jobCount, workerCount };
+
+#if defined(_WIN32)
+    void *threads[MAX_WORKER_THREADS] = { 0 };
+    for (int i = 1; i < workerCount; i++) threads[i] = CreateThread(NULL, 0, WorkerThread, &workers[i], 0, NULL);
+    WorkerThread(&workers[0]);
+
+    for (int i = 1; i < workerCount; i++)
+    {
+        if (threads[i] != NULL)
+        {
+            WaitForSingleObject(threads[i], 0xffffffff);    // INFINITE
+            CloseHandle(threads[i]);
+        }
+        else WorkerThread(&workers[i]);     // Thread not created, run its jobs in calling thread
+    }
+#elif defined(UTILS_PTHREADS)
+    pthread_t threads[MAX_WORKER_THREADS] = { 0 };
+    bool created[MAX_WORKER_THREADS] = { 0 };
+    for (int i = 1; i < workerCount; i++) created[i] = (pthread_create(&threads[i], NULL, WorkerThread, &workers[i]) == 0);
+    WorkerThread(&workers[0]);
+
+    for (int i = 1; i < workerCount; i++)
+    {
+        if (created[i]) pthread_join(threads[i], NULL);
+        else WorkerThread(&workers[i]);     // Thread not created, run its jobs in calling thread
+    }
+#else
+    for (int i = 0; i < jobCount; i++) func(data, i);
+#endif
+}
+
+// Load background worker thread, jobs queue limited to capacity
+// NOTE: Jobs are run in the calling thread (on push) if threads are not available
+BackgroundWorker *LoadBackgroundWorker(int capacity)
+{
+    if (capacity < 1) capacity = 1;
+
+    BackgroundWorker *worker = (BackgroundWorker *)RL_CALLOC(1, sizeof(BackgroundWorker));
+    if (worker == NULL) return NULL;
+
+    worker->jobs = (BackgroundJob *)RL_CALLOC(capacity, sizeof(BackgroundJob));
+    worker->capacity = capacity;
+
+    bool success = (worker->jobs != NULL);
+
+#if defined(_WIN32)
+    // NOTE: SRWLOCK and CONDITION_VARIABLE are zero initialized
+    if (success) worker->thread = CreateThread(NULL, 0, BackgroundWorkerThread, worker, 0, NULL);
+    success = success && (worker->thread != NULL);
+#elif defined(UTILS_PTHREADS)
+    if (success)
+    {
+        pthread_mutex_init(&worker->lock, NULL);
+        pthread_cond_init(&worker->signal, NULL);
+
+        if (pthread_create(&worker->thread, NULL, BackgroundWorkerThread, worker) != 0)
+        {
+            pthread_cond_destroy(&worker->signal);
+            pthread_mutex_destroy(&worker->lock);
+            success = false;
+        }
+    }
+#endif
+
+    if (!success)
+    {
+        TRACELOG(LOG_WARNING, "THREAD: Failed to start background worker");
+        RL_FREE(worker->jobs);
+        RL_FREE(worker);
+        worker = NULL;
+    }
+
+    return worker;
+}
+
+// Unload background worker, waits for queued jobs to finish
+void UnloadBackgroundWorker(BackgroundWorker *worker)
+{
+    if (worker == NULL) return;
+
+#if defined(_WIN32) || defined(UTILS_PTHREADS)
+    LOCK_BACKGROUND_WORKER(worker);
+    worker->stop = true;
+    SIGNAL_BACKGROUND_WORKER(worker);
+    UNLOCK_BACKGROUND_WORKER(worker);
+
+    #if defined(_WIN32)
+    WaitForSingleObject(worker->thread, 0xffffffff);    // INFINITE
+    CloseHandle(worker->thread);
+    #else
+    pthread_join(worker->thread, NULL);
+    pthread_cond_destroy(&worker->signal);
+    pthread_mutex_destroy(&worker->lock);
+    #endif
+#endif
+
+    RL_FREE(worker->jobs);
+    RL_FREE(worker);
+}
+
+// Queue background job, returns false if queue is full
+bool PushBackgroundJob(BackgroundWorker *worker, BackgroundJobFunc func, void *data)
+{
+    bool result = false;
+
+    if ((worker == NULL) || (func == NULL)) return result;
+
+#if defined(_WIN32) || defined(UTILS_PTHREADS)
+    LOCK_BACKGROUND_WORKER(worker);
+
+    if (worker->count < worker->capacity)
+    {
+        worker->jobs[(worker->head + worker->count)%worker->capacity] = (BackgroundJob){ func, data };
+        worker->count++;
+        SIGNAL_BACKGROUND_WORKER(worker);
+        result = true;
+    }
+
+    UNLOCK_BACKGROUND_WORKER(worker);
+#else
+    func(data);
+    result = true;
+#endif
+
+    return result;
+}
+
+// Get background jobs queued or running
+int GetBackgroundJobCount(BackgroundWorker *worker)
+{
+    int count = 0;
+
+    if (worker == NULL) return count;
+
+#if defined(_WIN32) || defined(UTILS_PTHREADS)
+    LOCK_BACKGROUND_WORKER(worker);
+    count = worker->count;
+    UNLOCK_BACKGROUND_WORKER(worker);
+#endif
+
+    return count;
+}
+
+#if defined(PLATFORM_ANDROID)
+// Initialize asset manager from android app
+void InitAssetManager(AAssetManager *manager, const char *dataPath)
+{
+    assetManager = manager;
+    internalDataPath = dataPath;
+}
+
+// Replacement for fopen()
 // Ref: https://developer.android.com/ndk/reference/group/asset
 FILE *android_fopen(const char *fileName, const char *mode)
 {
@@ -508,3 +1619,512 @@ static int android_close(void *cookie)
     return 0;
 }
 #endif  // PLATFORM_ANDROID
+
+// Map file data read-only into memory from file system
+static const unsigned char *MapFileSystemData(const char *fileName, size_t *dataSize)
+{
+    const unsigned char *data = NULL;
+    *dataSize = 0;
+
+#if defined(UTILS_FILE_MAPPING)
+#if defined(_WIN32)
+    void *file = CreateFileA(fileName, 0x80000000, 0x00000001, NULL, 3, 0x80, NULL);    // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+
+    if (file != (void *)(size_t)-1)     // INVALID_HANDLE_VALUE
+    {
+        long long size = 0;
+
+        if (GetFileSizeEx(file, &size) && (size > 0))
+        {
+            void *mapping = CreateFileMappingA(file, NULL, 0x02, 0, 0, NULL);    // PAGE_READONLY
+
+            if (mapping != NULL)
+            {
+                data = (const unsigned char *)MapViewOfFile(mapping, 0x0004, 0, 0, 0);  // FILE_MAP_READ
+                CloseHandle(mapping);   // View keeps the mapping alive
+            }
+
+            if (data != NULL) *dataSize = (size_t)size;
+        }
+
+        CloseHandle(file);
+    }
+#else
+    int file = open(fileName, O_RDONLY);
+
+    if (file >= 0)
+    {
+        struct stat info = { 0 };
+
+        if ((fstat(file, &info) == 0) && (info.st_size > 0))
+        {
+            void *mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+            if (mapping != MAP_FAILED)
+            {
+                data = (const unsigned char *)mapping;
+                *dataSize = (size_t)info.st_size;
+            }
+        }
+
+        close(file);    // Mapping keeps the file referenced
+    }
+#endif
+#else
+    (void)fileName;
+#endif
+
+    return data;
+}
+
+#if defined(SUPPORT_FILE_ARCHIVES)
+// Get normalized archive path ('/' separators, no leading "./")
+// NOTE: path buffer must be MAX_FILEPATH_LENGTH bytes
+static void GetArchivePath(const char *fileName, char *path)
+{
+    while ((fileName[0] == '.') && ((fileName[1] == '/') || (fileName[1] == '\\'))) fileName += 2;
+
+    int length = 0;
+    for (; (fileName[length] != '\0') && (length < (MAX_FILEPATH_LENGTH - 2)); length++) path[length] = (fileName[length] == '\\')? '/' : fileName[length];
+    path[length] = '\0';
+}
+
+// Get archive entry name hash (FNV-1a 64bit)
+static unsigned long long GetArchiveNameHash(const char *name)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+
+    for (const unsigned char *c = (const unsigned char *)name; *c != '\0'; c++)
+    {
+        hash ^= *c;
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+// Compare archive entries by hash and name, used by qsort()
+static int CompareArchiveEntries(const void *a, const void *b)
+{
+    const ArchiveExportEntry *entryA = (const ArchiveExportEntry *)a;
+    const ArchiveExportEntry *entryB = (const ArchiveExportEntry *)b;
+
+    if (entryA->entry.hash != entryB->entry.hash) return (entryA->entry.hash < entryB->entry.hash)? -1 : 1;
+
+    return strcmp(entryA->name, entryB->name);
+}
+
+// Find file entry in mounted archives, returns archive containing the entry or NULL
+// NOTE: Entries table is sorted by name hash, entry is found with a binary search
+static const FileArchive *FindArchiveEntry(const char *fileName, const ArchiveEntry **entry)
+{
+    if ((fileName == NULL) || (archiveCount == 0)) return NULL;
+
+    char path[MAX_FILEPATH_LENGTH] = { 0 };
+    GetArchivePath(fileName, path);
+
+    for (int i = archiveCount - 1; i >= 0; i--)
+    {
+        const FileArchive *archive = &archives[i];
+        size_t mountLength = strlen(archive->mountPath);
+
+        if (strncmp(path, archive->mountPath, mountLength) != 0) continue;
+
+        const char *name = path + mountLength;
+        unsigned long long hash = GetArchiveNameHash(name);
+
+        // Find first entry with same hash (lower bound)
+        unsigned int first = 0;
+        unsigned int count = archive->entryCount;
+
+        while (count > 0)
+        {
+            unsigned int step = count/2;
+
+            if (archive->entries[first + step].hash < hash)
+            {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else count = step;
+        }
+
+        for (unsigned int k = first; (k < archive->entryCount) && (archive->entries[k].hash == hash); k++)
+        {
+            if (strcmp(archive->names + archive->entries[k].nameOffset, name) == 0)
+            {
+                *entry = &archive->entries[k];
+                return archive;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+// Load archive entry data, allocating extraSize additional bytes at the end
+static unsigned char *LoadArchiveEntryData(const FileArchive *archive, const ArchiveEntry *entry, int extraSize, int *dataSize)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+    const char *name = archive->names + entry->nameOffset;
+
+    if ((entry->size == 0) || (entry->size > (unsigned long long)(2147483647 - extraSize)) || (entry->compSize > 2147483647))
+    {
+        if (entry->size == 0) TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", name);
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] File is bigger than 2147483647 bytes, avoid using LoadFileData()", name);
+        return NULL;
+    }
+
+    bool compressed = (entry->compSize > 0);
+    int size = (int)entry->size;
+    int storedSize = compressed? (int)entry->compSize : size;
+    const unsigned char *storedData = NULL;
+    unsigned char *fileData = NULL;
+
+    data = (unsigned char *)RL_MALLOC(size + extraSize);
+
+    if (data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocated memory for file reading", name);
+        return NULL;
+    }
+
+    if (archive->data != NULL) storedData = archive->data + entry->offset;
+#if defined(SUPPORT_STANDARD_FILEIO)
+    else
+    {
+        // Archive is not mapped, stored entries are read directly into output buffer
+        FILE *file = fopen(archive->fileName, "rb");
+
+        if (file != NULL)
+        {
+            fileData = compressed? (unsigned char *)RL_MALLOC(storedSize) : data;
+
+            if ((fileData != NULL) && (fseek(file, (long int)entry->offset, SEEK_SET) == 0) &&
+                (fread(fileData, 1, storedSize, file) == (size_t)storedSize)) storedData = fileData;
+
+            fclose(file);
+        }
+    }
+#endif
+
+    if (storedData != NULL)
+    {
+        if (compressed)
+        {
+#if defined(SUPPORT_COMPRESSION_API)
+            if (sinflate(data, size, storedData, storedSize) == size) *dataSize = size;
+#endif
+        }
+        else
+        {
+            if (storedData != data) memcpy(data, storedData, size);
+            *dataSize = size;
+        }
+    }
+
+    if (fileData != data) RL_FREE(fileData);
+
+    if (*dataSize == 0)
+    {
+        RL_FREE(data);
+        data = NULL;
+
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file from archive [%s]", name, archive->fileName);
+    }
+
+    return data;
+}
+#endif  // SUPPORT_FILE_ARCHIVES
+
+#if defined(UTILS_FILE_WATCHER)
+// Start file watcher thread
+static bool StartFileWatcher(void)
+{
+    bool result = false;
+
+    watcher.running = true;
+
+#if defined(_WIN32)
+    watcher.lock = NULL;    // SRWLOCK_INIT
+    watcher.wakeEvent = CreateEventA(NULL, 1, 0, NULL);
+
+    if (watcher.wakeEvent != NULL)
+    {
+        watcher.thread = CreateThread(NULL, 0, FileWatcherThread, NULL, 0, NULL);
+        result = (watcher.thread != NULL);
+
+        if (!result) CloseHandle(watcher.wakeEvent);
+    }
+#else
+    watcher.notifyFd = -1;
+#if defined(UTILS_INOTIFY)
+    watcher.notifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (watcher.notifyFd < 0) TRACELOG(LOG_WARNING, "FILEIO: inotify not available, watched files are polled");
+#endif
+
+    if (pipe(watcher.wakePipe) == 0)
+    {
+        pthread_mutex_init(&watcher.lock, NULL);
+        result = (pthread_create(&watcher.thread, NULL, FileWatcherThread, NULL) == 0);
+
+        if (!result)
+        {
+            pthread_mutex_destroy(&watcher.lock);
+            close(watcher.wakePipe[0]);
+            close(watcher.wakePipe[1]);
+        }
+    }
+
+    if (!result && (watcher.notifyFd >= 0)) close(watcher.notifyFd);
+#endif
+
+    if (result) TRACELOG(LOG_INFO, "FILEIO: File watcher started successfully");
+    else
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: Failed to start file watcher thread");
+        watcher.running = false;
+    }
+
+    return result;
+}
+
+// Stop file watcher thread
+static void StopFileWatcher(void)
+{
+    LOCK_FILE_WATCHER();
+    watcher.running = false;
+    UNLOCK_FILE_WATCHER();
+
+#if defined(_WIN32)
+    SetEvent(watcher.wakeEvent);
+    WaitForSingleObject(watcher.thread, 0xffffffff);   // INFINITE
+    CloseHandle(watcher.thread);
+    CloseHandle(watcher.wakeEvent);
+#else
+    if (write(watcher.wakePipe[1], "s", 1) < 0) TRACELOG(LOG_WARNING, "FILEIO: Failed to wake up file watcher");
+    pthread_join(watcher.thread, NULL);
+    pthread_mutex_destroy(&watcher.lock);
+    close(watcher.wakePipe[0]);
+    close(watcher.wakePipe[1]);
+    if (watcher.notifyFd >= 0) close(watcher.notifyFd);
+#endif
+
+    for (int i = 0; i < watcher.count; i++) RL_FREE(watcher.files[i].fileName);
+    RL_FREE(watcher.files);
+
+    memset(&watcher, 0, sizeof(FileWatcher));
+
+    TRACELOG(LOG_INFO, "FILEIO: File watcher stopped");
+}
+
+// Poll watched files modification time and size
+// NOTE: Data is only locked to access every file, file system is accessed unlocked
+static void PollWatchedFiles(void)
+{
+    char fileName[MAX_FILEPATH_LENGTH] = { 0 };
+
+    for (int i = 0; ; i++)
+    {
+        LOCK_FILE_WATCHER();
+        bool valid = (i < watcher.count);
+        bool polled = valid && (watcher.files[i].watchDescriptor < 0);
+        if (polled) strcpy(fileName, watcher.files[i].fileName);
+        UNLOCK_FILE_WATCHER();
+
+        if (!valid) break;
+        if (!polled) continue;
+
+        struct stat info = { 0 };
+        long long modTime = 0;
+        long long size = 0;
+
+        if (stat(fileName, &info) == 0)
+        {
+            modTime = (long long)info.st_mtime;
+            size = (long long)info.st_size;
+        }
+
+        LOCK_FILE_WATCHER();
+
+        // NOTE: Watched files could be modified while file system was accessed
+        if ((i < watcher.count) && (strcmp(watcher.files[i].fileName, fileName) == 0))
+        {
+            WatchedFile *file = &watcher.files[i];
+
+            if ((file->modTime != modTime) || (file->size != size))
+            {
+                file->modTime = modTime;
+                file->size = size;
+
+                if (!file->changed)
+                {
+                    file->changed = true;
+                    watcher.changedCount++;
+                }
+            }
+        }
+
+        UNLOCK_FILE_WATCHER();
+    }
+}
+
+#if defined(UTILS_INOTIFY)
+// Read inotify events and flag changed files
+static void ReadFileWatcherEvents(void)
+{
+    // NOTE: Buffer must be aligned for inotify_event struct
+    union { struct inotify_event event; char data[4096]; } buffer;
+
+    int length = 0;
+    while ((length = (int)read(watcher.notifyFd, buffer.data, sizeof(buffer.data))) > 0)
+    {
+        LOCK_FILE_WATCHER();
+
+        for (int offset = 0; offset < length; )
+        {
+            const struct inotify_event *event = (const struct inotify_event *)(buffer.data + offset);
+
+            for (int i = 0; i < watcher.count; i++)
+            {
+                WatchedFile *file = &watcher.files[i];
+
+                // NOTE: On events queue overflow all watched files are considered changed
+                if (!file->changed && ((event->mask & IN_Q_OVERFLOW) ||
+                    ((event->len > 0) && (file->watchDescriptor == event->wd) && (strcmp(file->name, event->name) == 0))))
+                {
+                    file->changed = true;
+                    watcher.changedCount++;
+                }
+            }
+
+            offset += (int)sizeof(struct inotify_event) + event->len;
+        }
+
+        UNLOCK_FILE_WATCHER();
+    }
+}
+#endif
+
+// File watcher thread, waits for file system events and polls files not watched by inotify
+#if defined(_WIN32)
+static unsigned long __stdcall FileWatcherThread(void *arg)
+{
+    (void)arg;
+
+    // NOTE: All files are polled, thread stops when wake event is set
+    while (WaitForSingleObject(watcher.wakeEvent, FILE_WATCHER_POLL_INTERVAL) == 0x00000102L) PollWatchedFiles();   // WAIT_TIMEOUT
+
+    return 0;
+}
+#else
+static void *FileWatcherThread(void *arg)
+{
+    (void)arg;
+
+    // NOTE: Negative file descriptors (inotify not available) are ignored by poll()
+    struct pollfd fds[2] = { 0 };
+    fds[0].fd = watcher.wakePipe[0];
+    fds[0].events = POLLIN;
+    fds[1].fd = watcher.notifyFd;
+    fds[1].events = POLLIN;
+
+    bool running = true;
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    long long pollTime = (long long)now.tv_sec*1000 + now.tv_nsec/1000000;     // Last files polling time (milliseconds)
+
+    while (running)
+    {
+        LOCK_FILE_WATCHER();
+        bool polling = (watcher.polledCount > 0);
+        UNLOCK_FILE_WATCHER();
+
+        // Timeout until next files polling, independent of inotify events and wake ups received meanwhile
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        long long elapsed = (long long)now.tv_sec*1000 + now.tv_nsec/1000000 - pollTime;
+        int timeout = -1;
+        if (polling) timeout = (elapsed < FILE_WATCHER_POLL_INTERVAL)? (int)(FILE_WATCHER_POLL_INTERVAL - elapsed) : 0;
+
+        int ready = poll(fds, 2, timeout);
+
+        if ((ready > 0) && (fds[0].revents & POLLIN))
+        {
+            // Wake up requested, to stop thread or to update polling timeout
+            char wake[64] = { 0 };
+            if (read(watcher.wakePipe[0], wake, sizeof(wake)) < 0) TRACELOG(LOG_WARNING, "FILEIO: Failed to read file watcher wake up");
+
+            LOCK_FILE_WATCHER();
+            running = watcher.running;
+            UNLOCK_FILE_WATCHER();
+        }
+    #if defined(UTILS_INOTIFY)
+        if (running && (ready > 0) && (fds[1].revents & POLLIN)) ReadFileWatcherEvents();
+    #endif
+
+        // Files polled every FILE_WATCHER_POLL_INTERVAL, also with steady inotify events or wake ups
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        long long currentTime = (long long)now.tv_sec*1000 + now.tv_nsec/1000000;
+
+        if (running && polling && ((currentTime - pollTime) >= FILE_WATCHER_POLL_INTERVAL))
+        {
+            PollWatchedFiles();
+            pollTime = currentTime;
+        }
+        else if (!polling) pollTime = currentTime;
+    }
+
+    return NULL;
+}
+#endif
+#endif  // UTILS_FILE_WATCHER
+
+#if defined(_WIN32) || defined(UTILS_PTHREADS)
+// Worker thread for parallel jobs, runs its interleaved share of jobs
+#if defined(_WIN32)
+static unsigned long __stdcall WorkerThread(void *arg)
+#else
+static void *WorkerThread(void *arg)
+#endif
+{
+    WorkerData *worker = (WorkerData *)arg;
+
+    for (int i = worker->jobStart; i < worker->jobCount; i += worker->jobStride) worker->func(worker->data, i);
+
+    return 0;
+}
+
+// Background worker thread, runs queued jobs in order until stop is requested and queue is empty
+// NOTE: Running job is kept in queue count until finished, its queue slot is not reused while running
+#if defined(_WIN32)
+static unsigned long __stdcall BackgroundWorkerThread(void *arg)
+#else
+static void *BackgroundWorkerThread(void *arg)
+#endif
+{
+    BackgroundWorker *worker = (BackgroundWorker *)arg;
+
+    LOCK_BACKGROUND_WORKER(worker);
+
+    while (true)
+    {
+        while ((worker->count == 0) && !worker->stop) WAIT_BACKGROUND_WORKER(worker);
+        if (worker->count == 0) break;
+
+        BackgroundJob job = worker->jobs[worker->head];
+
+        UNLOCK_BACKGROUND_WORKER(worker);
+        job.func(job.data);
+        LOCK_BACKGROUND_WORKER(worker);
+
+        worker->head = (worker->head + 1)%worker->capacity;
+        worker->count--;
+    }
+
+    UNLOCK_BACKGROUND_WORKER(worker);
+
+    return 0;
+}
+#endif
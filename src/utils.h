@@ -27,6 +27,8 @@
 #ifndef UTILS_H
 #define UTILS_H
 
+#include <stddef.h>                         // Required for: size_t
+
 #if defined(PLATFORM_ANDROID)
     #include <stdio.h>                      // Required for: FILE
     #include <android/asset_manager.h>      // Required for: AAssetManager
@@ -55,7 +57,14 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Parallel job function, called once for every job index
+typedef void (*ParallelJobFunc)(void *data, int index);
+
+// Background job function, background jobs are run in queue order
+typedef void (*BackgroundJobFunc)(void *data);
+
+// Background worker, one thread running queued jobs (opaque type)
+typedef struct BackgroundWorker BackgroundWorker;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -69,6 +78,18 @@
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+int GetWorkerThreadCount(void);                                        // Get number of worker threads used for parallel jobs (CPU cores available)
+void RunParallelJobs(ParallelJobFunc func, void *data, int jobCount);  // Run jobs [0..jobCount) in parallel, returns when all jobs are done
+
+BackgroundWorker *LoadBackgroundWorker(int capacity);                  // Load background worker thread, jobs queue limited to capacity
+void UnloadBackgroundWorker(BackgroundWorker *worker);                 // Unload background worker, waits for queued jobs to finish
+bool PushBackgroundJob(BackgroundWorker *worker, BackgroundJobFunc func, void *data);  // Queue background job, returns false if queue is full
+int GetBackgroundJobCount(BackgroundWorker *worker);                   // Get background jobs queued or running
+
+const unsigned char *MapFileData(const char *fileName, size_t *dataSize);   // Map file data read-only into memory, NULL if mapping is not available
+void UnmapFileData(const unsigned char *data, size_t dataSize);            // Unmap file data mapped by MapFileData()
+bool IsFileArchived(const char *fileName, size_t *dataSize);            // Check if file is available in mounted archives, returns archived file size
+
 #if defined(PLATFORM_ANDROID)
 void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initialize asset manager from android app
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
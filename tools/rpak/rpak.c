@@ -0,0 +1,53 @@
+/**********************************************************************************************
+*
+*   rpak - raylib packed file archive (.rpak) builder
+*
+*   Packs all files in a directory (recursively) into a single archive that can be mounted
+*   with MountArchive(), archived files are named by their path relative to the directory
+*
+*   USAGE:
+*       rpak <archive.rpak> <directory> [filter]
+*
+*       Optional filter selects files by extension, i.e. ".png;.wav;.ogg"
+*
+*   LICENSE: zlib/libpng
+*
+*   rpak is licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software:
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>              // Required for: printf()
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    if ((argc < 3) || (argc > 4))
+    {
+        printf("USAGE: rpak <archive.rpak> <directory> [filter]\n");
+        return 1;
+    }
+
+    if (!DirectoryExists(argv[2]))
+    {
+        printf("ERROR: Directory not found: %s\n", argv[2]);
+        return 1;
+    }
+
+    FilePathList files = LoadDirectoryFilesEx(argv[2], (argc == 4)? argv[3] : NULL, true);
+
+    bool success = ExportArchive(argv[1], files, argv[2]);
+
+    if (success) printf("Archive created: %s (%i files)\n", argv[1], files.count);
+    else printf("ERROR: Failed to create archive: %s\n", argv[1]);
+
+    UnloadDirectoryFiles(files);
+
+    return success? 0 : 1;
+}